@@ -13,6 +13,8 @@ let ws = null;
 let nrOfMdlColumns = 4;
 let onUICommands = [];
 let model = []; //model.json (as send by the server), used by FindVar
+let modelBoot = 0; //model of this server boot, 0: no model yet
+let modelVersion = 0; //model version received, on reconnect only newer values are send
 let savedView = null;
 
 //C++ equivalents
@@ -168,6 +170,12 @@ function makeWS() {
         // console.log(buffer, canvasNode);
         previewBoard(canvasNode, buffer);
       }
+      else if (buffer[0]==binVars) {
+        clearTimeout(jsonTimeout);
+        jsonTimeout = null;
+        gId('connind').style.backgroundColor = "var(--c-l)";
+        receiveBinRecords(buffer);
+      }
       else 
         userFun(buffer);
     } 
@@ -219,6 +227,7 @@ function makeWS() {
   ws.onopen = (e)=>{
     console.log("WS open", e);
 		reqsLegal = true;
+    requestJson({"sync": {"boot": modelBoot, "version": modelVersion}}); //ask for the model or changes since modelVersion
   }
   ws.onerror = (e)=>{
     console.log("WS error", e);
@@ -739,6 +748,15 @@ function receiveData(json) {
         ppf("receiveData", key, value);
         changeHTMLTheme(value);
       }
+      else if (key == "sync") {
+        ppf("receiveData", key, value);
+        if (value.full) //model changed, get it again
+          location.reload();
+        else {
+          modelBoot = value.boot;
+          modelVersion = value.version;
+        }
+      }
       else if (key == "canvasData") {
         ppf("receiveData no action", key, value);
       } else if (key == "details") {
@@ -1352,6 +1370,111 @@ function requestJson(command) {
   });
 }
 
+//binary var messages, see BinRecord in SysModWeb.h: binVars, then per record handle (uint16), rowNr, type, value
+const binVars = 2; //0: pins, 1: preview
+const binInt = 0;
+const binFloat = 1;
+const binString = 2;
+const binBool = 3;
+let binRecords = new Map(); //latest record per var and rowNr, send by flushBinRecords
+let binTimeout = null;
+
+function findVarByHandle(handle, parent = model) {
+  for (let variable of parent) {
+    if (variable.h == handle)
+      return variable;
+    else if (variable.n) {
+      let foundVar = findVarByHandle(handle, variable.n); //recursive
+      if (foundVar) return foundVar;
+    }
+  }
+  return null;
+}
+
+//returns false if the value cannot be send binary (e.g. coord3D)
+function sendBinValue(variable, rowNr, value) {
+  if (!reqsLegal || !ws || variable.h == null) return false;
+
+  let record;
+  if (typeof value == "boolean") {
+    record = new Uint8Array(5);
+    record[3] = binBool;
+    record[4] = value?1:0;
+  }
+  else if (typeof value == "number") {
+    record = new Uint8Array(8);
+    record[3] = Number.isInteger(value)?binInt:binFloat;
+    let view = new DataView(record.buffer);
+    if (record[3] == binInt)
+      view.setInt32(4, value, true);
+    else
+      view.setFloat32(4, value, true);
+  }
+  else if (typeof value == "string") {
+    let chars = new TextEncoder().encode(value);
+    if (chars.length > 255) return false;
+    record = new Uint8Array(5 + chars.length);
+    record[3] = binString;
+    record[4] = chars.length;
+    record.set(chars, 5);
+  }
+  else
+    return false;
+
+  record[0] = variable.h & 0xFF;
+  record[1] = variable.h >> 8;
+  record[2] = rowNr;
+
+  binRecords.set(variable.h + "#" + rowNr, record); //only the latest value per var is send
+  if (!binTimeout) binTimeout = setTimeout(flushBinRecords, 16); //batch changes of ~ one frame
+  return true;
+}
+
+function flushBinRecords() {
+  binTimeout = null;
+  if (!ws || binRecords.size == 0) return;
+
+  let len = 1;
+  for (let record of binRecords.values()) len += record.length;
+  let buffer = new Uint8Array(len);
+  buffer[0] = binVars;
+  let pos = 1;
+  for (let record of binRecords.values()) {
+    buffer.set(record, pos);
+    pos += record.length;
+  }
+  binRecords.clear();
+
+  gId('connind').style.backgroundColor = "var(--c-y)";
+  if (!jsonTimeout) jsonTimeout = setTimeout(()=>{if (ws) ws.close(); ws=null; console.log("connection failed")}, 3000);
+  ws.send(buffer);
+}
+
+function receiveBinRecords(buffer) {
+  let view = new DataView(buffer.buffer);
+  let pos = 1;
+  while (pos + 5 <= buffer.length) {
+    let handle = view.getUint16(pos, true);
+    let rowNr = buffer[pos+2];
+    let type = buffer[pos+3];
+    let value;
+    let size;
+    if (type == binInt) {value = view.getInt32(pos+4, true); size = 8;}
+    else if (type == binFloat) {value = view.getFloat32(pos+4, true); size = 8;}
+    else if (type == binString) {value = new TextDecoder().decode(buffer.subarray(pos+5, pos+5+buffer[pos+4])); size = 5 + buffer[pos+4];}
+    else if (type == binBool) {value = buffer[pos+4] != 0; size = 5;}
+    else {
+      console.log("dev receiveBinRecords unknown type", type);
+      return;
+    }
+    pos += size;
+
+    let variable = findVarByHandle(handle);
+    if (variable && variable.type != "button") //a button has no value
+      changeHTML(variable, {"value":value, "chk":"bin"}, rowNr);
+  }
+}
+
 function sendValue(varNode) {
   let varId;
   if (varNode.id == "saveModel" || varNode.id == "bSave") {
@@ -1387,7 +1510,14 @@ function sendValue(varNode) {
     //https://stackoverflow.com/questions/175739/how-can-i-check-if-a-string-is-a-valid-number
     command[varId].value = isNaN(varNode.value)?varNode.value:parseFloat(varNode.value); //type number is default but html converts numbers in <option> to string, float to remove the quotes from all type of numbers
   console.log("sendValue", command);
-  
+
+  //binary if the var has a handle, json otherwise
+  let pidid = varId.split("#")[0].split(".");
+  let rowNr = varId.includes("#")?parseInt(varId.split("#")[1]):UINT8_MAX;
+  let variable = controller.modules.findVar(pidid[0], pidid[1]);
+  if (variable && sendBinValue(variable, rowNr, varNode.className == "button"?0:command[varId].value))
+    return;
+
   requestJson(command);
 }
 
@@ -168,6 +168,7 @@ class Controller {
     }
     this.ws.onopen = (e)=>{
       console.log("WS open", e);
+      this.requestJson({"sync": {"boot": 0, "version": 0}}); //ask for the whole model
     }
     this.ws.onerror = (e)=>{
       console.log("WS error", e);
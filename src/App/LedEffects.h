@@ -72,6 +72,7 @@ public:
           }
           default: leds.palette = PartyColors_p; //should never occur
         }
+        leds.expandPalette();
         return true;
       default: return false;
     }});
@@ -90,8 +91,16 @@ class SolidEffect: public Effect {
     uint8_t green = leds.effectData.read<uint8_t>();
     uint8_t blue = leds.effectData.read<uint8_t>();
 
+    //binding of loop persistent values (pointers)
+    CRGB *prevColor = leds.effectData.readWrite<CRGB>();
+    bool *filled = leds.effectData.readWrite<bool>();
+
     CRGB color = CRGB(red, green, blue);
     leds.fill_solid(color);
+
+    leds.unchanged = *filled && *prevColor == color;
+    *prevColor = color;
+    *filled = true;
   }
   
   void controls(LedsLayer &leds, JsonObject parentVar) {
@@ -182,14 +191,14 @@ class FlowEffect: public Effect {
     uint16_t zoneLen = leds.nrOfLeds / zones;
     uint16_t offset  = (leds.nrOfLeds - zones * zoneLen) >> 1;
 
-    leds.fill_solid(ColorFromPalette(leds.palette, -counter));
+    leds.fill_solid(leds.colorFromPalette(-counter));
 
     for (int z = 0; z < zones; z++) {
       uint16_t pos = offset + z * zoneLen;
       for (int i = 0; i < zoneLen; i++) {
         uint8_t  colorIndex = (i * 255 / zoneLen) - counter;
         uint16_t led = (z & 0x01) ? i : (zoneLen -1) -i;
-        leds[pos + led] = ColorFromPalette(leds.palette, colorIndex);
+        leds[pos + led] = leds.colorFromPalette(colorIndex);
       }
     }
   }
@@ -247,7 +256,7 @@ class BPMEffect: public Effect {
     uint8_t BeatsPerMinute = 62;
     uint8_t beat = beatsin8( BeatsPerMinute, 64, 255);
     for (uint16_t i = 0; i < leds.nrOfLeds; i++) { //9948
-      leds[i] = ColorFromPalette(leds.palette, sys->now/50+(i*2), beat-sys->now/50+(i*10));
+      leds[i] = leds.colorFromPalette(sys->now/50+(i*2), beat-sys->now/50+(i*10));
     }
   }
   
@@ -399,7 +408,7 @@ class BouncingBallsEffect: public Effect {
 
       int pos = roundf(balls[i].height * (leds.nrOfLeds - 1));
 
-      CRGB color = ColorFromPalette(leds.palette, i*(256/max(numBalls, (uint8_t)8))); //error: no matching function for call to 'max(uint8_t&, int)'
+      CRGB color = leds.colorFromPalette(i*(256/max(numBalls, (uint8_t)8))); //error: no matching function for call to 'max(uint8_t&, int)'
 
       leds[pos] = color;
       // if (leds.nrOfLeds<32) leds.setPixelColor(indexToVStrip(pos, stripNr), color); // encode virtual strip into index
@@ -463,9 +472,9 @@ void mode_fireworks(LedsLayer &leds, uint16_t *aux0, uint16_t *aux1, uint8_t spe
       if(random8(my_intensity) == 0) {
         uint16_t index = random(leds.nrOfLeds);
         if (soundColor < 0)
-          leds.setPixelColor(index, ColorFromPalette(leds.palette, random8()));
+          leds.setPixelColor(index, leds.colorFromPalette(random8()));
         else
-          leds.setPixelColor(index, ColorFromPalette(leds.palette, soundColor + random8(24))); // WLEDSR
+          leds.setPixelColor(index, leds.colorFromPalette(soundColor + random8(24))); // WLEDSR
         *aux1 = *aux0;
         *aux0 = index;
       }
@@ -566,7 +575,7 @@ class DripEffect: public Effect {
         drops[j].vel = 0;           // speed
         drops[j].col = sourcedrop;  // brightness
         drops[j].colIndex = 1;      // drop state (0 init, 1 forming, 2 falling, 5 bouncing)
-        drops[j].velX = (uint32_t)ColorFromPalette(leds.palette, random8()); // random color
+        drops[j].velX = (uint32_t)leds.colorFromPalette(random8()); // random color
       }
       CRGB dropColor = drops[j].velX;
 
@@ -658,7 +667,7 @@ class HeartBeatEffect: public Effect {
     }
 
     for (int i = 0; i < leds.nrOfLeds; i++) {
-      leds.setPixelColor(i, ColorFromPalette(leds.palette, map(i, 0, leds.nrOfLeds, 0, 255), 255 - (*bri_lower >> 8)));
+      leds.setPixelColor(i, leds.colorFromPalette(map(i, 0, leds.nrOfLeds, 0, 255), 255 - (*bri_lower >> 8)));
     }
   }
   
@@ -689,28 +698,30 @@ class FreqMatrixEffect: public Effect {
     //binding of loop persistent values (pointers) tbd: aux0,1,step etc can be renamed to meaningful names
     uint8_t *aux0 = leds.effectData.readWrite<uint8_t>();
 
+    AudioFrame audio = audioSync->frame(); //once per frame: same values for all pixels
+
     uint8_t secondHand = (speed < 255) ? (micros()/(256-speed)/500 % 16) : 0;
     if((speed > 254) || (*aux0 != secondHand)) {   // WLEDMM allow run run at full speed
       *aux0 = secondHand;
 
       // Pixel brightness (value) based on volume * sensitivity * intensity
       // uint_fast8_t sensitivity10 = map(sensitivity, 0, 31, 10, 100); // reduced resolution slider // WLEDMM sensitivity * 10, to avoid losing precision
-      int pixVal = audioSync->sync.volumeSmth * (float)fx * (float)sensitivity10 / 2560.0f; // WLEDMM 2560 due to sensitivity * 10
+      int pixVal = audio.volumeSmth * (float)fx * (float)sensitivity10 / 2560.0f; // WLEDMM 2560 due to sensitivity * 10
       if (pixVal > 255) pixVal = 255;  // make a brightness from the last avg
 
       CRGB color = CRGB::Black;
 
-      if (audioSync->sync.FFT_MajorPeak > MAX_FREQUENCY) audioSync->sync.FFT_MajorPeak = 1;
+      if (audio.majorPeak > MAX_FREQUENCY) audio.majorPeak = 1;
       // MajorPeak holds the freq. value which is most abundant in the last sample.
       // With our sampling rate of 10240Hz we have a usable freq range from roughtly 80Hz to 10240/2 Hz
       // we will treat everything with less than 65Hz as 0
 
-      if ((audioSync->sync.FFT_MajorPeak > 80.0f) && (audioSync->sync.volumeSmth > 0.25f)) { // WLEDMM
+      if ((audio.majorPeak > 80.0f) && (audio.volumeSmth > 0.25f)) { // WLEDMM
         // Pixel color (hue) based on major frequency
         int upperLimit = 80 + 42 * highBin;
         int lowerLimit = 80 + 3 * lowBin;
         //uint8_t i =  lowerLimit!=upperLimit ? map(FFT_MajorPeak, lowerLimit, upperLimit, 0, 255) : FFT_MajorPeak;  // (original formula) may under/overflow - so we enforce uint8_t
-        int freqMapped =  lowerLimit!=upperLimit ? map(audioSync->sync.FFT_MajorPeak, lowerLimit, upperLimit, 0, 255) : audioSync->sync.FFT_MajorPeak;  // WLEDMM preserve overflows
+        int freqMapped =  lowerLimit!=upperLimit ? map(audio.majorPeak, lowerLimit, upperLimit, 0, 255) : audio.majorPeak;  // WLEDMM preserve overflows
         uint8_t i = abs(freqMapped) & 0xFF;  // WLEDMM we embrace overflow ;-) by "modulo 256"
 
         color = CHSV(i, 240, (uint8_t)pixVal); // implicit conversion to RGB supplied by FastLED
@@ -750,6 +761,10 @@ class PopCornEffect: public Effect {
     //binding of loop persistent values (pointers)
     Spark *popcorn = leds.effectData.readWrite<Spark>(maxNumPopcorn); //array
 
+    #ifdef STARLIGHT_USERMOD_AUDIOSYNC
+      AudioFrame audio = audioSync->frame(); //once per frame: same values for all pixels
+    #endif
+
     leds.fill_solid(CRGB::Black);
 
     float gravity = -0.0001f - (speed/200000.0f); // m/s/s
@@ -766,7 +781,7 @@ class PopCornEffect: public Effect {
         // WLEDMM begin
         #ifdef STARLIGHT_USERMOD_AUDIOSYNC
           if (useaudio) {
-            if (  (audioSync->sync.volumeSmth > 1.0f)                      // no pops in silence
+            if (  (audio.volumeSmth > 1.0f)                      // no pops in silence
                 // &&((audioSync->sync.samplePeak > 0) || (audioSync->sync.volumeRaw > 128))  // try to pop at onsets (our peek detector still sucks)
                 &&(random8() < 4) )                        // stay somewhat random
               doPopCorn = true;
@@ -796,7 +811,7 @@ class PopCornEffect: public Effect {
         // uint32_t col = SEGMENT.color_wheel(popcorn[i].colIndex);
         // if (!SEGMENT.palette && popcorn[i].colIndex < NUM_COLORS) col = SEGCOLOR(popcorn[i].colIndex);
         uint16_t ledIndex = popcorn[i].pos;
-        CRGB col = ColorFromPalette(leds.palette, popcorn[i].colIndex*(256/maxNumPopcorn));
+        CRGB col = leds.colorFromPalette(popcorn[i].colIndex*(256/maxNumPopcorn));
         if (ledIndex < leds.nrOfLeds) leds.setPixelColor(ledIndex, col);
       }
     }
@@ -826,16 +841,18 @@ class NoiseMeterEffect: public Effect {
     uint8_t *aux0 = leds.effectData.readWrite<uint8_t>();
     uint8_t *aux1 = leds.effectData.readWrite<uint8_t>();
 
+    AudioFrame audio = audioSync->frame(); //once per frame: same values for all pixels
+
     leds.fadeToBlackBy(fadeRate);
 
-    float tmpSound2 = audioSync->sync.volumeRaw * 2.0 * (float)width / 255.0;
+    float tmpSound2 = audio.volumeRaw * 2.0 * (float)width / 255.0;
     int maxLen = map(tmpSound2, 0, 255, 0, leds.nrOfLeds); // map to pixels availeable in current segment              // Still a bit too sensitive.
     // if (maxLen <0) maxLen = 0;
     // if (maxLen >leds.nrOfLeds) maxLen = leds.nrOfLeds;
 
     for (int i=0; i<maxLen; i++) {                                    // The louder the sound, the wider the soundbar. By Andrew Tuline.
-      uint8_t index = inoise8(i*audioSync->sync.volumeSmth+*aux0, *aux1+i*audioSync->sync.volumeSmth);  // Get a value from the noise function. I'm using both x and y axis.
-      leds.setPixelColor(i, ColorFromPalette(leds.palette, index));//, 255, PALETTE_SOLID_WRAP));
+      uint8_t index = inoise8(i*audio.volumeSmth+*aux0, *aux1+i*audio.volumeSmth);  // Get a value from the noise function. I'm using both x and y axis.
+      leds.setPixelColor(i, leds.colorFromPalette(index));//, 255, PALETTE_SOLID_WRAP));
     }
 
     *aux0+=beatsin8(5,0,10);
@@ -859,34 +876,36 @@ class AudioRingsEffect: public RingEffect {
     bool inWards = leds.effectData.read<bool>();
     uint8_t nrOfRings = leds.effectData.read<uint8_t>();
 
+    AudioFrame audio = audioSync->frame(); //once per frame: same values for all pixels
+
     for (int i = 0; i < nrOfRings; i++) {
 
       uint8_t band = map(i, 0, nrOfRings-1, 0, 15);
 
       byte val;
       if (inWards) {
-        val = audioSync->fftResults[band];
+        val = audio.bands[band];
       }
       else {
-        val = audioSync->fftResults[15 - band];
+        val = audio.bands[15 - band];
       }
   
       // Visualize leds to the beat
-      CRGB color = ColorFromPalette(leds.palette, val, val);
+      CRGB color = leds.colorFromPalette(val, val);
 //      CRGB color = ColorFromPalette(currentPalette, val, 255, currentBlending);
 //      color.nscale8_video(val);
       setRing(leds, i, color);
 //        setRingFromFtt((i * 2), i); 
     }
 
-    setRingFromFtt(leds, 2, 7); // set outer ring to bass
-    setRingFromFtt(leds, 0, 8); // set outer ring to bass
+    setRingFromFtt(leds, audio, 2, 7); // set outer ring to bass
+    setRingFromFtt(leds, audio, 0, 8); // set outer ring to bass
 
   }
-  void setRingFromFtt(LedsLayer &leds, int index, int ring) {
-    byte val = audioSync->fftResults[index];
+  void setRingFromFtt(LedsLayer &leds, const AudioFrame &audio, int index, int ring) {
+    byte val = audio.bands[index];
     // Visualize leds to the beat
-    CRGB color = ColorFromPalette(leds.palette, val);
+    CRGB color = leds.colorFromPalette(val);
     color.nscale8_video(val);
     setRing(leds, ring, color);
   }
@@ -916,10 +935,12 @@ class DJLightEffect: public Effect {
     //binding of loop persistent values (pointers) tbd: aux0,1,step etc can be renamed to meaningful names
     uint8_t *aux0 = leds.effectData.readWrite<uint8_t>();
 
+    AudioFrame audio = audioSync->frame(); //once per frame: same values for all pixels
+
     const int mid = leds.nrOfLeds / 2;
 
-    uint8_t *fftResult = audioSync->fftResults;
-    float volumeSmth   = audioSync->volumeSmth;
+    uint8_t *fftResult = audio.bands;
+    float volumeSmth   = audio.volumeSmth;
 
     uint8_t secondHand = (speed < 255) ? (micros()/(256-speed)/500 % 16) : 0;
     if((speed > 254) || (*aux0 != secondHand)) {   // WLEDMM allow run run at full speed
@@ -1083,8 +1104,8 @@ class DNAEffect: public Effect {
       //32: 4 * i
       //16: 8 * i
       phase = i * 127 / (leds.size.x-1) * phases / 64;
-      leds.setPixelColor(leds.XY(i, beatsin8(speed, 0, leds.size.y-1, 0, phase    )), ColorFromPalette(leds.palette, i*5+ sys->now /17, beatsin8(5, 55, 255, 0, i*10)));
-      leds.setPixelColor(leds.XY(i, beatsin8(speed, 0, leds.size.y-1, 0, phase+128)), ColorFromPalette(leds.palette, i*5+128+ sys->now /17, beatsin8(5, 55, 255, 0, i*10+128)));
+      leds.setPixelColor(leds.XY(i, beatsin8(speed, 0, leds.size.y-1, 0, phase    )), leds.colorFromPalette(i*5+ sys->now /17, beatsin8(5, 55, 255, 0, i*10)));
+      leds.setPixelColor(leds.XY(i, beatsin8(speed, 0, leds.size.y-1, 0, phase+128)), leds.colorFromPalette(i*5+128+ sys->now /17, beatsin8(5, 55, 255, 0, i*10+128)));
     }
     leds.blur2d(blur);
   }
@@ -1214,7 +1235,7 @@ class OctopusEffect: public Effect {
           //CRGB c = CHSV(*step / 2 - radius, 255, sin8(sin8((angle * 4 - radius) / 4 + *step) + radius - *step * 2 + angle * (SEGMENT.custom3/3+1)));
           uint16_t intensity = sin8(sin8((angle * 4 - radius) / 4 + *step/2) + radius - *step + angle * legs);
           intensity = map(intensity*intensity, 0, UINT16_MAX, 0, 255); // add a bit of non-linearity for cleaner display
-          CRGB color = ColorFromPalette(leds.palette, *step / 2 - radius, intensity);
+          CRGB color = leds.colorFromPalette(*step / 2 - radius, intensity);
           leds[pos] = color;
         }
       }
@@ -1313,7 +1334,7 @@ class FrizzlesEffect: public Effect {
       Coord3D pos = {0,0,0};
       pos.x = beatsin8(bpm/8 + i, 0, leds.size.x - 1);
       pos.y = beatsin8(intensity/8 - i, 0, leds.size.y - 1);
-      CRGB color = ColorFromPalette(leds.palette, beatsin8(12, 0, 255));
+      CRGB color = leds.colorFromPalette(beatsin8(12, 0, 255));
       leds[pos] = color;
     }
     leds.blur2d(blur);
@@ -1444,7 +1465,7 @@ class GameOfLifeEffect: public Effect {
   void placePentomino(LedsLayer &leds, byte *futureCells, bool colorByAge) {
     byte pattern[5][2] = {{1, 0}, {0, 1}, {1, 1}, {2, 1}, {2, 2}}; // R-pentomino
     if (!random8(5)) pattern[0][1] = 3; // 1/5 chance to use glider
-    CRGB color = ColorFromPalette(leds.palette, random8());
+    CRGB color = leds.colorFromPalette(random8());
     for (int attempts = 0; attempts < 100; attempts++) {
       int x = random8(1, leds.size.x - 3);
       int y = random8(1, leds.size.y - 5);
@@ -1500,12 +1521,12 @@ class GameOfLifeEffect: public Effect {
     byte     *cellColors       = leds.effectData.readWrite<byte>(leds.size.x * leds.size.y * leds.size.z);
 
     CRGB bgColor = CRGB(bgC.x, bgC.y, bgC.z);
-    CRGB color   = ColorFromPalette(leds.palette, random8()); // Used if all parents died
+    CRGB color   = leds.colorFromPalette(random8()); // Used if all parents died
 
     // Start New Game of Life
     if (*setup || (*generation == 0 && *step < sys->now)) {
       *setup = false;
-      *prevPalette = ColorFromPalette(leds.palette, 0);
+      *prevPalette = leds.colorFromPalette(0);
       *generation = 1;
       disablePause ? *step = sys->now : *step = sys->now + 1500;
 
@@ -1519,7 +1540,7 @@ class GameOfLifeEffect: public Effect {
           int index = leds.XYZUnprojected({x,y,z});
           setBitValue(cells, index, true);
           cellColors[index] = random8(1, 255);
-          leds.setPixelColor({x,y,z}, colorByAge ? CRGB::Green : ColorFromPalette(leds.palette, cellColors[index]));
+          leds.setPixelColor({x,y,z}, colorByAge ? CRGB::Green : leds.colorFromPalette(cellColors[index]));
           // leds.setPixelColor({x,y,z}, bgColor); // Color set in redraw loop
         }
       }
@@ -1551,10 +1572,10 @@ class GameOfLifeEffect: public Effect {
         // Redraw alive if palette changed, spawn initial colors randomly, age alive cells while paused
         if      (alive && recolor) {
           cellColors[cIndex] = random8(1, 255);
-          leds.setPixelColor(cLoc, colorByAge ? CRGB::Green : ColorFromPalette(leds.palette, cellColors[cIndex]));
+          leds.setPixelColor(cLoc, colorByAge ? CRGB::Green : leds.colorFromPalette(cellColors[cIndex]));
         }
         else if (alive && colorByAge && !*generation) leds.blendPixelColor(cLoc, CRGB::Red, 248); // Age alive cells while paused
-        else if (alive && cellColors[cIndex] != 0) leds.setPixelColor(cLoc, colorByAge ? CRGB::Green : ColorFromPalette(leds.palette, cellColors[cIndex]));
+        else if (alive && cellColors[cIndex] != 0) leds.setPixelColor(cLoc, colorByAge ? CRGB::Green : leds.colorFromPalette(cellColors[cIndex]));
         // Redraw dead if palette changed, blur paused game, fade on newgame
         // if      (!alive && (paletteChanged || disablePause)) leds.setPixelColor(cLoc, bgColor);   // Remove blended dead cells
         else if (!alive && blurDead)         leds.blendPixelColor(cLoc, bgColor, blur);           // Blend dead cells while paused
@@ -1563,7 +1584,10 @@ class GameOfLifeEffect: public Effect {
     }
 
     // if (!speed || *step > sys->now || sys->now - *step < 1000 / speed) return; // Check if enough time has passed for updating
-    if (!speed || *step > sys->now || (speed != 100 && sys->now - *step < 1000 / speed)) return; // Uncapped speed when slider maxed
+    if (!speed || *step > sys->now || (speed != 100 && sys->now - *step < 1000 / speed)) { // Uncapped speed when slider maxed
+      leds.unchanged = !(*generation <= 1 || blurDead); // nothing drawn between generations if no redraw loop
+      return;
+    }
 
     //Rule set for game of life
     if (*ruleChanged) {
@@ -1634,7 +1658,7 @@ class GameOfLifeEffect: public Effect {
         byte colorIndex = nColors[random8(colorCount)];
         if (random8(100) < mutation) colorIndex = random8();
         cellColors[cIndex] = colorIndex;
-        leds.setPixelColor(cPos, colorByAge ? CRGB::Green : ColorFromPalette(leds.palette, colorIndex));
+        leds.setPixelColor(cPos, colorByAge ? CRGB::Green : leds.colorFromPalette(colorIndex));
       }
       else {
         // Blending, fade dead cells further causing blurring effect to moving cells
@@ -1647,7 +1671,7 @@ class GameOfLifeEffect: public Effect {
         }
         else { // alive
           if (colorByAge) leds.blendPixelColor(cPos, CRGB::Red, 248);
-          else leds.setPixelColor(cPos, ColorFromPalette(leds.palette, cellColors[cIndex]));
+          else leds.setPixelColor(cPos, leds.colorFromPalette(cellColors[cIndex]));
         }
       }
     }
@@ -2158,7 +2182,7 @@ class ParticleTestEffect: public Effect {
         if (leds.projectionDimension == _3D) particles[index].vz = (random8() / 256.0f) * 2.0f - 1.0f;
         else particles[index].vz = 0;
 
-        particles[index].color = ColorFromPalette(leds.palette, random8());
+        particles[index].color = leds.colorFromPalette(random8());
         Coord3D initPos = particles[index].toCoord3DRounded();
         leds.setPixelColor(initPos, particles[index].color);
       }
@@ -2288,7 +2312,7 @@ class StarFieldEffect: public Effect {  // Inspired by Daniel Shiffman's Coding
 
       Coord3D pos = {int(sx), int(sy), 0};
       if (!pos.isOutofBounds(leds.size)) {
-        if (usePalette) leds.setPixelColor(leds.XY(int(sx), int(sy)), ColorFromPalette(leds.palette, stars[i].colorIndex, map(stars[i].z, 0, leds.size.x, 255, 150)));
+        if (usePalette) leds.setPixelColor(leds.XY(int(sx), int(sy)), leds.colorFromPalette(stars[i].colorIndex, map(stars[i].z, 0, leds.size.x, 255, 150)));
         else {
           uint8_t color = map(stars[i].colorIndex, 0, 255, 120, 255);
           int brightness = map(stars[i].z, 0, leds.size.x, 7, 10);
@@ -2343,7 +2367,7 @@ public:
     for (pos.x = 0; pos.x < leds.size.x; pos.x++){
       for(pos.y = 0; pos.y < leds.size.y; pos.y++){
         uint8_t hue = huebase + ((pos.x+pos.y)*(250-macro_mutator)/5) + ((pos.x+pos.y*macro_mutator*pos.x)/(micro_mutator+1));
-        CRGB colour = ColorFromPalette(leds.palette, hue, 255, LINEARBLEND);
+        CRGB colour = leds.colorFromPalette(hue);
         leds[pos] = colour;// blend(leds.getPixelColor(pos), colour, 155);
       }
     }
@@ -2362,7 +2386,7 @@ public:
   }
 }; // Praxis
 
-class BasicTemplate: public Effect { // add effects.push_back(new Name); to LedModEffects.h
+class BasicTemplate: public Effect { // add &StaticInstance<Name>::instance to effectTable in LedModEffects.h
   const char * name() {return "Template";}
   uint8_t     dim() {return _3D;} // _1D, _2D, or _3D
   const char * tags() {return "💫";}
@@ -2418,6 +2442,8 @@ class WaverlyEffect: public Effect {
     // bool soundPressure = leds.effectData.read<bool>();
     // bool agcDebug = leds.effectData.read<bool>();
 
+    AudioFrame audio = audioSync->frame(); //once per frame: same values for all pixels
+
     leds.fadeToBlackBy(amplification);
     // if (agcDebug && soundPressure) soundPressure = false;                 // only one of the two at any time
     // if ((soundPressure) && (audioSync->sync.volumeSmth > 0.5f)) audioSync->sync.volumeSmth = audioSync->sync.soundPressure;    // show sound pressure instead of volume
@@ -2426,11 +2452,11 @@ class WaverlyEffect: public Effect {
     long t = sys->now / 2; 
     Coord3D pos;
     for (pos.x = 0; pos.x < leds.size.x; pos.x++) {
-      uint16_t thisVal = audioSync->sync.volumeSmth*sensitivity/64 * inoise8(pos.x * 45 , t , t)/64;      // WLEDMM back to SR code
+      uint16_t thisVal = audio.volumeSmth*sensitivity/64 * inoise8(pos.x * 45 , t , t)/64;      // WLEDMM back to SR code
       uint16_t thisMax = min(map(thisVal, 0, 512, 0, leds.size.y), (long)leds.size.x);
 
       for (pos.y = 0; pos.y < thisMax; pos.y++) {
-        CRGB color = ColorFromPalette(leds.palette, map(pos.y, 0, thisMax, 250, 0));
+        CRGB color = leds.colorFromPalette(map(pos.y, 0, thisMax, 250, 0));
         if (!noClouds)
           leds.addPixelColor(pos, color);
         leds.addPixelColor(leds.XY((leds.size.x - 1) - pos.x, (leds.size.y - 1) - pos.y), color);
@@ -2469,6 +2495,8 @@ class GEQEffect: public Effect {
     uint16_t *previousBarHeight = leds.effectData.readWrite<uint16_t>(leds.size.x); //array
     unsigned long *step = leds.effectData.readWrite<unsigned long>();
 
+    AudioFrame audio = audioSync->frame(); //once per frame: same values for all pixels
+
     const int NUM_BANDS = NUM_GEQ_CHANNELS ; // map(SEGMENT.custom1, 0, 255, 1, 16);
 
     #ifdef SR_DEBUG
@@ -2502,7 +2530,7 @@ class GEQEffect: public Effect {
       uint8_t frBand = ((NUM_BANDS < 16) && (NUM_BANDS > 1)) ? map(band, 0, NUM_BANDS - 1, 0, 15):band; // always use full range. comment out this line to get the previous behaviour.
       // frBand = constrain(frBand, 0, 15); //WLEDMM can never be out of bounds (I think...)
       uint16_t colorIndex = frBand * 17; //WLEDMM 0.255
-      uint16_t bandHeight = audioSync->fftResults[frBand];  // WLEDMM we use the original ffResult, to preserve accuracy
+      uint16_t bandHeight = audio.bands[frBand];  // WLEDMM we use the original ffResult, to preserve accuracy
 
       // WLEDMM begin - smooth out bars
       if ((pos.x > 0) && (pos.x < (leds.size.x-1)) && (smoothBars)) {
@@ -2510,7 +2538,7 @@ class GEQEffect: public Effect {
         uint8_t nextband = (remaining < 1)? band +1: band;
         nextband = constrain(nextband, 0, 15);  // just to be sure
         frBand = ((NUM_BANDS < 16) && (NUM_BANDS > 1)) ? map(nextband, 0, NUM_BANDS - 1, 0, 15):nextband; // always use full range. comment out this line to get the previous behaviour.
-        uint16_t nextBandHeight = audioSync->fftResults[frBand];
+        uint16_t nextBandHeight = audio.bands[frBand];
         // smooth Band height
         bandHeight = (7*bandHeight + 3*lastBandHeight + 3*nextBandHeight) / 12;   // yeees, its 12 not 13 (10% amplification)
         bandHeight = constrain(bandHeight, 0, 255);   // remove potential over/underflows
@@ -2529,7 +2557,7 @@ class GEQEffect: public Effect {
         if (colorBars) //color_vertical / color bars toggle
           colorIndex = map(pos.y, 0, leds.size.y-1, 0, 255);
 
-        ledColor = ColorFromPalette(leds.palette, (uint8_t)colorIndex);
+        ledColor = leds.colorFromPalette((uint8_t)colorIndex);
 
         leds.setPixelColor(leds.XY(pos.x, leds.size.y - 1 - pos.y), ledColor);
       }
@@ -2590,6 +2618,8 @@ class LaserGEQEffect: public Effect {
     int8_t *projector_dir = leds.effectData.readWrite<int8_t>();
     uint32_t *counter = leds.effectData.readWrite<uint32_t>();
 
+    AudioFrame audio = audioSync->frame(); //once per frame: same values for all pixels
+
     if (numBands == 0) return; //initEffect
 
     const int cols = leds.size.x;
@@ -2610,13 +2640,13 @@ class LaserGEQEffect: public Effect {
     for (int i=0; i<NUM_BANDS; i++) {
       unsigned band = i;
       if (NUM_BANDS < NUM_GEQ_CHANNELS) band = map(band, 0, NUM_BANDS - 1, 0, NUM_GEQ_CHANNELS-1); // always use full range.
-      heights[i] = map8(audioSync->fftResults[band],0,maxHeight); // cache fftResult[] as data might be updated in parallel by the audioreactive core
+      heights[i] = map8(audio.bands[band],0,maxHeight);
     }
 
 
     for (int i=0; i<=split; i++) { // paint right vertical faces and top - LEFT to RIGHT
       uint16_t colorIndex = map(cols/NUM_BANDS*i, 0, cols-1, 0, 255);
-      CRGB ledColor = ColorFromPalette(leds.palette, colorIndex);
+      CRGB ledColor = leds.colorFromPalette(colorIndex);
       int linex = i*(cols/NUM_BANDS);
 
       if (heights[i] > 1) {
@@ -2641,7 +2671,7 @@ class LaserGEQEffect: public Effect {
 
     for (int i=(NUM_BANDS - 1); i>split; i--) { // paint left vertical faces and top - RIGHT to LEFT
       uint16_t colorIndex = map(cols/NUM_BANDS*i, 0, cols-1, 0, 255);
-      CRGB ledColor = ColorFromPalette(leds.palette, colorIndex);
+      CRGB ledColor = leds.colorFromPalette(colorIndex);
       int linex = i*(cols/NUM_BANDS);
       int pPos = max(0, linex+(cols/NUM_BANDS)-1);
 
@@ -2666,7 +2696,7 @@ class LaserGEQEffect: public Effect {
 
     for (int i=0; i<NUM_BANDS; i++) {
       uint16_t colorIndex = map(cols/NUM_BANDS*i, 0, cols-1, 0, 255);
-      CRGB ledColor = ColorFromPalette(leds.palette, colorIndex);
+      CRGB ledColor = leds.colorFromPalette(colorIndex);
       int linex = i*(cols/NUM_BANDS);
       int pPos  = linex+(cols/NUM_BANDS)-1;
       int pPos1 = linex+(cols/NUM_BANDS);
@@ -2731,6 +2761,8 @@ class FunkyPlankEffect: public Effect {
     //binding of loop persistent values (pointers) tbd: aux0,1,step etc can be renamed to meaningful names
     uint8_t *aux0 = leds.effectData.readWrite<uint8_t>();
 
+    AudioFrame audio = audioSync->frame(); //once per frame: same values for all pixels
+
     uint8_t secondHand = (speed < 255) ? (micros()/(256-speed)/500 % 16) : 0;
     if ((speed > 254) || (*aux0 != secondHand)) {   // WLEDMM allow run run at full speed
       *aux0 = secondHand;
@@ -2743,7 +2775,7 @@ class FunkyPlankEffect: public Effect {
         if (remaining < 1) {band++; remaining += bandwidth;} //increase remaining but keep the current remaining
         remaining--; //consume remaining
 
-        int hue = audioSync->fftResults[map(band, 0, num_bands-1, 0, 15)];
+        int hue = audio.bands[map(band, 0, num_bands-1, 0, 15)];
         int v = map(hue, 0, 255, 10, 255);
         leds.setPixelColor(leds.XY(posx, 0), CHSV(hue, 255, v));
       }
@@ -2911,6 +2943,11 @@ class MarioTestEffect: public Effect {
   }
 }; // MarioTest
 
+//placeholder in effectTable for an effect left out by build flags, so the effectNr (saved in the model) of the next effects does not change
+class ExcludedEffect: public Effect {
+  const char * name() {return "Excluded";}
+}; // Excluded
+
 #ifdef STARBASE_USERMOD_LIVE
 
 class LiveScriptEffect: public Effect {
@@ -2919,6 +2956,7 @@ class LiveScriptEffect: public Effect {
   const char * tags() {return "💫";}
 
   void loop(LedsLayer &leds) {
+    liveM->showFrame(leds); //the frame of the script running on this layer
   }
   
   void controls(LedsLayer &leds, JsonObject parentVar) {
@@ -2935,12 +2973,13 @@ class LiveScriptEffect: public Effect {
         //set script
         uint8_t fileNr = var["value"][rowNr];
 
-        gLeds = &leds; //LEDs specific set the leds class for live script
         if (fileNr > 0) { //not None and live setup done (before )
 
           fileNr--;  //-1 as none is no file
-          files->seqNrToName(web->lastFileUpdated, fileNr, ".sc");
-          ppf("script.onChange f:%d s:%s\n", fileNr, web->lastFileUpdated);
+          char fileName[32];
+          files->seqNrToName(fileName, fileNr, ".sc");
+          liveM->runOn(fileName, &leds); //LEDs specific run the script on this layer
+          ppf("script.onChange f:%d s:%s\n", fileNr, fileName);
 
           // in LedLayer.h: void setPixelColorLive(uint16_t indexV, uint32_t color) {setPixelColor(indexV, CRGB::Black);}
           // void (LedsLayer::*sPCCached)(uint16_t, uint32_t) = &LedsLayer::setPixelColorLive;
@@ -2948,7 +2987,7 @@ class LiveScriptEffect: public Effect {
           // (leds2->*sPCCached)(0, 0);
         }
         else {
-          liveM->kill();
+          liveM->kill(&leds);
           ppf("script.onChange set to None:%d\n", fileNr);
         }
 
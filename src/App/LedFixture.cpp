@@ -14,6 +14,7 @@
 #include "../Sys/SysModFiles.h"
 #include "../Sys/SysStarJson.h"
 #include "../Sys/SysModPins.h"
+#include "../Sys/SysModNetwork.h"
 
 //load fixture json file, parse it and depending on the projection, create a mapping for it
 void Fixture::projectAndMap() {
@@ -40,6 +41,7 @@ void Fixture::projectAndMap() {
       starJson.lookFor("depth", (uint16_t *)&fixSize.z);
       starJson.lookFor("nrOfLeds", &nrOfLeds);
       starJson.lookFor("pin", &currPin);
+      starJson.lookFor("ip", currIP);
 
       //lookFor leds array and for each item in array call lambda to make a projection
       starJson.lookFor("leds", [this](std::vector<uint16_t> uint16CollectList) { //this will be called for each tuple of coordinates!
@@ -85,6 +87,8 @@ void Fixture::projectAndMapPre() {
       }
       leds->mappingTableIndexes.clear();
       leds->mappingTable.clear();
+      leds->mappingOffset = 0;
+      leds->ownSlice = false;
     }
     rowNr++;
   }
@@ -100,12 +104,21 @@ void Fixture::projectAndMapPre() {
   }
 
   indexP = 0;
+  indexF = 0;
   prevIndexP = 0;
+  strlcpy(currIP, "", sizeof(currIP));
+  strlcpy(localIP, net->localIP().toString().c_str(), sizeof(localIP));
+  groupFixture = false;
 }
 
 void Fixture::projectAndMapPixel(Coord3D pixel) {
   // ppf("led %d,%d,%d start %d,%d,%d end %d,%d,%d\n",x,y,z, startPos.x, startPos.y, startPos.z, endPos.x, endPos.y, endPos.z);
 
+  //leds of other instances (group fixture) are projected but not mapped, they have no physical led here
+  bool ownLed = currIP[0] == '\0' || strncmp(currIP, localIP, sizeof(localIP)) == 0;
+  bool groupStart = currIP[0] != '\0' && !groupFixture; //all leds before are own leds
+  if (currIP[0] != '\0') groupFixture = true;
+
   if (indexP < NUM_LEDS_Max) {
 
     // //send pixel to ui ...
@@ -120,6 +133,18 @@ void Fixture::projectAndMapPixel(Coord3D pixel) {
     uint8_t rowNr = 0;
     for (LedsLayer *leds: layers) {
 
+      //no projection: indexV is the led in the whole fixture, only a group fixture needs a mapping table to find the own leds
+      if (leds->projectionNr == p_None && leds->doMap && groupFixture) {
+        if (groupStart) { //own leds so far: indexV is indexP
+          leds->mappingOffset = 0;
+          for (uint16_t i = 0; i < indexP; i++) {
+            leds->mappingTable.push_back(PhysMap());
+            leds->mappingTable.back().addIndexP(*leds, i);
+          }
+        }
+        if (ownLed) mapOwnLed(*leds, indexF);
+      }
+
       if (leds->projectionNr != p_Random && leds->projectionNr != p_None) //only real projections
       if (leds->doMap) { //add pixel in leds mappingtable
 
@@ -137,6 +162,15 @@ void Fixture::projectAndMapPixel(Coord3D pixel) {
 
           Coord3D sizeAdjusted = (endPosAdjusted - startPosAdjusted)/10 + Coord3D{1,1,1}; // in cm
 
+          //render scale: like Grouping, but on top of any projection, so the effect renders less pixels at the same output resolution
+          if (leds->renderScale) {
+            int factor = 1 << leds->renderScale;
+            Coord3D scale = {factor, factor, factor};
+            midPosAdjusted /= scale;
+            pixelAdjusted /= scale;
+            sizeAdjusted = (sizeAdjusted + scale - Coord3D{1,1,1}) / scale; // round up
+          }
+
           // 0 to 3D depending on start and endpos (e.g. to display ScrollingText on one side of a cube)
           leds->projectionDimension = 0;
           if (sizeAdjusted.x > 1) leds->projectionDimension++;
@@ -151,8 +185,6 @@ void Fixture::projectAndMapPixel(Coord3D pixel) {
             leds->projectionNr = p_Default;
             projection = projections[leds->projectionNr];
           }
-          leds->setupCached = &Projection::setup;
-          leds->adjustXYZCached = &Projection::adjustXYZ;
 
           mdl->getValueRowNr = rowNr; //run projection functions in the right rowNr context
 
@@ -162,24 +194,15 @@ void Fixture::projectAndMapPixel(Coord3D pixel) {
           Coord3D mapped;
 
           // Setup changes leds.size, mapped, indexV
-          (projection->*leds->setupCached)(*leds, sizeAdjusted, pixelAdjusted, midPosAdjusted, mapped, indexV);
+          projection->setup(*leds, sizeAdjusted, pixelAdjusted, midPosAdjusted, mapped, indexV);
 
           leds->nrOfLeds = leds->size.x * leds->size.y * leds->size.z;
 
           if (indexV != UINT16_MAX) {
             if (indexV >= leds->nrOfLeds || indexV >= NUM_VLEDS_Max)
               ppf("dev pre [%d] indexV too high %d>=%d or %d (m:%d p:%d) p:%d,%d,%d s:%d,%d,%d\n", rowNr, indexV, leds->nrOfLeds, NUM_VLEDS_Max, leds->mappingTable.size(), indexP, pixel.x, pixel.y, pixel.z, leds->size.x, leds->size.y, leds->size.z);
-            else {
-
-              //create new physMaps if needed
-              if (indexV >= leds->mappingTable.size()) {
-                for (size_t i = leds->mappingTable.size(); i <= indexV; i++) {
-                  // ppf("mapping %d,%d,%d add physMap before %d %d\n", pixel.y, pixel.y, pixel.z, indexV, leds->mappingTable.size());
-                  leds->mappingTable.push_back(PhysMap());
-                }
-              }
-
-              leds->mappingTable[indexV].addIndexP(*leds, indexP);
+            else if (ownLed) { //leds of other instances are projected (size) but not mapped
+              mapOwnLed(*leds, indexV);
               // ppf("mapping b:%d t:%d V:%d\n", indexV, indexP, leds->mappingTable.size());
             } //indexV not too high
           } //indexV
@@ -193,10 +216,32 @@ void Fixture::projectAndMapPixel(Coord3D pixel) {
   } //indexP < max
   else 
     ppf("dev post indexP too high %d>=%d or %d p:%d,%d,%d\n", indexP, nrOfLeds, NUM_LEDS_Max, pixel.x, pixel.y, pixel.z);
-  indexP++; //also increase if no buffer created
+  if (ownLed) indexP++; //also increase if no buffer created
+  indexF++;
+}
+
+void Fixture::mapOwnLed(LedsLayer &leds, uint16_t indexV) {
+  if (leds.mappingTable.empty())
+    leds.mappingOffset = indexV;
+  else if (indexV < leds.mappingOffset) { //slice grows down
+    leds.mappingTable.insert(leds.mappingTable.begin(), leds.mappingOffset - indexV, PhysMap());
+    leds.mappingOffset = indexV;
+  }
+  uint16_t indexM = indexV - leds.mappingOffset;
+  //create new physMaps if needed (slice grows up)
+  if (indexM >= leds.mappingTable.size())
+    leds.mappingTable.resize(indexM + 1);
+  leds.mappingTable[indexM].addIndexP(leds, indexP);
 }
 
 void Fixture::projectAndMapPin(uint16_t pin) {
+  //output of another instance (group fixture)
+  if (currIP[0] != '\0' && strncmp(currIP, localIP, sizeof(localIP)) != 0) {
+    strlcpy(currIP, "", sizeof(currIP)); //next output
+    return;
+  }
+  strlcpy(currIP, "", sizeof(currIP));
+
   if (doAllocPins) {
     //check if pin already allocated, if so, extend range in details
     PinObject pinObject = pinsM->pinObjects[pin];
@@ -249,15 +294,26 @@ void Fixture::projectAndMapPost() {
         leds->nrOfLeds = nrOfLeds;
         nrOfPhysical = nrOfLeds;
 
+        //p_None: indexV is indexP if all leds are own leds, else the own slice. p_Random: random own led (random(fixture->nrOfLeds))
+        leds->ownSlice = groupFixture && leds->projectionNr == p_None;
+
       } else {
 
-        if (leds->mappingTable.size() < leds->size.x * leds->size.y * leds->size.z)
-          ppf("mapping add extra physMap %d to %d size: %d,%d,%d\n", leds->mappingTable.size(), leds->size.x * leds->size.y * leds->size.z, leds->size.x, leds->size.y, leds->size.z);
-        for (size_t i = leds->mappingTable.size(); i < leds->size.x * leds->size.y * leds->size.z; i++) {
-          leds->mappingTable.push_back(PhysMap());
+        leds->ownSlice = groupFixture;
+        //not a group fixture: all virtual leds in the table (unmapped leds keep their color for getPixelColor)
+        if (!groupFixture) {
+          if (leds->mappingOffset) {
+            leds->mappingTable.insert(leds->mappingTable.begin(), leds->mappingOffset, PhysMap());
+            leds->mappingOffset = 0;
+          }
+          if (leds->mappingTable.size() < leds->size.x * leds->size.y * leds->size.z)
+            ppf("mapping add extra physMap %d to %d size: %d,%d,%d\n", leds->mappingTable.size(), leds->size.x * leds->size.y * leds->size.z, leds->size.x, leds->size.y, leds->size.z);
+          for (size_t i = leds->mappingTable.size(); i < leds->size.x * leds->size.y * leds->size.z; i++) {
+            leds->mappingTable.push_back(PhysMap());
+          }
         }
 
-        leds->nrOfLeds = leds->mappingTable.size();
+        leds->nrOfLeds = leds->size.x * leds->size.y * leds->size.z;
 
         //debug info + summary values
         for (PhysMap &map:leds->mappingTable) {
@@ -286,6 +342,7 @@ void Fixture::projectAndMapPost() {
       }
 
       ppf("projectAndMap leds[%d] V:%d x %d x %d -> %d (v:%d - p:%d pm:%d c:%d)\n", rowNr, leds->size.x, leds->size.y, leds->size.z, leds->nrOfLeds, nrOfLogical, nrOfPhysical, nrOfPhysicalM, nrOfColor);
+      if (leds->ownSlice) ppf("projectAndMap leds[%d] own slice %d-%d\n", rowNr, leds->mappingOffset, leds->mappingOffset + leds->mappingTable.size());
 
       char buf[32];
       print->fFormat(buf, sizeof(buf), "%d x %d x %d -> %d", leds->size.x, leds->size.y, leds->size.z, leds->nrOfLeds);
@@ -298,17 +355,69 @@ void Fixture::projectAndMapPost() {
     rowNr++;
   } // leds
 
+  if (groupFixture) {
+    ppf("projectAndMap group fixture, own leds %d of %d\n", indexP, nrOfLeds);
+    nrOfLeds = indexP; //physical leds of this instance
+  }
+
   ppf("projectAndMap fixture P:%dx%dx%d -> %d\n", fixSize.x, fixSize.y, fixSize.z, nrOfLeds);
   ppf("projectAndMap fixture.size = %d + l:(%d * %d) B\n", sizeof(Fixture) - NUM_LEDS_Max * sizeof(CRGB), NUM_LEDS_Max, sizeof(CRGB)); //56
 
   mdl->setValue("fixture", "size", fixSize);
   mdl->setValue("fixture", "count", nrOfLeds);
 
+  mappingsChanged();
+
+  doMap = false;
+  ppf("projectAndMap done %d ms\n", millis()-start);
+}
+
+void Fixture::mappingsChanged() {
   //init pixelsToBlend
   for (uint16_t i=0; i<nrOfLeds; i++) {
     if (pixelsToBlend.size() < nrOfLeds)
       pixelsToBlend.push_back(false);
   }
-  doMap = false;
-  ppf("projectAndMap done %d ms\n", millis()-start);
+
+  //find layers sharing physical leds with other layers: the order of these layers matters (blending), the others can be rendered in parallel
+  std::vector<uint8_t> owners(nrOfLeds, UINT8_MAX); //rowNr of the layer using a physical led
+  auto addOwner = [this, &owners](uint16_t indexP, uint8_t rowNr) {
+    if (indexP >= owners.size()) return;
+    if (owners[indexP] == UINT8_MAX)
+      owners[indexP] = rowNr;
+    else if (owners[indexP] != rowNr) {
+      layers[owners[indexP]]->overlaps = true;
+      layers[rowNr]->overlaps = true;
+    }
+  };
+  uint8_t rowNr = 0;
+  for (LedsLayer *leds: layers) {
+    leds->overlaps = false;
+    if (leds->projectionNr == p_None || leds->projectionNr == p_Random) //no mapping, uses all leds
+      for (uint16_t indexP = 0; indexP < nrOfLeds; indexP++) addOwner(indexP, rowNr);
+    else {
+      for (PhysMap &map: leds->mappingTable)
+        if (map.mapType == m_onePixel) addOwner(map.indexP, rowNr);
+      for (std::vector<uint16_t> &mappingTableIndex: leds->mappingTableIndexes)
+        for (uint16_t indexP: mappingTableIndex) addOwner(indexP, rowNr);
+    }
+    rowNr++;
+  }
+
+  forceFrame = true;
+}
+
+uint32_t Fixture::hashLeds() {
+  const byte *data = (const byte *)ledsP;
+  size_t length = nrOfLeds * sizeof(CRGB);
+  uint32_t hash = 2166136261;
+  size_t i = 0;
+  for (; i + 4 <= length; i += 4) {
+    uint32_t word;
+    memcpy(&word, data + i, 4); //ledsP is not 4 byte aligned
+    hash = (hash ^ word) * 16777619;
+  }
+  for (; i < length; i++)
+    hash = (hash ^ data[i]) * 16777619;
+  return hash;
 }
\ No newline at end of file
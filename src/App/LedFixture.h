@@ -37,6 +37,24 @@ public:
 
 };
 
+//view on a const table of pointers (e.g. effectTable), usable as a vector of pointers
+template <class T>
+class StaticTable {
+public:
+  StaticTable() {}
+  template <size_t N>
+  StaticTable(T * const (&table)[N]): items(table), count(N) {}
+
+  size_t size() const {return count;}
+  T * operator[](size_t index) const {return items[index];}
+  T * const * begin() const {return items;}
+  T * const * end() const {return items + count;}
+
+private:
+  T * const * items = nullptr;
+  size_t count = 0;
+};
+
 class Fixture {
 
 public:
@@ -53,7 +71,7 @@ public:
   // leds = (CRGB*)malloc(nrOfLeds * sizeof(CRGB));
   // leds = (CRGB*)reallocarray
 
-  std::vector<Projection *> projections;
+  StaticTable<Projection> projections; //set by LedModEffects
 
   uint16_t nrOfLeds = 64; //amount of physical leds
   uint8_t fixtureNr = -1;
@@ -68,6 +86,15 @@ public:
 
   uint8_t globalBlend = 128;
 
+  //dirty tracking: if no layer changed ledsP, driver show, network and preview can skip the frame
+  bool frameChanged = true; //set each frame by LedModEffects
+  bool forceFrame = true; //next frame counts as changed, e.g. after mapping or brightness change
+  uint32_t frameHash = 0; //hash of ledsP of the last frame
+  unsigned long frameChangedMillis = 0;
+
+  //cheap FNV-1a hash over the physical leds, 4 bytes at a time
+  uint32_t hashLeds();
+
   Fixture() {
     //init pixelsToBlend
     for (uint16_t i=0; i<nrOfLeds; i++) {
@@ -80,8 +107,15 @@ public:
   //temporary here  
   unsigned long start = millis();
   uint16_t indexP = 0;
+  uint16_t indexF = 0; //led in the whole fixture, also leds of other instances: indexV of layers without projection
   uint16_t prevIndexP = 0;
   uint16_t currPin; //lookFor needs u16
+  //group fixture: leds of all instances in one fixture file, each output has the "ip" of its instance (before "leds")
+  //  all instances project the whole fixture, so layers have the same size and effects are continuous over instances
+  //  but only virtual leds of own leds are mapped (the own slice of a layer, see mappingOffset)
+  char currIP[32] = ""; //lookFor needs 32, empty: own output
+  char localIP[16] = "";
+  bool groupFixture = false;
 
   //load fixture json file, parse it and depending on the projection, create a mapping for it
   void projectAndMap();
@@ -89,6 +123,10 @@ public:
   void projectAndMapPixel(Coord3D pixel);
   void projectAndMapPin(uint16_t pin);
   void projectAndMapPost();
+  //add the current own led (indexP) to virtual led indexV of leds, the mapping table grows to the own slice only
+  void mapOwnLed(LedsLayer &leds, uint16_t indexV);
+  //after the mapping of layers changed (projectAndMapPost or a cached mapping): pixelsToBlend, overlaps and forceFrame
+  void mappingsChanged();
 
   #ifdef STARLIGHT_CLOCKLESS_LED_DRIVER
     uint8_t setMaxPowerBrightness = 30; //tbd: implement driver.setMaxPowerInMilliWatts
@@ -29,6 +29,7 @@ void fastled_fill_rainbow(struct CRGB * targetArray, int numToFill, uint8_t init
 void LedsLayer::triggerMapping() {
     doMap = true; //specify which leds to remap
     fixture->doMap = true; //fixture will also be remapped
+    endTransition(); //the physical leds of the layer change
   }
 
 uint16_t LedsLayer::XYZ(Coord3D pixel) {
@@ -40,37 +41,39 @@ uint16_t LedsLayer::XYZ(Coord3D pixel) {
     // fixture->projections[projectionNr]->adjustXYZ(*this, pixel);
 
 
-  //using cached virtual class methods! (so no need for if projectionNr optimizations!)
+  //projections is a const table, so one virtual call (no need for if projectionNr optimizations!)
   if (projectionNr < fixture->projections.size())
-    (fixture->projections[projectionNr]->*adjustXYZCached)(*this, pixel);
+    fixture->projections[projectionNr]->adjustXYZ(*this, pixel);
 
   return XYZUnprojected(pixel);
 }
 
 // maps the virtual led to the physical led(s) and assign a color to it
 void LedsLayer::setPixelColor(uint16_t indexV, CRGB color) {
-  if (indexV < mappingTable.size()) {
-    switch (mappingTable[indexV].mapType) {
+  uint16_t indexM = indexV - mappingOffset; //index in the mapping table, below the offset wraps around
+  if (indexM < mappingTable.size()) {
+    switch (mappingTable[indexM].mapType) {
       case m_color:{
-        mappingTable[indexV].rgb14 = ((min(color.r + 3, 255) >> 3) << 9) + 
+        mappingTable[indexM].rgb14 = ((min(color.r + 3, 255) >> 3) << 9) + 
                                      ((min(color.g + 3, 255) >> 3) << 4) + 
                                       (min(color.b + 7, 255) >> 4);
         break;
       }
       case m_onePixel: {
-        uint16_t indexP = mappingTable[indexV].indexP;
+        uint16_t indexP = mappingTable[indexM].indexP;
         fixture->ledsP[indexP] = fixture->pixelsToBlend[indexP]?blend(color, fixture->ledsP[indexP], fixture->globalBlend):color;
         break; }
       case m_morePixels:
-        if (mappingTable[indexV].indexes < mappingTableIndexes.size())
-          for (uint16_t indexP: mappingTableIndexes[mappingTable[indexV].indexes]) {
+        if (mappingTable[indexM].indexes < mappingTableIndexes.size())
+          for (uint16_t indexP: mappingTableIndexes[mappingTable[indexM].indexes]) {
             fixture->ledsP[indexP] = fixture->pixelsToBlend[indexP]?blend(color, fixture->ledsP[indexP], fixture->globalBlend): color;
           }
         // else
-        //   ppf("dev setPixelColor2 i:%d m:%d s:%d\n", indexV, mappingTable[indexV].indexes, mappingTableIndexes.size());
+        //   ppf("dev setPixelColor2 i:%d m:%d s:%d\n", indexV, mappingTable[indexM].indexes, mappingTableIndexes.size());
         break;
     }
   }
+  else if (ownSlice) {} //led of another instance
   else if (indexV < NUM_LEDS_Max) { //no projection
     uint16_t indexP = (projectionNr == p_Random)?random(fixture->nrOfLeds):indexV;
     fixture->ledsP[indexP] = fixture->pixelsToBlend[indexP]?blend(color, fixture->ledsP[indexP], fixture->globalBlend): color;
@@ -80,7 +83,12 @@ void LedsLayer::setPixelColor(uint16_t indexV, CRGB color) {
 }
 
 void LedsLayer::setPixelColorPal(uint16_t indexV, uint8_t palIndex, uint8_t palBri) {
-  setPixelColor(indexV, ColorFromPalette(palette, palIndex, palBri));
+  setPixelColor(indexV, colorFromPalette(palIndex, palBri));
+}
+
+void LedsLayer::expandPalette() {
+  for (int i = 0; i < 256; i++)
+    paletteLUT[i] = ColorFromPalette(palette, i, 255, LINEARBLEND);
 }
 
 void LedsLayer::blendPixelColor(uint16_t indexV, CRGB color, uint8_t blendAmount) {
@@ -88,21 +96,24 @@ void LedsLayer::blendPixelColor(uint16_t indexV, CRGB color, uint8_t blendAmount
 }
 
 CRGB LedsLayer::getPixelColor(uint16_t indexV) {
-  if (indexV < mappingTable.size()) {
-    switch (mappingTable[indexV].mapType) {
+  uint16_t indexM = indexV - mappingOffset;
+  if (indexM < mappingTable.size()) {
+    switch (mappingTable[indexM].mapType) {
       case m_onePixel:
-        return fixture->ledsP[mappingTable[indexV].indexP]; 
+        return fixture->ledsP[mappingTable[indexM].indexP]; 
         break;
       case m_morePixels:
-        return fixture->ledsP[mappingTableIndexes[mappingTable[indexV].indexes][0]]; //any would do as they are all the same
+        return fixture->ledsP[mappingTableIndexes[mappingTable[indexM].indexes][0]]; //any would do as they are all the same
         break;
       default: // m_color:
-        return CRGB((mappingTable[indexV].rgb14 >> 9) << 3, 
-                    (mappingTable[indexV].rgb14 >> 4) << 3, 
-                     mappingTable[indexV].rgb14       << 4);
+        return CRGB((mappingTable[indexM].rgb14 >> 9) << 3, 
+                    (mappingTable[indexM].rgb14 >> 4) << 3, 
+                     mappingTable[indexM].rgb14       << 4);
         break;
     }
   }
+  else if (ownSlice) //led of another instance
+    return CRGB::Black;
   else if (indexV < NUM_LEDS_Max) //no mapping
     return fixture->ledsP[indexV];
   else {
@@ -111,14 +122,35 @@ CRGB LedsLayer::getPixelColor(uint16_t indexV) {
   }
 }
 
+//scale a physical led, blending as setPixelColor does
+static void fadePhysical(Fixture *fixture, uint16_t indexP, uint8_t scale) {
+  CRGB color = fixture->ledsP[indexP];
+  color.nscale8(scale);
+  fixture->ledsP[indexP] = fixture->pixelsToBlend[indexP]?blend(color, fixture->ledsP[indexP], fixture->globalBlend): color;
+}
+
 void LedsLayer::fadeToBlackBy(uint8_t fadeBy) {
   if (projectionNr == p_None || projectionNr == p_Random || (fixture->layers.size() == 1)) {
     fastled_fadeToBlackBy(fixture->ledsP, fixture->nrOfLeds, fadeBy);
   } else {
+    //walk the mapping table once and scale the physical leds directly instead of a get/setPixelColor roundtrip per virtual led
+    uint8_t scale = 255 - fadeBy;
     for (uint16_t index = 0; index < mappingTable.size(); index++) {
-      CRGB color = getPixelColor(index);
-      color.nscale8(255-fadeBy);
-      setPixelColor(index, color);
+      switch (mappingTable[index].mapType) {
+        case m_onePixel:
+          fadePhysical(fixture, mappingTable[index].indexP, scale);
+          break;
+        case m_morePixels:
+          if (mappingTable[index].indexes < mappingTableIndexes.size())
+            for (uint16_t indexP: mappingTableIndexes[mappingTable[index].indexes])
+              fadePhysical(fixture, indexP, scale);
+          break;
+        default: { // m_color:
+          CRGB color = getPixelColor(index + mappingOffset);
+          color.nscale8(scale);
+          setPixelColor(index + mappingOffset, color);
+          break; }
+      }
     }
   }
 }
@@ -128,7 +160,7 @@ void LedsLayer::fill_solid(const struct CRGB& color) {
     fastled_fill_solid(fixture->ledsP, fixture->nrOfLeds, color);
   } else {
     for (uint16_t index = 0; index < mappingTable.size(); index++)
-      setPixelColor(index, color);
+      setPixelColor(index + mappingOffset, color);
   }
 }
 
@@ -137,17 +169,132 @@ void LedsLayer::fill_rainbow(uint8_t initialhue, uint8_t deltahue) {
     fastled_fill_rainbow(fixture->ledsP, fixture->nrOfLeds, initialhue, deltahue);
   } else {
     CHSV hsv;
-    hsv.hue = initialhue;
+    hsv.hue = initialhue + mappingOffset * deltahue; //continues over the slices of a group fixture
     hsv.val = 255;
     hsv.sat = 240;
 
     for (uint16_t index = 0; index < mappingTable.size(); index++) {
-      setPixelColor(index, hsv);
+      setPixelColor(index + mappingOffset, hsv);
       hsv.hue += deltahue;
     }
   }
 }
 
+//blur kernel on contiguous bytes: out = cur * keep + (prev + next) * seep, saturated (same result as the carryover loop)
+//  prev and next are nullptr at the edges. Plain byte loop without CRGB operators or mapping, so the compiler can unroll / vectorize it
+static void blurKernel(uint8_t * __restrict out, const uint8_t *cur, const uint8_t *prev, const uint8_t *next, size_t len, uint8_t keep, uint8_t seep) {
+  for (size_t i = 0; i < len; i++) {
+    uint16_t value = scale8(cur[i], keep);
+    if (prev) value += scale8(prev[i], seep);
+    if (next) value += scale8(next[i], seep);
+    out[i] = value > 255 ? 255 : value;
+  }
+}
+
+//blur one row of width leds: neighbours are 3 bytes (1 CRGB) apart
+static void blurRow(CRGB *out, const CRGB *in, uint16_t width, uint8_t keep, uint8_t seep) {
+  uint8_t *o = (uint8_t *)out;
+  const uint8_t *i = (const uint8_t *)in;
+  if (width == 1) {
+    blurKernel(o, i, nullptr, nullptr, 3, keep, seep);
+    return;
+  }
+  blurKernel(o, i, nullptr, i + 3, 3, keep, seep); //first led
+  blurKernel(o + 3, i + 3, i, i + 6, 3 * (width - 2), keep, seep);
+  blurKernel(o + 3 * (width - 1), i + 3 * (width - 1), i + 3 * (width - 2), nullptr, 3, keep, seep); //last led
+}
+
+void LedsLayer::readPixels(uint16_t indexV, uint16_t count, CRGB *buffer) {
+  if (projectionNr == p_None && mappingTable.empty() && !ownSlice && indexV + count <= NUM_LEDS_Max)
+    memcpy(buffer, fixture->ledsP + indexV, count * sizeof(CRGB));
+  else
+    for (uint16_t i = 0; i < count; i++)
+      buffer[i] = getPixelColor(indexV + i);
+}
+
+void LedsLayer::writePixels(uint16_t indexV, uint16_t count, const CRGB *buffer) {
+  //memcpy only if no other layer: setPixelColor blends with the layers below (pixelsToBlend)
+  if (projectionNr == p_None && mappingTable.empty() && !ownSlice && fixture->layers.size() == 1 && indexV + count <= NUM_LEDS_Max)
+    memcpy(fixture->ledsP + indexV, buffer, count * sizeof(CRGB));
+  else
+    for (uint16_t i = 0; i < count; i++)
+      setPixelColor(indexV + i, buffer[i]);
+}
+
+//blur functions work on whole rows of virtual leds (indexV, no adjustXYZ): one read and one write per led instead of a mapping roundtrip per get/set/add
+void LedsLayer::blur1d(fract8 blur_amount) {
+  if (nrOfLeds == 0) return;
+  if (blurBuffer.size() < 2 * nrOfLeds) blurBuffer.resize(2 * nrOfLeds);
+  CRGB *in = blurBuffer.data();
+  CRGB *out = in + nrOfLeds;
+
+  readPixels(0, nrOfLeds, in);
+  blurRow(out, in, nrOfLeds, 255 - blur_amount, blur_amount >> 1);
+  writePixels(0, nrOfLeds, out);
+}
+
+void LedsLayer::blurRows(uint16_t width, uint16_t height, fract8 blur_amount) {
+  width = min<int>(width, size.x);
+  height = min<int>(height, size.y);
+  if (width == 0 || height == 0) return;
+  if (blurBuffer.size() < 2 * width) blurBuffer.resize(2 * width);
+  CRGB *in = blurBuffer.data();
+  CRGB *out = in + width;
+
+  uint8_t keep = 255 - blur_amount;
+  uint8_t seep = blur_amount >> 1;
+  for (uint16_t row = 0; row < height; row++) {
+    readPixels(row * size.x, width, in);
+    blurRow(out, in, width, keep, seep);
+    writePixels(row * size.x, width, out);
+  }
+}
+
+void LedsLayer::blurColumns(uint16_t width, uint16_t height, fract8 blur_amount) {
+  width = min<int>(width, size.x);
+  height = min<int>(height, size.y);
+  if (width == 0 || height == 0) return;
+  if (blurBuffer.size() < 4 * width) blurBuffer.resize(4 * width);
+  //all columns are blurred at once: each row is combined with the unblurred row above and below
+  CRGB *prev = blurBuffer.data();
+  CRGB *cur = prev + width;
+  CRGB *next = cur + width;
+  CRGB *out = next + width;
+
+  uint8_t keep = 255 - blur_amount;
+  uint8_t seep = blur_amount >> 1;
+  readPixels(0, width, cur);
+  for (uint16_t row = 0; row < height; row++) {
+    bool last = row == height - 1;
+    if (!last) readPixels((row + 1) * size.x, width, next); //read before row is written
+    blurKernel((uint8_t *)out, (uint8_t *)cur, row?(uint8_t *)prev:nullptr, last?nullptr:(uint8_t *)next, 3 * width, keep, seep);
+    writePixels(row * size.x, width, out);
+    std::swap(prev, cur); //cur becomes prev
+    std::swap(cur, next); //next becomes cur, old prev is reused for next
+  }
+}
+
+void blurBuffer2d(CRGB *leds, uint16_t width, uint16_t height, fract8 blur_amount, std::vector<CRGB> &scratch) {
+  if (width == 0 || height == 0) return;
+  if (scratch.size() < 2 * width) scratch.resize(2 * width);
+  CRGB *row = scratch.data();
+  CRGB *prev = row + width;
+
+  uint8_t keep = 255 - blur_amount;
+  uint8_t seep = blur_amount >> 1;
+  for (uint16_t y = 0; y < height; y++) {
+    memcpy(row, leds + y * width, width * sizeof(CRGB));
+    blurRow(leds + y * width, row, width, keep, seep);
+  }
+  //columns: each row with the unblurred row above (prev) and below (not written yet)
+  for (uint16_t y = 0; y < height; y++) {
+    CRGB *cur = leds + y * width;
+    memcpy(row, cur, width * sizeof(CRGB));
+    blurKernel((uint8_t *)cur, (uint8_t *)row, y?(uint8_t *)prev:nullptr, (y < height - 1)?(uint8_t *)(cur + width):nullptr, 3 * width, keep, seep);
+    std::swap(row, prev); //the unblurred row becomes prev
+  }
+}
+
 void PhysMap::addIndexP(LedsLayer &leds, uint16_t indexP) {
   // ppf("addIndexP i:%d t:%d", indexP, mapType);
   switch (mapType) {
@@ -199,6 +199,32 @@ class SharedData {
     return *result;
   }
 
+  //exchange the data with other, e.g. to keep the data of the outgoing effect during a transition
+  void swap(SharedData &other) {
+    std::swap(data, other.data);
+    std::swap(index, other.index);
+    std::swap(bytesAllocated, other.bytesAllocated);
+    std::swap(alertIfChanged, other.alertIfChanged);
+  }
+
+};
+
+enum TransitionCurve {
+  t_linear,
+  t_wipe,
+  t_dissolve
+};
+
+//outgoing effect of a layer, rendered together with the incoming effect until the transition is done (see LedModEffects::runTransition)
+struct Transition {
+  uint16_t effectNr = UINT16_MAX; //outgoing effect
+  SharedData effectData; //of the outgoing effect
+  uint32_t startMillis = 0;
+  uint16_t durationMillis = 0;
+  uint8_t curve = t_linear;
+  std::vector<uint16_t> indexes; //physical leds of the layer
+  std::vector<CRGB> outgoing; //last frame of each effect, restored before rendering it, as effects can build on the previous frame
+  std::vector<CRGB> incoming;
 };
 
 enum mapType {
@@ -230,7 +256,10 @@ struct PhysMap {
 
 }; // 2 bytes
 
-class Projection; //forward for cached virtual class methods!
+class Projection; //forward
+
+//blur a contiguous buffer of width x height leds (no mapping), e.g. the framebuffer of a live script
+void blurBuffer2d(CRGB *leds, uint16_t width, uint16_t height, fract8 blur_amount, std::vector<CRGB> &scratch);
 
 class LedsLayer {
 
@@ -245,15 +274,12 @@ public:
   uint16_t effectNr = UINT16_MAX;
   uint8_t projectionNr = UINT8_MAX;
 
-  //using cached virtual class methods! 4 bytes each - thats for now the price we pay for speed
-  void (Projection::*setupCached)(LedsLayer &, Coord3D &, Coord3D &, Coord3D &, Coord3D &, uint16_t &) = nullptr;
-  void (Projection::*adjustXYZCached)(LedsLayer &, Coord3D &) = nullptr;
-
   uint8_t effectDimension = -1;
   uint8_t projectionDimension = -1;
 
   Coord3D startPos = {0,0,0}, endPos = {UINT16_MAX,UINT16_MAX,UINT16_MAX}; //default
   Coord3D midPos = {0,0,0};
+  uint8_t renderScale = 0; //effect runs on size >> renderScale, physical leds are mapped to the downscaled pixels (0: 1:1, 1: 1:2, 2: 1:4)
   #ifdef STARBASE_USERMOD_MPU6050
     bool proGyro = false;
   #endif
@@ -266,12 +292,26 @@ public:
 
   std::vector<PhysMap> mappingTable;
   std::vector<std::vector<uint16_t>> mappingTableIndexes;
+  //group fixture: only virtual leds of own leds are mapped (the own slice), mappingTable[0] is indexV mappingOffset
+  //  virtual leds outside the slice have no own led: they are dropped (ownSlice), so table walks (fade, fill) skip other instances
+  uint16_t mappingOffset = 0;
+  bool ownSlice = false;
 
   uint16_t indexVLocal = 0; //set in operator[], used by operator=
 
   bool doMap = true; //so a mapping will be made
 
+  bool unchanged = false; //set by an effect if it did not change the leds this frame, reset before each effect loop
+  bool overlaps = true; //shares physical leds with other layers (set after mapping), if not the layer can be rendered in parallel
+  unsigned long renderMicros = 0; //moving average of the effect loop time, used to balance the layers over the cores
+  uint8_t renderEvery = 1; //over the time budget: the effect runs every renderEvery frames, the leds keep the last frame in between
+
   CRGBPalette16 palette;
+  CRGB paletteLUT[256]; //palette expanded to 256 blended entries, rebuilt by expandPalette when the palette changes
+
+  std::vector<CRGB> blurBuffer; //scratch rows for the blur kernels, grows to the widest row blurred
+  Transition *transition = nullptr; //only during a transition
+
 
   uint16_t XY(uint16_t x, uint16_t y) {
     return XYZ(x, y, 0);
@@ -293,6 +333,7 @@ public:
   LedsLayer(Fixture &fixture) {
     ppf("LedsLayer constructor (PhysMap:%d)\n", sizeof(PhysMap));
     this->fixture = &fixture;
+    expandPalette();
   }
 
   ~LedsLayer() {
@@ -304,10 +345,21 @@ public:
     }
     mappingTableIndexes.clear();
     mappingTable.clear();
+    mappingOffset = 0;
+    ownSlice = false;
+    endTransition();
   }
 
   void triggerMapping();
 
+  //cut: the outgoing effect stops
+  void endTransition() {
+    if (transition) {
+      delete transition;
+      transition = nullptr;
+    }
+  }
+
   // indexVLocal stored to be used by other operators
   LedsLayer& operator[](uint16_t indexV) {
     indexVLocal = indexV;
@@ -355,6 +407,27 @@ public:
   void setPixelColorPal(uint16_t indexV, uint8_t palIndex, uint8_t palBri = 255);
   void setPixelColorPal(Coord3D pixel, uint8_t palIndex, uint8_t palBri = 255) {setPixelColorPal(XYZ(pixel), palIndex, palBri);}
 
+  //call after palette is changed
+  void expandPalette();
+  //same result as ColorFromPalette(palette, index, bri) (LINEARBLEND) but a table lookup
+  CRGB colorFromPalette(uint8_t index, uint8_t bri = 255) {
+    CRGB color = paletteLUT[index];
+    if (bri == 255) return color;
+    if (bri == 0) return CRGB::Black;
+    //brightness scaling as in FastLED ColorFromPalette
+    bri++;
+    #if FASTLED_SCALE8_FIXED == 1
+      color.r = scale8(color.r, bri);
+      color.g = scale8(color.g, bri);
+      color.b = scale8(color.b, bri);
+    #else
+      if (color.r) color.r = scale8(color.r, bri) + 1;
+      if (color.g) color.g = scale8(color.g, bri) + 1;
+      if (color.b) color.b = scale8(color.b, bri) + 1;
+    #endif
+    return color;
+  }
+
   void blendPixelColor(uint16_t indexV, CRGB color, uint8_t blendAmount);
   void blendPixelColor(Coord3D pixel, CRGB color, uint8_t blendAmount) {blendPixelColor(XYZ(pixel), color, blendAmount);}
 
@@ -436,25 +509,11 @@ public:
 
   //checks if a virtual pixel is mapped to a physical pixel (use with XY() or XYZ() to get the indexV)
   bool isMapped(uint16_t indexV) {
-    return indexV < mappingTable.size() && (mappingTable[indexV].mapType == m_onePixel || mappingTable[indexV].mapType == m_morePixels);
+    uint16_t indexM = indexV - mappingOffset; //below the offset wraps around
+    return indexM < mappingTable.size() && (mappingTable[indexM].mapType == m_onePixel || mappingTable[indexM].mapType == m_morePixels);
   }
 
-  void blur1d(fract8 blur_amount)
-  {
-    uint8_t keep = 255 - blur_amount;
-    uint8_t seep = blur_amount >> 1;
-    CRGB carryover = CRGB::Black;
-    for( uint16_t i = 0; i < nrOfLeds; ++i) {
-        CRGB cur = getPixelColor(i);
-        CRGB part = cur;
-        part.nscale8( seep);
-        cur.nscale8( keep);
-        cur += carryover;
-        if( i) addPixelColor(i-1, part);
-        setPixelColor(i, cur);
-        carryover = part;
-    }
-  }
+  void blur1d(fract8 blur_amount);
 
   void blur2d(fract8 blur_amount)
   {
@@ -462,51 +521,14 @@ public:
       blurColumns(size.x, size.y, blur_amount);
   }
 
-  void blurRows(uint16_t width, uint16_t height, fract8 blur_amount)
-  {
-  /*    for (uint16_t row = 0; row < height; row++) {
-          CRGB* rowbase = leds + (row * width);
-          blur1d( rowbase, width, blur_amount);
-      }
-  */
-      // blur rows same as columns, for irregular matrix
-      uint8_t keep = 255 - blur_amount;
-      uint8_t seep = blur_amount >> 1;
-      for (uint16_t row = 0; row < height; row++) {
-          CRGB carryover = CRGB::Black;
-          for (uint16_t i = 0; i < width; i++) {
-              CRGB cur = getPixelColor(XY(i,row));
-              CRGB part = cur;
-              part.nscale8( seep);
-              cur.nscale8( keep);
-              cur += carryover;
-              if( i) addPixelColor(XY(i-1,row), part);
-              setPixelColor(XY(i,row), cur);
-              carryover = part;
-          }
-      }
-  }
-
+  // blur rows same as columns, for irregular matrix
+  void blurRows(uint16_t width, uint16_t height, fract8 blur_amount);
   // blurColumns: perform a blur1d on each column of a rectangular matrix
-  void blurColumns(uint16_t width, uint16_t height, fract8 blur_amount)
-  {
-      // blur columns
-      uint8_t keep = 255 - blur_amount;
-      uint8_t seep = blur_amount >> 1;
-      for (uint16_t col = 0; col < width; ++col) {
-          CRGB carryover = CRGB::Black;
-          for (uint16_t i = 0; i < height; ++i) {
-              CRGB cur = getPixelColor(XY(col,i));
-              CRGB part = cur;
-              part.nscale8( seep);
-              cur.nscale8( keep);
-              cur += carryover;
-              if( i) addPixelColor(XY(col,i-1), part);
-              setPixelColor(XY(col,i), cur);
-              carryover = part;
-          }
-      }
-  }
+  void blurColumns(uint16_t width, uint16_t height, fract8 blur_amount);
+
+  // copy a run of virtual leds from / to a contiguous buffer, memcpy if the layer is not projected (write: and the only layer)
+  void readPixels(uint16_t indexV, uint16_t count, CRGB *buffer);
+  void writePixels(uint16_t indexV, uint16_t count, const CRGB *buffer);
 
   //shift is used by drawText indicating which letter it is drawing
   void drawCharacter(unsigned char chr, int x = 0, int16_t y = 0, uint8_t font = 0, CRGB col = CRGB::Red, uint16_t shiftPixel = 0, uint16_t shiftChr = 0) {
@@ -36,6 +36,111 @@ inline uint16_t getRGBWsize(uint16_t nleds){
 //https://github.com/FastLED/FastLED/blob/master/examples/DemoReel100/DemoReel100.ino
 //https://blog.ja-ke.tech/2019/06/02/neopixel-performance.html
 
+//one object per effect and projection, created at compile time instead of new() at boot
+template <class T>
+struct StaticInstance {
+  static T instance;
+};
+template <class T>
+T StaticInstance<T>::instance;
+
+//effects and projections available in this build, the tables are const so stored in flash
+//  an effect which is not in the table is not linked, leave out effects by build flags (e.g. STARLIGHT_EXCLUDE_TEST_EFFECTS)
+//  the order is the effectNr / projectionNr as saved in the model, so add new ones at the end of a group and use ExcludedEffect for left out ones
+static Effect * const effectTable[] = {
+  //1D Basis
+  &StaticInstance<SolidEffect>::instance,
+  // 1D FastLed
+  &StaticInstance<BPMEffect>::instance,
+  &StaticInstance<ConfettiEffect>::instance,
+  &StaticInstance<JuggleEffect>::instance,
+  &StaticInstance<RainbowWithGlitterEffect>::instance,
+  &StaticInstance<SinelonEffect>::instance,
+  //1D StarLight
+  &StaticInstance<RingRandomFlowEffect>::instance,
+  &StaticInstance<RunningEffect>::instance,
+  // 1D WLED
+  &StaticInstance<BouncingBallsEffect>::instance,
+  &StaticInstance<DripEffect>::instance,
+  &StaticInstance<FlowEffect>::instance,
+  &StaticInstance<HeartBeatEffect>::instance,
+  &StaticInstance<PopCornEffect>::instance, //contains wledaudio: useaudio, conditional compile
+  &StaticInstance<RainEffect>::instance,
+  &StaticInstance<RainbowEffect>::instance,
+
+  #ifdef STARLIGHT_USERMOD_AUDIOSYNC
+    //1D Volume
+    &StaticInstance<FreqMatrixEffect>::instance,
+    &StaticInstance<NoiseMeterEffect>::instance,
+    //1D frequency
+    &StaticInstance<AudioRingsEffect>::instance,
+    &StaticInstance<DJLightEffect>::instance,
+  #endif
+
+  //2D StarLight
+  &StaticInstance<GameOfLifeEffect>::instance, //2D & 3D
+  &StaticInstance<LinesEffect>::instance,
+  #ifndef STARLIGHT_EXCLUDE_TEST_EFFECTS
+    &StaticInstance<ParticleTestEffect>::instance, //2D & 3D
+  #else
+    &StaticInstance<ExcludedEffect>::instance,
+  #endif
+  &StaticInstance<StarFieldEffect>::instance,
+  &StaticInstance<PraxisEffect>::instance,
+  
+  //2D WLED
+  &StaticInstance<BlackHoleEffect>::instance,
+  &StaticInstance<DNAEffect>::instance,
+  &StaticInstance<DistortionWavesEffect>::instance,
+  &StaticInstance<FrizzlesEffect>::instance,
+  &StaticInstance<LissajousEffect>::instance,
+  &StaticInstance<Noise2DEffect>::instance,
+  &StaticInstance<OctopusEffect>::instance,
+  &StaticInstance<ScrollingTextEffect>::instance,
+  #ifdef STARLIGHT_USERMOD_AUDIOSYNC
+    //2D WLED
+    &StaticInstance<FunkyPlankEffect>::instance,
+    &StaticInstance<GEQEffect>::instance,
+    &StaticInstance<LaserGEQEffect>::instance,
+    &StaticInstance<WaverlyEffect>::instance,
+  #endif
+  //3D
+  &StaticInstance<RipplesEffect>::instance,
+  &StaticInstance<RubiksCubeEffect>::instance,
+  &StaticInstance<SphereMoveEffect>::instance,
+  &StaticInstance<PixelMapEffect>::instance,
+  #ifndef STARLIGHT_EXCLUDE_TEST_EFFECTS
+    &StaticInstance<MarioTestEffect>::instance,
+  #else
+    &StaticInstance<ExcludedEffect>::instance,
+  #endif
+
+  #ifdef STARBASE_USERMOD_LIVE
+    &StaticInstance<LiveScriptEffect>::instance,
+  #endif
+};
+
+static Projection * const projectionTable[] = {
+  &StaticInstance<NoneProjection>::instance,
+  &StaticInstance<DefaultProjection>::instance,
+  &StaticInstance<PinwheelProjection>::instance,
+  &StaticInstance<MultiplyProjection>::instance,
+  &StaticInstance<TiltPanRollProjection>::instance,
+  &StaticInstance<DistanceFromPointProjection>::instance,
+  &StaticInstance<Preset1Projection>::instance,
+  &StaticInstance<RandomProjection>::instance,
+  &StaticInstance<ReverseProjection>::instance,
+  &StaticInstance<MirrorProjection>::instance,
+  &StaticInstance<GroupingProjection>::instance,
+  &StaticInstance<SpacingProjection>::instance,
+  &StaticInstance<TransposeProjection>::instance,
+  // &StaticInstance<KaleidoscopeProjection>::instance,
+  &StaticInstance<ScrollingProjection>::instance,
+  &StaticInstance<AccelerationProjection>::instance,
+  &StaticInstance<CheckerboardProjection>::instance,
+  &StaticInstance<RotateProjection>::instance,
+};
+
 class LedModEffects:public SysModule {
 
 public:
@@ -45,11 +150,14 @@ public:
   uint16_t fps = 60;
   unsigned long lastMappingMillis = 0;
 
-  std::vector<Effect *> effects;
+  StaticTable<Effect> effects = effectTable;
 
   Fixture fixture = Fixture();
 
   bool driverShow = true;
+  bool parallel = false; //render layers which do not overlap other layers on the other core
+  uint16_t transitionMillis = 0; //0: cut
+  uint8_t transitionCurve = t_linear;
 
   uint8_t doInitEffectRowNr = UINT8_MAX;
 
@@ -63,90 +171,7 @@ public:
 
   LedModEffects() :SysModule("Effects") {
 
-    //load effects
-
-    //1D Basis
-    effects.push_back(new SolidEffect);
-    // 1D FastLed
-    effects.push_back(new BPMEffect);
-    effects.push_back(new ConfettiEffect);
-    effects.push_back(new JuggleEffect);
-    effects.push_back(new RainbowWithGlitterEffect);
-    effects.push_back(new SinelonEffect);
-    //1D StarLight
-    effects.push_back(new RingRandomFlowEffect);
-    effects.push_back(new RunningEffect);
-    // 1D WLED
-    effects.push_back(new BouncingBallsEffect);
-    effects.push_back(new DripEffect);
-    effects.push_back(new FlowEffect);
-    effects.push_back(new HeartBeatEffect);
-    effects.push_back(new PopCornEffect); //contains wledaudio: useaudio, conditional compile
-    effects.push_back(new RainEffect);
-    effects.push_back(new RainbowEffect);
-
-    #ifdef STARLIGHT_USERMOD_AUDIOSYNC
-      //1D Volume
-      effects.push_back(new FreqMatrixEffect);
-      effects.push_back(new NoiseMeterEffect);
-      //1D frequency
-      effects.push_back(new AudioRingsEffect);
-      effects.push_back(new DJLightEffect);
-    #endif
-
-    //2D StarLight
-    effects.push_back(new GameOfLifeEffect); //2D & 3D
-    effects.push_back(new LinesEffect);
-    effects.push_back(new ParticleTestEffect); //2D & 3D
-    effects.push_back(new StarFieldEffect);
-    effects.push_back(new PraxisEffect);
-    
-    //2D WLED
-    effects.push_back(new BlackHoleEffect);
-    effects.push_back(new DNAEffect);
-    effects.push_back(new DistortionWavesEffect);
-    effects.push_back(new FrizzlesEffect);
-    effects.push_back(new LissajousEffect);
-    effects.push_back(new Noise2DEffect);
-    effects.push_back(new OctopusEffect);
-    effects.push_back(new ScrollingTextEffect);
-    #ifdef STARLIGHT_USERMOD_AUDIOSYNC
-      //2D WLED
-      effects.push_back(new FunkyPlankEffect);
-      effects.push_back(new GEQEffect);
-      effects.push_back(new LaserGEQEffect);
-      effects.push_back(new WaverlyEffect);
-    #endif
-    //3D
-    effects.push_back(new RipplesEffect);
-    effects.push_back(new RubiksCubeEffect);
-    effects.push_back(new SphereMoveEffect);
-    effects.push_back(new PixelMapEffect);
-    effects.push_back(new MarioTestEffect);
-
-    #ifdef STARBASE_USERMOD_LIVE
-      effects.push_back(new LiveScriptEffect);
-    #endif
-
-    //load projections
-    fixture.projections.push_back(new NoneProjection);
-    fixture.projections.push_back(new DefaultProjection);
-    fixture.projections.push_back(new PinwheelProjection);
-    fixture.projections.push_back(new MultiplyProjection);
-    fixture.projections.push_back(new TiltPanRollProjection);
-    fixture.projections.push_back(new DistanceFromPointProjection);
-    fixture.projections.push_back(new Preset1Projection);
-    fixture.projections.push_back(new RandomProjection);
-    fixture.projections.push_back(new ReverseProjection);
-    fixture.projections.push_back(new MirrorProjection);
-    fixture.projections.push_back(new GroupingProjection);
-    fixture.projections.push_back(new SpacingProjection);
-    fixture.projections.push_back(new TransposeProjection);
-    // fixture.projections.push_back(new KaleidoscopeProjection);
-    fixture.projections.push_back(new ScrollingProjection);
-    fixture.projections.push_back(new AccelerationProjection);
-    fixture.projections.push_back(new CheckerboardProjection);
-    fixture.projections.push_back(new RotateProjection);
+    fixture.projections = projectionTable;
 
     #ifdef STARLIGHT_CLOCKLESS_LED_DRIVER
       #if !(CONFIG_IDF_TARGET_ESP32S3 || CONFIG_IDF_TARGET_ESP32S2)
@@ -179,6 +204,9 @@ public:
         if (rowNr <fixture.layers.size()) {
           LedsLayer *leds = fixture.layers[rowNr];
           fixture.layers.erase(fixture.layers.begin() + rowNr); //remove from vector
+          #ifdef STARBASE_USERMOD_LIVE
+            liveM->kill(leds); //script running on the layer
+          #endif
           delete leds; //remove leds itself
         }
         return true;
@@ -224,11 +252,12 @@ public:
             if (leds->effectNr < effects.size()) {
               Effect* effect = effects[leds->effectNr];
               if (strncmp(effect->name(), "Live Script", 12) == 0) {
-                liveM->kill();
+                liveM->kill(leds);
               }
             }
           #endif
 
+          uint16_t oldEffectNr = leds->effectNr;
           leds->effectNr = mdl->getValue(var, rowNr);
 
           if (leds->effectNr < effects.size()) {
@@ -243,6 +272,7 @@ public:
               doInitEffectRowNr = rowNr;
             }
             else {
+              startTransition(*leds, oldEffectNr); //takes over the effectData of the old effect
               initEffect(*leds, rowNr);
             }
           } // effectNr < size
@@ -287,11 +317,6 @@ public:
           if (proValue < fixture.projections.size()) {
             Projection* projection = fixture.projections[proValue];
 
-            //setting cached virtual class methods! (By chatGPT so no source and don't understand how it works - scary!)
-            //   (don't know how it works as it is not refering to derived classes, just to the base class but later it calls the derived class method)
-            leds->setupCached = &Projection::setup;
-            leds->adjustXYZCached = &Projection::adjustXYZ;
-
             //initProjection
 
             ppf("initProjection leds[%d] effect:%d a:%d\n", rowNr, leds->effectNr, leds->projectionData.bytesAllocated);
@@ -393,6 +418,31 @@ public:
       default: return false;
     }});
 
+    ui->initSelect(tableVar, "scale", (uint8_t)0, false, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onSetValue:
+        for (size_t rowNr = 0; rowNr < fixture.layers.size(); rowNr++)
+          mdl->setValue(var, fixture.layers[rowNr]->renderScale, rowNr);
+        return true;
+      case onUI: {
+        ui->setComment(var, "Render resolution");
+        JsonArray options = ui->setOptions(var);
+        options.add("1:1");
+        options.add("1:2");
+        options.add("1:4");
+        return true; }
+      case onChange:
+        if (rowNr < fixture.layers.size()) {
+          fixture.layers[rowNr]->renderScale = mdl->getValue(var, rowNr);
+
+          ppf("ledsScale[%d] onChange %d\n", rowNr, fixture.layers[rowNr]->renderScale);
+
+          fixture.layers[rowNr]->fadeToBlackBy();
+          fixture.layers[rowNr]->triggerMapping();
+        }
+        return true;
+      default: return false;
+    }});
+
     ui->initText(tableVar, "size", nullptr, 32, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
       case onSetValue: {
         // for (std::vector<LedsLayer *>::iterator leds=fixture.layers.begin(); leds!=fixture.layers.end(); ++leds) {
@@ -408,6 +458,20 @@ public:
       default: return false;
     }});
 
+    ui->initNumber(tableVar, "time", UINT16_MAX, 0, (unsigned long)-1, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onSetValue:
+        for (size_t rowNr = 0; rowNr < fixture.layers.size(); rowNr++)
+          mdl->setValue(var, fixture.layers[rowNr]->renderMicros, rowNr);
+        return true;
+      case onUI:
+        ui->setComment(var, "µs per frame");
+        return true;
+      case onLoop1s:
+        ui->callVarFun(var, UINT8_MAX, onSetValue); //set the value (WIP)
+        return true;
+      default: return false;
+    }});
+
     // ui->initSelect(parentVar, "layout", 0, false, [](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
     //   case onUI: {
     //     ui->setComment(var, "WIP");
@@ -423,6 +487,33 @@ public:
 
     ui->initSlider(parentVar, "Blending", &fixture.globalBlend);
 
+    ui->initNumber(parentVar, "transition", &transitionMillis, 0, 10000, false, [](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onUI:
+        ui->setComment(var, "Effect change in ms, 0 is cut");
+        return true;
+      default: return false;
+    }});
+
+    ui->initSelect(parentVar, "curve", &transitionCurve, false, [](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onUI: {
+        ui->setComment(var, "Transition");
+        JsonArray options = ui->setOptions(var);
+        options.add("Linear"); //t_linear
+        options.add("Wipe"); //t_wipe
+        options.add("Dissolve"); //t_dissolve
+        return true; }
+      default: return false;
+    }});
+
+    if (ESP.getChipCores() > 1) {
+      ui->initCheckBox(parentVar, "parallel", &parallel, false, [](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+        case onUI:
+          ui->setComment(var, "Render non overlapping layers on both cores");
+          return true;
+        default: return false;
+      }});
+    }
+
     #ifdef STARBASE_USERMOD_E131
       // if (e131mod->isEnabled) {
           e131mod->patchChannel(0, "Fixture", "brightness", 255); //should be 256??
@@ -457,10 +548,18 @@ public:
   void loop() {
     // SysModule::loop();
 
-    random16_set_seed(sys->now);
-
     //set new frame
-    if (sys->now - frameMillis >= 1000.0/fps) {
+    //  frames start at multiples of the frame time on the clock of the group, so instances in a group start frame N at the same µs
+    uint32_t frameNr = instances->clockMicros() / (1000000 / max(fps, (uint16_t)1));
+    if (frameNr != lastFrameNr) {
+      lastFrameNr = frameNr;
+      //same seed in frame N on all instances of a group, so random8/16 (FastLED) effects continue over instances (random() does not)
+      random16_set_seed(frameNr);
+      unsigned long frameStartMicros = micros();
+
+      #ifdef STARBASE_USERMOD_MPU6050
+        mpu6050->newFrame(frameStartMicros); //orientation predicted to this frame, read by the projections
+      #endif
 
       //reset pixelsToBlend if multiple leds effects
       // ppf(" %d-%d", fixture.pixelsToBlend.size(), fixture.nrOfLeds);
@@ -472,16 +571,78 @@ public:
 
       newFrame = true;
 
+      //fork: layers not overlapping other layers can be rendered by the layer task on the other core
+      //  balanced on render time: the layer task gets layers as long as it stays within half of the total time
+      //  overlapping layers are rendered here in layer order, so blending is the same as without parallel
+      //  while the layer task renders, loopTask only renders: the model is not changed (commands are applied between frames)
+      //  so effects on both cores can read it (mdl->getValue). FastLED random8/16 state is shared: concurrent calls can skip
+      //  numbers of the sequence, values stay random but are not the same as when rendering on one core
+      layerTaskLayers.clear();
+      layerTaskRowNrs.clear();
+      if (parallel && !layerTaskHandle) startLayerTask();
+
+      //time budget: if the layers do not fit in a frame, each layer gets an equal share of the frame
+      //  a layer over its share runs every renderEvery frames (max 4), its leds keep the last frame in between
+      //  only layers not overlapping other layers, as blending on a kept frame would add up
+      //  renderMicros is only measured when the layer runs, so renderEvery stays until the effect gets faster
+      unsigned long totalMicros = 0;
+      uint8_t nrOfLayers = 0;
+      for (LedsLayer *leds: fixture.layers)
+        if (leds->effectNr < effects.size()) {
+          totalMicros += leds->renderMicros;
+          nrOfLayers++;
+        }
+      unsigned long frameBudget = 1000000 / max(fps, (uint16_t)1) * ((parallel && layerTaskHandle)?2:1);
+      unsigned long layerBudget = frameBudget / max(nrOfLayers, (uint8_t)1);
+      for (LedsLayer *leds: fixture.layers) {
+        if (totalMicros > frameBudget && !leds->overlaps && leds->renderMicros > layerBudget)
+          leds->renderEvery = min((leds->renderMicros + layerBudget - 1) / layerBudget, 4UL);
+        else
+          leds->renderEvery = 1;
+        if (leds->effectNr < effects.size() && frameNr % leds->renderEvery != 0) {
+          leds->unchanged = true; //skipped this frame
+          totalMicros -= leds->renderMicros;
+        }
+      }
+
+      if (parallel && layerTaskHandle) {
+        unsigned long taskMicros = 0;
+        uint8_t rowNr = 0;
+        for (LedsLayer *leds: fixture.layers) {
+          if (leds->effectNr < effects.size()) {
+            if (frameNr % leds->renderEvery != 0) { //over budget, skipped this frame
+              rowNr++;
+              continue;
+            }
+            if (!leds->overlaps && taskMicros + leds->renderMicros / 2 <= totalMicros / 2) {
+              layerTaskLayers.push_back(leds);
+              layerTaskRowNrs.push_back(rowNr);
+              taskMicros += leds->renderMicros;
+            }
+            rowNr++;
+          }
+        }
+        if (layerTaskLayers.size()) xSemaphoreGive(layerTaskStart);
+      }
+
       //for each programmed effect
       //  run the next frame of the effect
       uint8_t rowNr = 0;
       for (LedsLayer *leds: fixture.layers) {
         if (leds->effectNr < effects.size()) { // don't run effect while remapping or non existing effect (default UINT16_MAX)
           // ppf(" %d %d,%d,%d - %d,%d,%d (%d,%d,%d)", leds->effectNr, leds->startPos.x, leds->startPos.y, leds->startPos.z, leds->endPos.x, leds->endPos.y, leds->endPos.z, leds->size.x, leds->size.y, leds->size.z );
+          if (std::find(layerTaskLayers.begin(), layerTaskLayers.end(), leds) != layerTaskLayers.end()) {
+            rowNr++;
+            continue; //rendered by the layer task, shares no leds with other layers so no need to set pixelsToBlend
+          }
+          if (frameNr % leds->renderEvery != 0) {
+            rowNr++;
+            continue; //over budget, skipped this frame, shares no leds with other layers
+          }
+
           mdl->getValueRowNr = rowNr++;
 
-          leds->effectData.begin(); //sets the effectData pointer back to 0 so loop effect can go through it
-          effects[leds->effectNr]->loop(*leds);
+          runLayer(*leds);
 
           mdl->getValueRowNr = UINT8_MAX;
           // if (leds->projectionNr == p_TiltPanRoll || leds->projectionNr == p_Preset1)
@@ -501,17 +662,33 @@ public:
         }
       }
 
+      //join: wait for the layer task
+      if (layerTaskLayers.size()) xSemaphoreTake(layerTaskDone, portMAX_DELAY);
+
       #ifdef STARLIGHT_USERMOD_AUDIOSYNC
 
         if (viewRot == 4) {
-          fixture.head.x = audioSync->fftResults[3];
-          fixture.head.y = audioSync->fftResults[8];
-          fixture.head.z = audioSync->fftResults[13];
+          AudioFrame audio = audioSync->frame();
+          fixture.head.x = audio.bands[3];
+          fixture.head.y = audio.bands[8];
+          fixture.head.z = audio.bands[13];
         }
 
       #endif
 
-      if (driverShow) {
+      bool allUnchanged = fixture.layers.size() == 1; //overlapping layers can overwrite unchanged layers, so then always hash
+      for (LedsLayer *leds: fixture.layers)
+        if (leds->effectNr < effects.size()) allUnchanged = allUnchanged && leds->unchanged;
+
+      //if all effects report unchanged, ledsP is the same as last frame, otherwise compare the hash
+      uint32_t frameHash = allUnchanged?fixture.frameHash:fixture.hashLeds();
+      //unchanged frames are still send once a second (receivers may time out, new clients)
+      fixture.frameChanged = fixture.forceFrame || frameHash != fixture.frameHash || sys->now - fixture.frameChangedMillis >= 1000;
+      fixture.frameHash = frameHash;
+      fixture.forceFrame = false;
+      if (fixture.frameChanged) fixture.frameChangedMillis = sys->now;
+
+      if (driverShow && fixture.frameChanged) {
         #ifdef STARLIGHT_CLOCKLESS_LED_DRIVER
           #if CONFIG_IDF_TARGET_ESP32S3 || CONFIG_IDF_TARGET_ESP32S2
             if (driver.ledsbuff != NULL)
@@ -525,6 +702,10 @@ public:
         #endif
       }
 
+      #ifdef STARBASE_USERMOD_LIVE
+        liveM->frameShown(frameStartMicros); //live script can do its next frame
+      #endif
+
       frameCounter++;
     }
     else {
@@ -868,8 +1049,140 @@ public:
     // trigoUnCached = 0;
   // }
 
+  //run the next frame of the effect of a layer
+  void runLayer(LedsLayer &leds) {
+    unsigned long startMicros = micros();
+    if (leds.transition)
+      runTransition(leds);
+    else {
+      leds.effectData.begin(); //sets the effectData pointer back to 0 so loop effect can go through it
+      leds.unchanged = false;
+      effects[leds.effectNr]->loop(leds);
+    }
+    leds.renderMicros = (leds.renderMicros * 7 + micros() - startMicros) / 8; //moving average
+  }
+
+  //keep the effect of a layer running next to the new effect for transitionMillis, returns false if it is a cut
+  bool startTransition(LedsLayer &leds, uint16_t effectNr) {
+    leds.endTransition(); //a running transition is cut, its incoming effect becomes the outgoing effect
+
+    if (!transitionMillis || effectNr >= effects.size() || strncmp(effects[effectNr]->name(), "Live Script", 12) == 0) return false;
+    //the outgoing effect restores its own pixels, which would overwrite pixels of other layers
+    if (leds.overlaps || leds.doMap) return false;
+
+    //cpu: rendering both effects should fit in a frame
+    unsigned long frameMicros = leds.renderMicros;
+    for (LedsLayer *layer: fixture.layers) frameMicros += layer->renderMicros;
+    if (frameMicros > 1000000 / fps) {
+      ppf("startTransition cut, no time: %d µs\n", frameMicros);
+      return false;
+    }
+
+    std::vector<uint16_t> indexes;
+    for (PhysMap &physMap: leds.mappingTable) {
+      if (physMap.mapType == m_onePixel)
+        indexes.push_back(physMap.indexP);
+      else if (physMap.mapType == m_morePixels)
+        for (uint16_t indexP: leds.mappingTableIndexes[physMap.indexes])
+          indexes.push_back(indexP);
+    }
+    //memory: indexes and 2 frames
+    if (indexes.empty() || indexes.size() * (sizeof(uint16_t) + 2 * sizeof(CRGB)) * 2 > ESP.getMaxAllocHeap()) {
+      ppf("startTransition cut, no memory for %d leds\n", indexes.size());
+      return false;
+    }
+
+    Transition *transition = new Transition();
+    transition->effectNr = effectNr;
+    transition->effectData.swap(leds.effectData);
+    transition->startMillis = sys->now;
+    transition->durationMillis = transitionMillis;
+    transition->curve = transitionCurve;
+    transition->indexes = indexes;
+    //both effects start from the current pixels
+    transition->outgoing.reserve(indexes.size());
+    for (uint16_t indexP: indexes) transition->outgoing.push_back(fixture.ledsP[indexP]);
+    transition->incoming = transition->outgoing;
+    leds.transition = transition;
+
+    return true;
+  }
+
+  //render the outgoing and incoming effect each on their own pixels and blend them by the curve
+  void runTransition(LedsLayer &leds) {
+    Transition &transition = *leds.transition;
+    std::vector<uint16_t> &indexes = transition.indexes;
+    uint16_t progress = min((uint32_t)((sys->now - transition.startMillis) * 256 / max(transition.durationMillis, (uint16_t)1)), (uint32_t)256); //256 is done
+
+    leds.unchanged = false;
+
+    //outgoing
+    for (size_t i = 0; i < indexes.size(); i++) fixture.ledsP[indexes[i]] = transition.outgoing[i];
+    leds.effectData.swap(transition.effectData);
+    leds.effectData.begin();
+    effects[transition.effectNr]->loop(leds);
+    leds.effectData.swap(transition.effectData);
+
+    for (size_t i = 0; i < indexes.size(); i++) {
+      transition.outgoing[i] = fixture.ledsP[indexes[i]];
+      fixture.ledsP[indexes[i]] = transition.incoming[i];
+    }
+
+    //incoming
+    leds.effectData.begin();
+    effects[leds.effectNr]->loop(leds);
+
+    for (size_t i = 0; i < indexes.size(); i++) {
+      CRGB &ledP = fixture.ledsP[indexes[i]];
+      transition.incoming[i] = ledP;
+      switch (transition.curve) {
+        case t_wipe: //in mapping order
+          if (i * 256 / indexes.size() >= progress) ledP = transition.outgoing[i];
+          break;
+        case t_dissolve: //each led switches at a pseudo random moment
+          if (((i * 2654435761U) >> 24) >= progress) ledP = transition.outgoing[i];
+          break;
+        default: //t_linear
+          ledP = blend(transition.outgoing[i], transition.incoming[i], min(progress, (uint16_t)255));
+      }
+    }
+
+    if (progress >= 256) leds.endTransition();
+  }
+
+  //renders layerTaskLayers each time loop gives layerTaskStart, gives layerTaskDone when done
+  //  own semaphores, not task notifications: other notifications of loopTask (libraries, isr's) can not end the join early
+  static void layerTask(void *parameter) {
+    LedModEffects *effectsModule = (LedModEffects *)parameter;
+    for (;;) {
+      xSemaphoreTake(effectsModule->layerTaskStart, portMAX_DELAY); //fork
+      for (size_t i = 0; i < effectsModule->layerTaskLayers.size(); i++) {
+        mdl->getValueRowNrWorker = effectsModule->layerTaskRowNrs[i];
+        effectsModule->runLayer(*effectsModule->layerTaskLayers[i]);
+      }
+      mdl->getValueRowNrWorker = UINT8_MAX;
+      xSemaphoreGive(effectsModule->layerTaskDone); //join
+    }
+  }
+
+  //created the first time parallel is on: runs in the loop task, the layer task runs on the other core
+  //  same stack size as the loop task as effects run in it
+  void startLayerTask() {
+    layerTaskStart = xSemaphoreCreateBinary();
+    layerTaskDone = xSemaphoreCreateBinary();
+    xTaskCreatePinnedToCore(layerTask, "layerTask", getArduinoLoopTaskStackSize(), this, tskIDLE_PRIORITY + 1, &layerTaskHandle, 1 - xPortGetCoreID());
+    mdl->workerTask = layerTaskHandle;
+  }
+
 private:
   unsigned long frameMillis = 0;
+  uint32_t lastFrameNr = 0;
+
+  TaskHandle_t layerTaskHandle = nullptr;
+  SemaphoreHandle_t layerTaskStart = nullptr;
+  SemaphoreHandle_t layerTaskDone = nullptr;
+  std::vector<LedsLayer *> layerTaskLayers; //layers rendered by the layer task this frame
+  std::vector<uint8_t> layerTaskRowNrs;
   JsonObject varSystem = JsonObject();
   uint8_t viewRot = UINT8_MAX;
 
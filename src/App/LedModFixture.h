@@ -44,6 +44,8 @@ public:
           FastLED.setBrightness(result);
         #endif
 
+        eff->fixture.forceFrame = true; //show also if leds unchanged
+
         ppf("Set Brightness to %d -> b:%d r:%d\n", var["value"].as<int>(), bri, result);
         return true; }
       default: return false; 
@@ -55,6 +57,11 @@ public:
       case onLoop: {
         var["interval"] =  max(eff->fixture.nrOfLeds * web->ws.count()/200, 16U)*10; //interval in ms * 10, not too fast //from cs to ms
 
+        //skip if the leds did not change since the last preview (resend every second for new clients, rotations animate the view)
+        if (viewRotation == 0 && eff->fixture.frameHash == previewHash && sys->now - previewMillis < 1000) return true;
+        previewHash = eff->fixture.frameHash;
+        previewMillis = sys->now;
+
         web->sendDataWs([this](AsyncWebSocketMessageBuffer * wsBuf) {
           byte* buffer;
 
@@ -194,6 +201,10 @@ public:
     }});
 
   }
+
+private:
+  uint32_t previewHash = 0;
+  unsigned long previewMillis = 0;
 };
 
 extern LedModFixture *fix;
\ No newline at end of file
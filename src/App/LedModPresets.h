@@ -0,0 +1,307 @@
+/*
+   @title     StarLight
+   @file      LedModPresets.h
+   @date      20240819
+   @repo      https://github.com/MoonModules/StarLight
+   @Authors   https://github.com/MoonModules/StarLight/commits/main
+   @Copyright © 2024 Github StarLight Commit Authors
+   @license   GNU GENERAL PUBLIC LICENSE Version 3, 29 June 2007
+   @license   For non GPL-v3 usage, commercial licenses must be purchased. Contact moonmodules@icloud.com
+*/
+
+#define nrOfPresets 16
+//max bytes of all cached mappings together, the least recently used mapping is removed to make room
+#if defined(BOARD_HAS_PSRAM)
+  #define mappingCacheMaxBytes (256 * 1024)
+#else
+  #define mappingCacheMaxBytes (32 * 1024)
+#endif
+
+//mapping of a layer, cached so a preset can be applied without remapping
+struct LayerMapping {
+  std::vector<PhysMap> mappingTable;
+  std::vector<std::vector<uint16_t>> mappingTableIndexes;
+  uint16_t mappingOffset;
+  bool ownSlice;
+  Coord3D size;
+  uint16_t nrOfLeds;
+  uint8_t effectDimension;
+  uint8_t projectionDimension;
+};
+
+//mappings of all layers of a preset, only valid for the fixture they are made for
+struct PresetMapping {
+  uint8_t fixtureNr = UINT8_MAX;
+  uint16_t nrOfLeds = 0;
+  Coord3D fixSize = {0,0,0};
+  std::vector<LayerMapping> layers;
+  size_t bytes = 0; //of the mapping tables, counted in cachedBytes
+  unsigned long lastUsed = 0; //millis of caching or applying, for LRU eviction
+};
+
+//a preset is the whole layer stack: effect, projection, start, middle, end, scale and the effect and projection controls of each layer
+//  presets are stored in /presets.mp (MessagePack), mappings are cached in memory after the first time a preset is applied
+//  a preset is applied by loop, between two frames, all layers at once
+class LedModPresets:public SysModule {
+
+public:
+
+  uint8_t presetNr = 0;
+  uint8_t applyPresetNr = UINT8_MAX; //set by apply, applied in loop
+  uint8_t cacheMappingPresetNr = UINT8_MAX; //cache the mapping when the remap after applying is done
+
+  LedModPresets() :SysModule("Presets") {};
+
+  void setup() {
+    SysModule::setup();
+
+    parentVar = ui->initAppMod(parentVar, name, 1202);
+
+    File f = files->open("/presets.mp", "r");
+    if (f) {
+      DeserializationError error = deserializeMsgPack(presets, f);
+      if (error) ppf("presets deserializeMsgPack failed with code %s\n", error.c_str());
+      f.close();
+    }
+    if (!presets.is<JsonArray>()) presets.to<JsonArray>();
+
+    ui->initSelect(parentVar, "preset", &presetNr, false, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onUI: {
+        ui->setComment(var, "Layers stored in preset");
+        JsonArray options = ui->setOptions(var);
+        for (uint8_t presetNr = 0; presetNr < nrOfPresets; presetNr++) {
+          char buf[32];
+          JsonArray layers = presets[presetNr]["layers"];
+          uint16_t effectNr = layers.size()?layers[0]["effect"].as<uint16_t>():UINT16_MAX;
+          if (effectNr < eff->effects.size())
+            print->fFormat(buf, sizeof(buf), "%d: %s%s", presetNr + 1, eff->effects[effectNr]->name(), layers.size() > 1?" +":"");
+          else
+            print->fFormat(buf, sizeof(buf), "%d: empty", presetNr + 1);
+          options.add(JsonString(buf, JsonString::Copied)); //copy!
+        }
+        return true; }
+      default: return false;
+    }});
+
+    ui->initButton(parentVar, "apply", false, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onUI:
+        ui->setComment(var, "Before the next frame");
+        return true;
+      case onChange:
+        applyPresetNr = presetNr;
+        return true;
+      default: return false;
+    }});
+
+    ui->initButton(parentVar, "store", false, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onUI:
+        ui->setComment(var, "Store layers in preset");
+        return true;
+      case onChange:
+        storePreset(presetNr);
+        ui->callVarFun("Presets", "preset", UINT8_MAX, onUI); //rebuild options
+        return true;
+      default: return false;
+    }});
+  }
+
+  void loop() {
+    // SysModule::loop();
+
+    //loop runs between frames of LedModEffects::loop (same task)
+    if (applyPresetNr != UINT8_MAX) {
+      applyPreset(applyPresetNr);
+      applyPresetNr = UINT8_MAX;
+    }
+
+    if (cacheMappingPresetNr != UINT8_MAX && !eff->fixture.doMap) {
+      cacheMapping(cacheMappingPresetNr);
+      cacheMappingPresetNr = UINT8_MAX;
+    }
+  }
+
+  void storePreset(uint8_t presetNr) {
+    if (presetNr >= nrOfPresets) return;
+
+    JsonObject preset = presets[presetNr].to<JsonObject>();
+    JsonArray layers = preset["layers"].to<JsonArray>();
+    for (uint8_t rowNr = 0; rowNr < eff->fixture.layers.size(); rowNr++) {
+      JsonObject layer = layers.add<JsonObject>();
+      for (const char * id: {"effect", "projection", "start", "middle", "end", "scale"})
+        layer[id] = mdl->getValue("layers", id, rowNr);
+      controlsToJson(mdl->findVar("layers", "effect"), rowNr, layer["effectControls"].to<JsonObject>());
+      controlsToJson(mdl->findVar("layers", "projection"), rowNr, layer["projectionControls"].to<JsonObject>());
+    }
+
+    File f = files->open("/presets.mp", "w");
+    if (f) {
+      serializeMsgPack(presets, f);
+      f.close();
+      files->filesChanged = true;
+    }
+
+    ppf("storePreset %d layers:%d\n", presetNr, layers.size());
+
+    cacheMapping(presetNr); //the current mapping is the mapping of the preset
+  }
+
+  void applyPreset(uint8_t presetNr) {
+    JsonArray layers = presets[presetNr]["layers"];
+    if (layers.isNull()) {
+      ppf("applyPreset %d is empty\n", presetNr);
+      return;
+    }
+
+    unsigned long startMicros = micros();
+    Fixture &fixture = eff->fixture;
+    bool fixtureDoMap = fixture.doMap; //remap which was already pending
+
+    //remove the layers which are not in the preset
+    JsonObject tableVar = mdl->findVar("Effects", "layers");
+    while (fixture.layers.size() > layers.size()) {
+      uint8_t rowNr = fixture.layers.size() - 1;
+      ui->callVarFun(tableVar, rowNr, onDelete);
+      Variable(tableVar).removeValuesForRow(rowNr);
+    }
+
+    uint8_t rowNr = 0;
+    for (JsonObject layer: layers) {
+      //effect first as it creates the layer if not existing, effect and projection onChange create the controls
+      JsonObject effectVar = mdl->findVar("layers", "effect");
+      mdl->setValueJV(effectVar, layer["effect"], rowNr);
+      controlsFromJson(effectVar, rowNr, layer["effectControls"]);
+      JsonObject projectionVar = mdl->findVar("layers", "projection");
+      mdl->setValueJV(projectionVar, layer["projection"], rowNr);
+      controlsFromJson(projectionVar, rowNr, layer["projectionControls"]);
+      for (const char * id: {"start", "middle", "end", "scale"})
+        mdl->setValueJV(mdl->findVar("layers", id), layer[id], rowNr);
+      rowNr++;
+    }
+
+    //use the cached mapping instead of the remap triggered by the values above
+    PresetMapping &mapping = mappings[presetNr];
+    if (mapping.layers.size() == fixture.layers.size() && mapping.fixtureNr == fixture.fixtureNr && mapping.nrOfLeds == fixture.nrOfLeds && mapping.fixSize == fixture.fixSize) {
+      rowNr = 0;
+      for (LedsLayer *leds: fixture.layers) {
+        LayerMapping &layerMapping = mapping.layers[rowNr];
+        if (leds->doMap) leds->fill_solid(CRGB::Black); //as projectAndMapPre: clear the leds of the previous mapping
+        leds->mappingTable = layerMapping.mappingTable;
+        leds->mappingTableIndexes = layerMapping.mappingTableIndexes;
+        leds->mappingOffset = layerMapping.mappingOffset;
+        leds->ownSlice = layerMapping.ownSlice;
+        leds->size = layerMapping.size;
+        leds->nrOfLeds = layerMapping.nrOfLeds;
+        leds->effectDimension = layerMapping.effectDimension;
+        leds->projectionDimension = layerMapping.projectionDimension;
+        leds->doMap = false;
+
+        char buf[32];
+        print->fFormat(buf, sizeof(buf), "%d x %d x %d -> %d", leds->size.x, leds->size.y, leds->size.z, leds->nrOfLeds);
+        mdl->setValue("layers", "size", JsonString(buf, JsonString::Copied), rowNr);
+
+        //effect onChange waits for the mapping if the dimension changed
+        if (eff->doInitEffectRowNr == rowNr) {
+          eff->doInitEffectRowNr = UINT8_MAX;
+          eff->initEffect(*leds, rowNr);
+        }
+        rowNr++;
+      }
+      fixture.mappingsChanged(); //as projectAndMapPost
+      fixture.doMap = fixtureDoMap;
+      mapping.lastUsed = millis();
+      ppf("applyPreset %d cached mapping %d µs\n", presetNr, micros() - startMicros);
+    }
+    else {
+      //remap now instead of waiting for the mapping interval
+      eff->lastMappingMillis = 0;
+      cacheMappingPresetNr = presetNr;
+      ppf("applyPreset %d remap %d µs\n", presetNr, micros() - startMicros);
+    }
+  }
+
+private:
+  JsonDocument presets; //array of nrOfPresets presets, null if not stored
+  PresetMapping mappings[nrOfPresets];
+  size_t cachedBytes = 0; //of all mappings, max mappingCacheMaxBytes
+
+  //copy the controls (child vars) of var of row rowNr to controls
+  void controlsToJson(JsonObject var, uint8_t rowNr, JsonObject controls) {
+    for (JsonObject childVar: Variable(var).children()) {
+      Variable variable = Variable(childVar);
+      if (variable.readOnly() || childVar["type"] == "button") continue;
+      if (childVar["value"].is<JsonArray>() && rowNr < childVar["value"].size())
+        controls[JsonString(variable.id(), JsonString::Copied)] = childVar["value"][rowNr];
+    }
+  }
+
+  void controlsFromJson(JsonObject var, uint8_t rowNr, JsonObject controls) {
+    for (JsonObject childVar: Variable(var).children()) {
+      JsonVariant value = controls[Variable(childVar).id()];
+      if (!value.isNull())
+        mdl->setValueJV(childVar, value, rowNr);
+    }
+  }
+
+  void cacheMapping(uint8_t presetNr) {
+    Fixture &fixture = eff->fixture;
+    PresetMapping &mapping = mappings[presetNr];
+    uncacheMapping(mapping);
+    if (fixture.doMap) return; //not mapped yet
+
+    //the cache is a copy of all mapping tables, skip if memory is short (applying will remap)
+    size_t bytes = 0;
+    for (LedsLayer *leds: fixture.layers) {
+      bytes += leds->mappingTable.size() * sizeof(PhysMap);
+      for (std::vector<uint16_t> &mappingTableIndex: leds->mappingTableIndexes)
+        bytes += mappingTableIndex.size() * sizeof(uint16_t);
+    }
+    if (bytes > mappingCacheMaxBytes) {
+      ppf("cacheMapping preset %d not cached, %d bytes > max %d\n", presetNr, bytes, mappingCacheMaxBytes);
+      return;
+    }
+
+    //make room: remove the least recently used mappings
+    while (cachedBytes + bytes > mappingCacheMaxBytes) {
+      PresetMapping *lru = nullptr;
+      for (PresetMapping &cached: mappings)
+        if (cached.layers.size() && (!lru || cached.lastUsed < lru->lastUsed)) lru = &cached;
+      if (!lru) break; //cachedBytes out of sync, should not happen
+      ppf("cacheMapping preset %d evicted, %d bytes\n", lru - mappings, lru->bytes);
+      uncacheMapping(*lru);
+    }
+
+    if (bytes * 2 > ESP.getMaxAllocHeap()) {
+      ppf("cacheMapping preset %d not cached, %d bytes\n", presetNr, bytes);
+      return;
+    }
+
+    mapping.fixtureNr = fixture.fixtureNr;
+    mapping.nrOfLeds = fixture.nrOfLeds;
+    mapping.fixSize = fixture.fixSize;
+    for (LedsLayer *leds: fixture.layers) {
+      mapping.layers.push_back(LayerMapping());
+      LayerMapping &layerMapping = mapping.layers.back();
+      layerMapping.mappingTable = leds->mappingTable;
+      layerMapping.mappingTableIndexes = leds->mappingTableIndexes;
+      layerMapping.mappingOffset = leds->mappingOffset;
+      layerMapping.ownSlice = leds->ownSlice;
+      layerMapping.size = leds->size;
+      layerMapping.nrOfLeds = leds->nrOfLeds;
+      layerMapping.effectDimension = leds->effectDimension;
+      layerMapping.projectionDimension = leds->projectionDimension;
+    }
+    mapping.bytes = bytes;
+    mapping.lastUsed = millis();
+    cachedBytes += bytes;
+    ppf("cacheMapping preset %d %d bytes (cache %d bytes)\n", presetNr, bytes, cachedBytes);
+  }
+
+  void uncacheMapping(PresetMapping &mapping) {
+    mapping.layers.clear();
+    cachedBytes -= mapping.bytes;
+    mapping.bytes = 0;
+  }
+
+};
+
+extern LedModPresets *presetmod;
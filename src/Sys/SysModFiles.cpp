@@ -133,8 +133,16 @@ void SysModFiles::loop10s() {
 
 bool SysModFiles::remove(const char * path) {
   ppf("File remove %s\n", path);
+  filesChanged = true;
+  fileWritten(path);
   return LittleFS.remove(path);
+}
+
+bool SysModFiles::rename(const char * pathFrom, const char * pathTo) {
   filesChanged = true;
+  fileWritten(pathFrom);
+  fileWritten(pathTo);
+  return LittleFS.rename(pathFrom, pathTo);
 }
 
 size_t SysModFiles::usedBytes() {
@@ -146,6 +154,7 @@ size_t SysModFiles::totalBytes() {
 }
 
 File SysModFiles::open(const char * path, const char * mode, const bool create) {
+  if (mode[0] != 'r' || strchr(mode, '+')) fileWritten(path);
   return LittleFS.open(path, mode, create);
 }
 
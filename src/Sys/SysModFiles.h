@@ -13,6 +13,7 @@
 
 #include "SysModule.h"
 #include "LittleFS.h"
+#include <atomic>
 
 class SysModFiles: public SysModule {
 
@@ -31,12 +32,21 @@ public:
 
   bool remove(const char * path);
 
+  //replaces pathTo if it exists (atomic on LittleFS)
+  bool rename(const char * pathFrom, const char * pathTo);
+
   size_t usedBytes();
 
   size_t totalBytes();
 
   File open(const char * path, const char * mode, const bool create = false);
 
+  //version of the content of a file, changes when the file is opened for writing, removed or renamed, see ETag in SysModWeb::serveFiles
+  //  not the modification time: without NTP the time restarts after a reboot. Files share a version if their path hashes collide (extra changes only)
+  uint32_t fileVersion(const char * path) {return fileVersions[pathHash(path) % nrOfFileVersions].load();}
+  //call when a file is written without open (or after the last write, e.g. upload done)
+  void fileWritten(const char * path) {fileVersions[pathHash(path) % nrOfFileVersions]++;}
+
   //get the file names and size in an array
   void dirToJson(JsonArray array, bool nameOnly = false, const char * filter = nullptr);
 
@@ -55,6 +65,19 @@ public:
   //remove files meeting filter condition, if no filter, all, if reverse then all but filter
   void removeFiles(const char * filter = nullptr, bool reverse = false);
 
+private:
+  static const uint8_t nrOfFileVersions = 32;
+  std::atomic<uint32_t> fileVersions[nrOfFileVersions] = {}; //written by loopTask and the AsyncTCP task (upload)
+
+  //FNV-1a
+  uint32_t pathHash(const char * path) {
+    uint32_t hash = 2166136261;
+    for (const char *c = path; *c; c++)
+      hash = (hash ^ (uint8_t)*c) * 16777619;
+    return hash;
+  }
+public:
+
 };
 
 extern SysModFiles *files;
\ No newline at end of file
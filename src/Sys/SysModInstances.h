@@ -68,9 +68,24 @@ struct UDPWLEDMessage {
 struct UDPStarMessage {
   UDPWLEDMessage header; // 44 bytes fixed!
   SysData sysData;
-  char jsonString[1460 - sizeof(UDPWLEDMessage) - sizeof(SysData)];
+  byte varData[1460 - sizeof(UDPWLEDMessage) - sizeof(SysData)]; //all dash vars, see writeVarRecord
 };
 
+//dash vars changed since the previous loop20ms (broadcast) or set a var of another instance, only the used part of varData is sent
+struct UDPVarsMessage {
+  char token[4]; //"SLvr": changed vars, "SLvs": set vars
+  byte varData[1460 - 4]; //see writeVarRecord
+};
+
+//clock sync request and response (NTP style), see syncClock
+struct UDPClockMessage {
+  char token[4]; //"SLck"
+  byte type; //0: request, 1: response
+  int64_t t1; //request sent, local µs of the requester
+  int64_t t2; //request received, clock of the responder
+  int64_t t3; //response sent, clock of the responder
+}; //32 bytes
+
 //WLED syncmessage 1193 bytes
 struct UDPWLEDSyncMessage { //see notify( in WLED
   byte protocol; //0
@@ -104,7 +119,7 @@ class SysModInstances:public SysModule {
 public:
 
   std::vector<InstanceInfo> instances;
-  std::vector<JsonObject> changedVarsQueue;
+  std::vector<uint16_t> changedVars; //handles of dash vars changed since the last loop20ms, no duplicates
 
   SysModInstances() :SysModule("Instances") {
   };
@@ -124,7 +139,7 @@ public:
       // comment this out for the time being as causes corrupted instance names
       // case onChange:
       //   strlcpy(instances[rowNr].name, mdl->getValue(var, rowNr), sizeof(instances[rowNr].name));
-      //   sendMessageUDP(instances[rowNr].ip, "name", mdl->getValue(var, rowNr));
+      //   sendSetVarUDP(instances[rowNr].ip, "name", mdl->getValue(var, rowNr));
       //   return true;
       default: return false;
     }});
@@ -220,6 +235,8 @@ public:
 
       ppf("dash %s %s found\n", Variable(var).id(), Variable(var).valueString().c_str());
 
+      dashVars.push_back(var["h"]); //no model walk in sendSysInfoUDP
+
       char columnVarID[32] = "ins";
       strlcat(columnVarID, var["id"], sizeof(columnVarID));
       JsonObject insVar; // = ui->cloneVar(var, columnVarID, [this, var](JsonObject insVar){});
@@ -250,7 +267,7 @@ public:
             if (instances[rowNr].ip == net->localIP()) {
               mdl->setValue(var, mdl->getValue(insVar, rowNr).as<uint8_t>()); //this will call sendDataWS (tbd...), do not set for rowNr
             } else {
-              sendMessageUDP(instances[rowNr].ip, var, mdl->getValue(insVar, rowNr));
+              sendSetVarUDP(instances[rowNr].ip, var, mdl->getValue(insVar, rowNr));
             }
           }
           // print->printJson(" ", var);
@@ -267,6 +284,23 @@ public:
 
     });
 
+    ui->initText(parentVar, "clock", nullptr, 32, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onUI:
+        ui->setComment(var, "Synced to the lowest ip of the group");
+        return true;
+      case onLoop1s: {
+        char text[32];
+        if (clockMaster == IPAddress())
+          strlcpy(text, "No group", sizeof(text));
+        else if (clockMaster == net->localIP())
+          strlcpy(text, "Master", sizeof(text));
+        else
+          print->fFormat(text, sizeof(text), "...%d %+d ms rtt:%d µs", clockMaster[3], (int)(clockOffset / 1000), (int)clockDelay);
+        mdl->setValue(var, JsonString(text, JsonString::Copied));
+        return true; }
+      default: return false;
+    }});
+
     if (sizeof(UDPWLEDMessage) != 44) {
       ppf("Program error: Size of UDP message is not 44: %d\n", sizeof(UDPWLEDMessage));
       // ppf("udpMessage size %d = %d + %d + %d + ...\n", sizeof(UDPWLEDMessage), sizeof(udpMessage.ip0), sizeof(udpMessage.version), sizeof(udpMessage.name));
@@ -302,18 +336,132 @@ public:
 
     handleNotifications();
 
-    while (changedVarsQueue.size()) {
-      JsonObject var = changedVarsQueue.front();
-      sendMessageUDP(IPAddress(255, 255, 255, 255), var, var["value"]); //broadcast
-      changedVarsQueue.erase(changedVarsQueue.begin());
+    if (changedVars.size()) {
+      sendChangedVarsUDP(); //one broadcast for all changes of the last 20ms
+      changedVars.clear();
     }
 
+    //slew the clock to the estimate of syncClock, so frames (frameNr) don't jump
+    if (clockSlew) {
+      int64_t now = esp_timer_get_time();
+      int64_t step = (now - clockSlewMicros) * clockSlewMax / 1000000;
+      clockSlewMicros = now;
+      clockSlew = clockSlew > 0?max(clockSlew - step, (int64_t)0):min(clockSlew + step, (int64_t)0);
+      sys->timebase = (uint32_t)(clockMicros() / 1000) - millis();
+    }
+  }
+
+  void loop1s() {
+    syncClock();
   }
 
   void loop10s() {
     sendSysInfoUDP();  //temporary every second
   }
 
+  //clock of the group in µs: the local clock plus the offset and drift to the master, see syncClock
+  int64_t clockMicros(int64_t localMicros = esp_timer_get_time()) {
+    return localMicros + clockOffset + clockSlew + (int64_t)(clockDrift * (localMicros - clockSyncedMicros));
+  }
+
+  //ip as a number, to compare addresses (not only the last byte, a group can span subnets)
+  uint32_t ipValue(IPAddress ip) {
+    return (uint32_t)ip[0] << 24 | (uint32_t)ip[1] << 16 | (uint32_t)ip[2] << 8 | ip[3];
+  }
+
+  //send a clock request to the master: the instance of the group with the lowest ip (the master uses its own clock)
+  void syncClock() {
+    if (!mdls->isConnected || !udp2Connected) return;
+
+    IPAddress master;
+    char group1[32];
+    if (groupOfName(mdl->getValue("System", "name"), group1)) {
+      master = net->localIP();
+      for (InstanceInfo &instance: instances) {
+        char group2[32];
+        if (instance.sysData.type >= 1 && ipValue(instance.ip) < ipValue(master) && groupOfName(instance.name, group2) && strncmp(group1, group2, sizeof(group1)) == 0)
+          master = instance.ip;
+      }
+    }
+    if (master != clockMaster) {
+      ppf("syncClock master %s\n", master.toString().c_str());
+      clockMaster = master;
+      nrOfClockSamples = 0;
+      clockDriftMicros = 0;
+    }
+    if (clockMaster == IPAddress() || clockMaster == net->localIP()) return;
+
+    UDPClockMessage request;
+    memcpy(request.token, "SLck", 4);
+    request.type = 0;
+    request.t1 = esp_timer_get_time();
+    request.t2 = request.t3 = 0;
+    if (0 != instanceUDP.beginPacket(clockMaster, instanceUDPPort)) {
+      instanceUDP.write((byte *)&request, sizeof(request));
+      instanceUDP.endPacket();
+      web->sendUDPCounter++;
+      web->sendUDPBytes+=sizeof(request);
+    }
+  }
+
+  //receivedMicros: local µs when the packet was noticed
+  void handleClockMessage(UDPClockMessage &message, int64_t receivedMicros) {
+    if (message.type == 0) { //request: answer with the clock of this instance
+      message.type = 1;
+      message.t2 = clockMicros(receivedMicros);
+      if (0 != instanceUDP.beginPacket(instanceUDP.remoteIP(), instanceUDPPort)) {
+        message.t3 = clockMicros();
+        instanceUDP.write((byte *)&message, sizeof(message));
+        instanceUDP.endPacket();
+        web->sendUDPCounter++;
+        web->sendUDPBytes+=sizeof(message);
+      }
+      return;
+    }
+
+    if (instanceUDP.remoteIP() != clockMaster) return;
+
+    //offset of the master clock to the local clock, assuming the same network delay in both directions
+    ClockSample sample;
+    sample.offset = ((message.t2 - message.t1) + (message.t3 - receivedMicros)) / 2;
+    sample.delay = (receivedMicros - message.t1) - (message.t3 - message.t2);
+    sample.localMicros = receivedMicros;
+    if (sample.delay < 0) return;
+    clockSamples[clockSampleIndex] = sample;
+    clockSampleIndex = (clockSampleIndex + 1) % nrOfClockSamplesMax;
+    if (nrOfClockSamples < nrOfClockSamplesMax) nrOfClockSamples++;
+
+    //filter: the sample with the lowest delay has the least queuing (and loop20ms polling) in it
+    ClockSample *best = &clockSamples[0];
+    for (uint8_t i = 1; i < nrOfClockSamples; i++)
+      if (clockSamples[i].delay < best->delay) best = &clockSamples[i];
+
+    int64_t now = esp_timer_get_time();
+    int64_t appliedMicros = clockMicros(now); //before the new estimate
+
+    //drift: offset change of best samples at least 30s apart, smoothed
+    if (clockDriftMicros == 0) {
+      clockDriftMicros = best->localMicros;
+      clockDriftOffset = best->offset;
+    }
+    else if (best->localMicros - clockDriftMicros >= 30000000) {
+      float drift = (float)(best->offset - clockDriftOffset) / (best->localMicros - clockDriftMicros);
+      clockDrift += (drift - clockDrift) / 4;
+      clockDriftMicros = best->localMicros;
+      clockDriftOffset = best->offset;
+    }
+
+    clockOffset = best->offset;
+    clockSyncedMicros = best->localMicros;
+    clockDelay = best->delay;
+    //not a step to the estimate but a slew (loop20ms), unless first sample of a master or far off (e.g. master restarted)
+    clockSlew = 0;
+    clockSlew = nrOfClockSamples > 1?appliedMicros - clockMicros(now):0;
+    if (clockSlew > 100000 || clockSlew < -100000) clockSlew = 0;
+    clockSlewMicros = now;
+    sys->timebase = (uint32_t)(clockMicros() / 1000) - millis(); //sys->now follows the clock of the group
+  }
+
   //distract the groupName of an instance name
   bool groupOfName(const char *name, char *group = nullptr) {
     char copy[32];
@@ -445,68 +593,46 @@ public:
       packetSize = instanceUDP.parsePacket();
 
       if (packetSize > 0) {
+        int64_t receivedMicros = esp_timer_get_time();
         // IPAddress remoteIp = instanceUDP.remoteIP();
         // ppf("handleNotifications instances ...%d %d check %d or %d\n", instanceUDP.remoteIP()[3], packetSize, sizeof(UDPWLEDMessage), sizeof(UDPStarMessage));
 
-        bool found = false;
+        //read once and check the token first: a vars message can have the size of a WLED or Star message
+        UDPStarMessage starMessage; //largest message (1460 bytes), other messages are read into it as bytes
+        byte *buffer = (byte *)&starMessage;
+        size_t len = instanceUDP.read(buffer, min((size_t)packetSize, sizeof(starMessage)));
 
-        if (packetSize == sizeof(UDPWLEDMessage)) { //WLED instance
-          UDPStarMessage starMessage;
-          byte *udpIn = (byte *)&starMessage.header;
-          instanceUDP.read(udpIn, packetSize);
-
-          // ppf("WLED instance %s received: size: %d\n", instanceUDP.remoteIP().toString().c_str(), packetSize);
-          // for (int i=0; i<44; i++) {
-          //   Serial.printf("%d: %d\n", i, udpIn[i]);
-          // }
-
-          starMessage.sysData.type = 0; //WLED
-
-          if (starMessage.header.ip0 == net->localIP()[0]) { // checksum - no other type of message
-            updateInstance(starMessage);
-            found = true;
+        if (len == sizeof(UDPClockMessage) && strncmp((char *)buffer, "SLck", 4) == 0) {
+          UDPClockMessage clockMessage;
+          memcpy(&clockMessage, buffer, sizeof(clockMessage));
+          handleClockMessage(clockMessage, receivedMicros);
+        }
+        else if (len > 4 && (strncmp((char *)buffer, "SLvr", 4) == 0 || strncmp((char *)buffer, "SLvs", 4) == 0)) {
+          if (instanceUDP.remoteIP()[3] != net->localIP()[3]) { //only others
+            InstanceInfo *instance = findInstance(instanceUDP.remoteIP()); //if not exist, created
+            if (buffer[3] == 'r')
+              readVarRecords(buffer + 4, len - 4, instance->jsonData, inGroup(instance->name));
+            else if (inGroup(instance->name)) {
+              JsonDocument values; //not values of the sending instance
+              readVarRecords(buffer + 4, len - 4, values, true);
+            }
           }
         }
+        else if (len == sizeof(UDPWLEDMessage) || len == sizeof(UDPStarMessage)) { //WLED or StarBase instance
 
-        if (!found && packetSize == sizeof(UDPStarMessage)) { //StarBase instance
-          UDPStarMessage starMessage;
-          byte *udpIn = (byte *)&starMessage;
-          instanceUDP.read(udpIn, packetSize);
+          // ppf("instance %s received: size: %d\n", instanceUDP.remoteIP().toString().c_str(), len);
+          // for (int i=0; i<44; i++) {
+          //   Serial.printf("%d: %d\n", i, buffer[i]);
+          // }
 
-          // ppf("Star instance %s received: size: %d\n", instanceUDP.remoteIP().toString().c_str(), packetSize);
+          if (len == sizeof(UDPWLEDMessage))
+            starMessage.sysData.type = 0; //WLED
 
-          if (starMessage.header.ip0 == net->localIP()[0]) { // checksum - no other type of message
+          if (starMessage.header.ip0 == net->localIP()[0]) // checksum - no other type of message
             updateInstance(starMessage);
-            found = true;
-          }
-        }
-
-        if (!found) { // check on json
-          char buffer[packetSize];
-          instanceUDP.read(buffer, packetSize);
-
-          JsonDocument message;
-          DeserializationError error = deserializeJson(message, buffer);
-          if (error)
-            ppf("handleNotifications i:%d no json l: %d e:%s\n", instanceUDP.remoteIP()[3], strnlen(buffer, packetSize), error.c_str());
-          else {
-            if (instanceUDP.remoteIP()[3] != net->localIP()[3]) { //only others
-
-              InstanceInfo *instance = findInstance(instanceUDP.remoteIP()); //if not exist, created
-              char group1[32];
-              char group2[32];
-              if (groupOfName(instance->name, group1) && groupOfName(mdl->getValue("System", "name"), group2) && strncmp(group1, group2, sizeof(group1)) == 0) {
-                  if (!message["id"].isNull() && !message["value"].isNull()) {
-                    ppf("handleNotifications i:%d json message %.*s l:%d\n", instanceUDP.remoteIP()[3], packetSize, buffer, packetSize);
-
-                    mdl->setValueJV(mdl->findVar(message["pid"].as<const char *>(), message["id"].as<const char *>()), message["value"]);
-                  }
-                }
-              }
-            else
-              ppf("handleNotifications self i:%d b:%.*s\n", instanceUDP.remoteIP()[3], packetSize, buffer);
-          }
         }
+        else
+          ppf("handleNotifications i:%d unknown message l:%d\n", instanceUDP.remoteIP()[3], packetSize);
 
         web->recvUDPCounter++;
         web->recvUDPBytes+=packetSize;
@@ -595,30 +721,20 @@ public:
       }
     #endif
 
-    updateInstance(starMessage); //temp? to show own instance in list as instance is not catching it's own udp message...
-
-    //other way around: first set instance variables, then fill starMessage
-    for (InstanceInfo &instance: instances) {
-      if (instance.ip == net->localIP()) {
-        instance.jsonData.to<JsonObject>(); //clear
-
-        //send dash values
-        mdl->findVars("dash", true, [&instance](JsonObject var) { //varFun
-          instance.jsonData[Variable(var).id()] = var["value"];
-          // // print->printJson("setVar", var);
-          // JsonArray valArray = Variable(var).valArray();
-          // if (valArray.isNull())
-          // else if (valArray.size())
-          //   instance.jsonData[Variable(var).id()] = valArray;
-        });
-
-        serializeJson(instance.jsonData, starMessage.jsonString);
-        // ppf("sendSysInfoUDP ip:%d s:%s\n", instance.ip[3], starMessage.jsonString);
-        // print->printJson(" d:", instance.jsonData);
-        // print->printJDocInfo("   info", instance.jsonData);
-      }
+    //send dash values
+    memset(starMessage.varData, 0, sizeof(starMessage.varData)); //a 0 keyLen ends the records
+    starMessage.varData[0] = binVars;
+    size_t len = 1;
+    for (uint16_t handle: dashVars) {
+      JsonObject var = mdl->findVar(handle);
+      if (var.isNull()) continue;
+      uint8_t size = writeVarRecord(starMessage.varData + len, sizeof(starMessage.varData) - len, var, var["value"]);
+      if (size == 0) ppf("dev sendSysInfoUDP %s.%s does not fit\n", Variable(var).pid(), Variable(var).id());
+      len += size;
     }
 
+    updateInstance(starMessage); //temp? to show own instance in list as instance is not catching it's own udp message...
+
     // broadcast to network
     if (0 != instanceUDP.beginPacket(IPAddress(255, 255, 255, 255), instanceUDPPort)) {  // WLEDMM beginPacket == 0 --> error
       // ppf("sendSysInfoUDP %s s:%d p:%d i:...%d\n", starMessage.header.name, sizeof(UDPStarMessage), instanceUDPPort, localIP[3]);
@@ -652,30 +768,151 @@ public:
     // }
   }
 
-  //sends an UDP message to a specific ip. Broadcast?
-  void sendMessageUDP(IPAddress ip, JsonObject var, JsonVariant value) {
-    if (0 != instanceUDP.beginPacket(ip, instanceUDPPort)) {
-
-      JsonDocument message;
-      message["pid"] = var["pid"];
-      message["id"] = var["id"];
-      message["value"] = value;
+  //called by the model if a dash var changed, broadcasted in loop20ms
+  void varChanged(JsonObject var) {
+    uint16_t handle = var["h"];
+    for (uint16_t changedHandle: changedVars)
+      if (changedHandle == handle) return; //the value is read when sending
+    changedVars.push_back(handle);
+  }
 
-      size_t len = measureJson(message);
+  //broadcast the current values of changedVars, the sysinfo message has the values of all dash vars
+  void sendChangedVarsUDP() {
+    if (!mdls->isConnected || !udp2Connected) return;
+
+    UDPVarsMessage message;
+    memcpy(message.token, "SLvr", 4);
+    message.varData[0] = binVars;
+    size_t len = 1;
+    for (uint16_t handle: changedVars) {
+      JsonObject var = mdl->findVar(handle);
+      if (var.isNull()) continue;
+      uint8_t size = writeVarRecord(message.varData + len, sizeof(message.varData) - len, var, var["value"]);
+      if (size == 0 && len > 1) { //full: send and continue in a new message
+        sendVarsUDP(IPAddress(255, 255, 255, 255), message, len);
+        len = 1;
+        size = writeVarRecord(message.varData + len, sizeof(message.varData) - len, var, var["value"]);
+      }
+      if (size == 0) ppf("dev sendChangedVarsUDP %s.%s does not fit\n", Variable(var).pid(), Variable(var).id());
+      len += size;
+    }
+    if (len > 1) sendVarsUDP(IPAddress(255, 255, 255, 255), message, len);
+  }
 
-      char buffer[len];
+  //set var of the instance with ip to value
+  void sendSetVarUDP(IPAddress ip, JsonObject var, JsonVariant value) {
+    if (!udp2Connected) return;
 
-      serializeJson(message, buffer, len);
+    UDPVarsMessage message;
+    memcpy(message.token, "SLvs", 4);
+    message.varData[0] = binVars;
+    uint8_t size = writeVarRecord(message.varData + 1, sizeof(message.varData) - 1, var, value);
+    if (size) sendVarsUDP(ip, message, 1 + size);
+    ppf("sendSetVarUDP ip:%d %s.%s s:%d\n", ip[3], Variable(var).pid(), Variable(var).id(), size);
+  }
 
-      instanceUDP.write((byte *)buffer, len);
+  void sendVarsUDP(IPAddress ip, UDPVarsMessage &message, size_t len) {
+    if (0 != instanceUDP.beginPacket(ip, instanceUDPPort)) {
+      instanceUDP.write((byte *)&message, 4 + len);
       web->sendUDPCounter++;
-      web->sendUDPBytes+=len;
+      web->sendUDPBytes+=4 + len;
       instanceUDP.endPacket();
-      ppf("sendMessageUDP ip:%d b:%.*s\n", ip[3], len, buffer);
     }
   }
 
-  void updateInstance( UDPStarMessage udpStarMessage) {
+  //var record: keyLen, "pid.id", type, value
+  //  BinType (see SysModWeb.h) binInt, binFloat: 4 bytes little endian, binBool: 1 byte, binString, binJson: length byte + chars
+  //  varData starts with binVars, a keyLen of 0 or the end of the message ends the records
+  //returns the size of the record, 0 if it does not fit in room
+  uint8_t writeVarRecord(byte *record, size_t room, JsonObject var, JsonVariant value) {
+    Variable variable = Variable(var);
+
+    char key[64];
+    int keyLen = snprintf(key, sizeof(key), "%s.%s", variable.pid(), variable.id());
+    if (keyLen >= sizeof(key) || 1 + keyLen + 2 > room) return 0;
+    record[0] = keyLen;
+    memcpy(record + 1, key, keyLen);
+    size_t size = 1 + keyLen;
+
+    if (value.is<bool>()) {
+      record[size++] = binBool;
+      record[size++] = value.as<bool>();
+    } else if (value.is<int>() || value.is<float>()) {
+      if (size + 5 > room) return 0;
+      record[size++] = value.is<int>()?binInt:binFloat;
+      if (value.is<int>()) {
+        int32_t intValue = value;
+        memcpy(record + size, &intValue, 4);
+      } else {
+        float floatValue = value;
+        memcpy(record + size, &floatValue, 4);
+      }
+      size += 4;
+    } else {
+      record[size++] = value.is<const char *>()?binString:binJson;
+      size_t len = value.is<const char *>()?strlen(value.as<const char *>()):measureJson(value);
+      if (len > UINT8_MAX || size + 1 + len > room || size + 1 + len > UINT8_MAX) return 0;
+      record[size++] = len;
+      if (value.is<const char *>())
+        memcpy(record + size, value.as<const char *>(), len);
+      else {
+        char json[len + 1];
+        serializeJson(value, json, len + 1);
+        memcpy(record + size, json, len);
+      }
+      size += len;
+    }
+    return size;
+  }
+
+  //set the values in values (by id, in place: no document per message) and if apply also in the model
+  void readVarRecords(const byte *varData, size_t len, JsonDocument &values, bool apply) {
+    if (len == 0 || varData[0] != binVars) return; //not from this version
+    if (!values.is<JsonObject>()) values.to<JsonObject>();
+
+    size_t pos = 1;
+    while (pos < len && varData[pos] != 0) {
+      uint8_t keyLen = varData[pos];
+      if (keyLen >= 64 || pos + 1 + keyLen + 1 >= len) break;
+      char key[64];
+      memcpy(key, varData + pos + 1, keyLen);
+      key[keyLen] = '\0';
+      pos += 1 + keyLen;
+
+      uint8_t type = varData[pos++];
+      const byte * value = varData + pos;
+      size_t valueLen = (type == binBool)?1:(type == binInt || type == binFloat)?4:1 + value[0];
+      if (pos + valueLen > len) break;
+      pos += valueLen;
+
+      char * id = strchr(key, '.');
+      if (!id) continue;
+      *id++ = '\0';
+
+      switch (type) {
+        case binBool: values[id] = value[0] != 0; break;
+        case binInt: {int32_t intValue; memcpy(&intValue, value, 4); values[id] = intValue; break;}
+        case binFloat: {float floatValue; memcpy(&floatValue, value, 4); values[id] = floatValue; break;}
+        case binString: values[id] = JsonString((const char *)value + 1, value[0], JsonString::Copied); break;
+        case binJson: {JsonDocument doc; deserializeJson(doc, (const char *)value + 1, value[0]); values[id] = doc; break;}
+        default: continue;
+      }
+
+      if (apply) {
+        JsonObject var = mdl->findVar(key, id);
+        if (!var.isNull()) mdl->setValueJV(var, values[id]);
+      }
+    }
+  }
+
+  //is insName in the same group as this instance
+  bool inGroup(const char * insName) {
+    char group1[32];
+    char group2[32];
+    return groupOfName(insName, group1) && groupOfName(mdl->getValue("System", "name"), group2) && strncmp(group1, group2, sizeof(group1)) == 0;
+  }
+
+  void updateInstance(UDPStarMessage &udpStarMessage) {
     IPAddress messageIP = IPAddress(udpStarMessage.header.ip0, udpStarMessage.header.ip1, udpStarMessage.header.ip2, udpStarMessage.header.ip3);
 
     bool instanceFound = false;
@@ -722,66 +959,25 @@ public:
         if (udpStarMessage.sysData.type >= 1) {//StarBase, StarLight and forks only
           instance.sysData = udpStarMessage.sysData;
 
-          if (instance.ip != net->localIP()) { //send from localIP will be done after updateInstance
-            char group1[32];
-            char group2[32];
-            if (groupOfName(instance.name, group1) && groupOfName(mdl->getValue("System", "name"), group2) && strncmp(group1, group2, sizeof(group1)) == 0) {
-
-              uint32_t t = instance.sysData.now;
-              t += PRESUMED_NETWORK_DELAY; //adjust trivially for network delay
-              t -= millis();
-              sys->timebase = t;
-              // timebaseUpdated = true;
-
-              Toki::Time tm;
-              tm.sec = instance.sysData.tokiTime;
-              tm.ms = instance.sysData.tokiMs;
-              if (instance.sysData.timeSource > sys->toki.getTimeSource() || sys->toki.getTimeSource() == TOKI_TS_NONE) { //if sender's time source is more accurate
-                sys->toki.adjust(tm, PRESUMED_NETWORK_DELAY); //adjust trivially for network delay
-                uint8_t ts = TOKI_TS_UDP; //5
-                if (instance.sysData.timeSource > 99) ts = TOKI_TS_UDP_NTP; //110
-                else if (instance.sysData.timeSource >= TOKI_TS_SEC) ts = TOKI_TS_UDP_SEC; //20
-                sys->toki.setTime(tm, ts);
-              } else if (/*timebaseUpdated && */ sys->toki.getTimeSource() > 99) { //if we both have good times, get a more accurate timebase
-                Toki::Time myTime = sys->toki.getTime();
-                uint32_t diff = sys->toki.msDifference(tm, myTime);
-                sys->timebase -= PRESUMED_NETWORK_DELAY; //no need to presume, use difference between NTP times at send and receive points
-                if (sys->toki.isLater(tm, myTime)) {
-                  sys->timebase += diff;
-                } else {
-                  sys->timebase -= diff;
-                }
-              }
-
-              //set instance.jsonData from new string
-              JsonDocument newData;
-              DeserializationError error = deserializeJson(newData, udpStarMessage.jsonString);
-              if (error || !newData.is<JsonObject>()) {
-                // ppf("dev updateInstance json failed ip:%d e:%s\n", instance.ip[3], error.c_str(), udpStarMessage.jsonString);
-                //failed because some instances not on latest firmware, so turned off temporarily (tbd/wip)
-              }
-              else {
-                //check if instance belongs to the same group
-
-                for (JsonPair pair: newData.as<JsonObject>()) {
-                  // ppf("updateInstance sync from i:%s k:%s v:%s\n", instance.name, pair.key().c_str(), pair.value().as<String>().c_str());
-
-                  char pid[32];
-                  strlcpy(pid, pair.key().c_str(), sizeof(pid));
-                  char * id = strtok(pid, ".");
-                  if (id != NULL ) {
-                    strlcpy(pid, id, sizeof(pid)); //copy the id part
-                    id = strtok(NULL, "."); //the rest after .
-                  }
-
-                  mdl->setValueJV(mdl->findVar(pid, id), pair.value());
-                }
-                instance.jsonData = newData; // deepcopy: https://github.com/bblanchon/ArduinoJson/issues/1023
-                // ppf("updateInstance json ip:%d", instance.ip[3]);
-                // print->printJson(" d:", instance.jsonData);
-              }
+          bool sameGroup = instance.ip != net->localIP() && inGroup(instance.name);
+
+          if (sameGroup) {
+            //sys->timebase is set by the clock sync (handleClockMessage)
+
+            Toki::Time tm;
+            tm.sec = instance.sysData.tokiTime;
+            tm.ms = instance.sysData.tokiMs;
+            if (instance.sysData.timeSource > sys->toki.getTimeSource() || sys->toki.getTimeSource() == TOKI_TS_NONE) { //if sender's time source is more accurate
+              sys->toki.adjust(tm, PRESUMED_NETWORK_DELAY); //adjust trivially for network delay
+              uint8_t ts = TOKI_TS_UDP; //5
+              if (instance.sysData.timeSource > 99) ts = TOKI_TS_UDP_NTP; //110
+              else if (instance.sysData.timeSource >= TOKI_TS_SEC) ts = TOKI_TS_UDP_SEC; //20
+              sys->toki.setTime(tm, ts);
             }
-          } //same group
+          }
+
+          //dash values of all instances are shown in the table, only applied if the same group
+          readVarRecords(udpStarMessage.varData, sizeof(udpStarMessage.varData), instance.jsonData, sameGroup);
         }
 
         //only update cell in instbl!
@@ -858,6 +1054,29 @@ public:
   }
 
   private:
+    std::vector<uint16_t> dashVars; //handles, found in setup
+
+    //clock sync
+    struct ClockSample {
+      int64_t offset; //µs to add to the local clock
+      int64_t delay; //round trip without the time in the master
+      int64_t localMicros; //when received
+    };
+    #define nrOfClockSamplesMax 8
+    ClockSample clockSamples[nrOfClockSamplesMax];
+    uint8_t clockSampleIndex = 0;
+    uint8_t nrOfClockSamples = 0;
+    IPAddress clockMaster;
+    int64_t clockOffset = 0;
+    int64_t clockSlew = 0; //µs the clock is ahead of the estimate (clockOffset), slewed to 0 in loop20ms
+    int64_t clockSlewMicros = 0;
+    #define clockSlewMax 1000 //µs per second
+    int64_t clockDelay = 0;
+    int64_t clockSyncedMicros = 0; //local µs of the offset
+    float clockDrift = 0; //µs per local µs
+    int64_t clockDriftMicros = 0; //reference sample for the drift
+    int64_t clockDriftOffset = 0;
+
     //sync (only WLED)
     WiFiUDP notifierUdp;
     uint16_t notifierUDPPort = 21324;
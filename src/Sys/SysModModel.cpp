@@ -25,6 +25,8 @@ SysModModel::SysModModel() :SysModule("Model") {
   if (files->readObjectFromFile("/model.json", model)) {//not part of success...
     // print->printJson("Read model", *model);
     // web->sendDataWs(*model);
+    uint16_t count = replayJournal();
+    if (count) ppf("Replayed %d changes from /model.jnl\n", count);
   } else {
     root = model->to<JsonArray>(); //re create the model as it is corrupted by readFromFile
   }
@@ -38,7 +40,7 @@ void SysModModel::setup() {
 
   ui->initButton(parentVar, "saveModel", false, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
     case onUI:
-      ui->setComment(var, "Write to model.json");
+      ui->setComment(var, "Write to model.json (changes are saved automatically)");
       return true;
     case onChange:
       doWriteModel = true;
@@ -78,25 +80,11 @@ void SysModModel::loop20ms() {
   }
 
   if (doWriteModel) {
-    ppf("Writing model to /model.json... (serializeConfig)\n");
-
-    // files->writeObjectToFile("/model.json", model);
-
-    cleanUpModel(JsonObject(), false, true);//remove if var["o"] is negative (not cleanedUp) and remove ro values
-
-    StarJson starJson("/model.json", "w"); //open fileName for deserialize
-    //comment exclusions out in case of generating model.json for github
-    starJson.addExclusion("fun");
-    starJson.addExclusion("dash");
-    starJson.addExclusion("o"); //order: this must be deleted as it will be used to check on reboot 
-    starJson.addExclusion("p"); //pointer
-    starJson.addExclusion("oldValue");
-    starJson.writeJsonDocToFile(model);
-
-    // print->printJson("Write model", *model); //this shows the model before exclusion
-
+    if (!snapshotSerializer) startSnapshot();
     doWriteModel = false;
   }
+
+  if (snapshotSerializer) writeSnapshotPart();
 }
 
 void SysModModel::loop1s() {
@@ -104,6 +92,197 @@ void SysModModel::loop1s() {
     ui->callVarFun(var, UINT8_MAX, onLoop1s);
     return false; //don't stop
   });
+
+  //append once a second, so multiple changes are one small write
+  //  not while writing a snapshot: the journal file is removed after it, records made meanwhile are written to the new journal
+  if (journal.size() && !snapshotSerializer) {
+    File f = files->open("/model.jnl", "a");
+    if (f) {
+      journalFileSize += f.write(journal.data(), journal.size());
+      f.close();
+    }
+    journal.clear();
+  }
+}
+
+void SysModModel::loop10s() {
+  //compaction: vars added (e.g. controls of a new effect) are not in the snapshot so their journal records would be lost
+  //  debounced: only if no vars were added / removed in the last 10s, so e.g. browsing effects doesn't write a snapshot each time
+  if (!snapshotSerializer && ((structureVersion != snapshotVersion && structureVersion == lastStructureVersion) || journalFileSize > 16384))
+    startSnapshot();
+  lastStructureVersion = structureVersion;
+}
+
+//record: size (including size and checksum), rowNr, type (BinType), key length, key (pid.id), value, checksum
+//  value: binInt, binFloat: 4 bytes, binBool: 1 byte, binString, binJson: length byte + chars
+void SysModModel::journalVar(JsonObject var, uint8_t rowNr) {
+  Variable variable = Variable(var);
+  //not saved in the snapshot, see cleanUpModel
+  if (variable.readOnly() || var["type"] == "button" || var["pid"] == "instances") return;
+
+  JsonVariant value = (rowNr == UINT8_MAX)?var["value"]:var["value"][rowNr];
+
+  byte record[UINT8_MAX];
+  int keyLen = snprintf((char *)record + 4, 64, "%s.%s", variable.pid(), variable.id());
+  if (keyLen >= 64) return;
+  uint8_t size = 4 + keyLen;
+
+  if (value.is<bool>()) {
+    record[2] = binBool;
+    record[size++] = value.as<bool>();
+  } else if (value.is<int>()) {
+    record[2] = binInt;
+    int32_t intValue = value;
+    memcpy(record + size, &intValue, 4); size += 4;
+  } else if (value.is<float>()) {
+    record[2] = binFloat;
+    float floatValue = value;
+    memcpy(record + size, &floatValue, 4); size += 4;
+  } else {
+    record[2] = value.is<const char *>()?binString:binJson;
+    size_t len = (record[2] == binString)?strlen(value.as<const char *>()):measureJson(value);
+    if (size + len + 2 > UINT8_MAX) {
+      snapshotVersion = UINT32_MAX; //too long for a record: compaction in loop10s saves it
+      return;
+    }
+    record[size++] = len;
+    if (record[2] == binString)
+      memcpy(record + size, value.as<const char *>(), len);
+    else
+      serializeJson(value, (char *)record + size, len + 1); //room for the null terminator (overwritten by the checksum)
+    size += len;
+  }
+
+  record[0] = size + 1;
+  record[1] = rowNr;
+  record[3] = keyLen;
+  uint8_t checksum = 0;
+  for (uint8_t i = 0; i < size; i++) checksum += record[i];
+  record[size++] = checksum;
+
+  journal.insert(journal.end(), record, record + size);
+}
+
+uint16_t SysModModel::replayJournal() {
+  File f = files->open("/model.jnl", "r");
+  if (!f) return 0;
+
+  uint16_t count = 0;
+  byte record[UINT8_MAX];
+  while (f.read(record, 1) == 1) {
+    uint8_t size = record[0];
+    //stop at a record which is not completely written (reboot while writing)
+    if (size < 6 || f.read(record + 1, size - 1) != size - 1) break;
+    uint8_t checksum = 0;
+    for (uint8_t i = 0; i < size - 1; i++) checksum += record[i];
+    if (checksum != record[size - 1]) break;
+
+    uint8_t rowNr = record[1];
+    char key[65];
+    uint8_t keyLen = min(record[3], (uint8_t)64);
+    memcpy(key, record + 4, keyLen); key[keyLen] = '\0';
+    char * id = strchr(key, '.');
+    if (!id) continue;
+    *id++ = '\0';
+
+    JsonObject var = findVar(key, id);
+    if (var.isNull()) continue; //var removed since the snapshot
+
+    const byte * valueStart = record + 4 + keyLen;
+    JsonDocument doc;
+    switch (record[2]) {
+      case binBool: doc.set(valueStart[0] != 0); break;
+      case binInt: {int32_t intValue; memcpy(&intValue, valueStart, 4); doc.set(intValue); break;}
+      case binFloat: {float floatValue; memcpy(&floatValue, valueStart, 4); doc.set(floatValue); break;}
+      case binString: doc.set(JsonString((const char *)valueStart + 1, valueStart[0], JsonString::Copied)); break;
+      case binJson: deserializeJson(doc, (const char *)valueStart + 1, valueStart[0]); break;
+      default: continue;
+    }
+
+    if (rowNr == UINT8_MAX) {
+      if (doc.isNull())
+        var.remove("value");
+      else
+        var["value"] = doc;
+    }
+    else {
+      if (!var["value"].is<JsonArray>()) var["value"].to<JsonArray>();
+      var["value"][rowNr] = doc;
+    }
+    count++;
+  }
+
+  journalFileSize = f.size();
+  f.close();
+  return count;
+}
+
+void SysModModel::startSnapshot() {
+  ppf("Writing model to /model.json... (serializeConfig)\n");
+
+  // files->writeObjectToFile("/model.json", model);
+
+  snapshotFile = files->open("/model.tmp", "w");
+  if (!snapshotFile) {
+    ppf("startSnapshot open /model.tmp failed\n");
+    return;
+  }
+
+  //the model is not changed: vars and their handles stay, ro values are left out of the file instead of removed
+  snapshotSerializer = new StarJsonSerializer(model->as<JsonVariant>());
+  //comment exclusions out in case of generating model.json for github
+  snapshotSerializer->addExclusion("fun");
+  snapshotSerializer->addExclusion("h"); //handle: assigned in initVar
+  snapshotSerializer->addExclusion("ver"); //version: restarts after boot
+  snapshotSerializer->addExclusion("dash");
+  snapshotSerializer->addExclusion("o"); //order: this must be deleted as it will be used to check on reboot 
+  snapshotSerializer->addExclusion("p"); //pointer
+  snapshotSerializer->addExclusion("oldValue");
+  //ro values and values of the instances table don't need to be saved (see journalVar)
+  snapshotSerializer->addExclusion([](JsonObject var, const char * key) {
+    return strcmp(key, "value") == 0 && (Variable(var).readOnly() || var["pid"] == "instances");
+  });
+  snapshotStructureVersion = structureVersion;
+  snapshotPartVersion = modelVersion;
+}
+
+void SysModModel::writeSnapshotPart() {
+  //vars or rows removed: the serializer iterates over them. A value longer than a part changed: printed half old, half new
+  if (structureVersion != snapshotStructureVersion || (snapshotSerializer->inValue() && modelVersion != snapshotPartVersion)) {
+    ppf("Writing model to /model.json stopped, model changed\n");
+    snapshotFile.close();
+    files->remove("/model.tmp");
+    delete snapshotSerializer;
+    snapshotSerializer = nullptr;
+    return; //loop10s starts again
+  }
+  snapshotPartVersion = modelVersion;
+
+  if (snapshotSerializer->next(snapshotFile, 1024)) return; //next part in the next loop20ms
+
+  snapshotFile.close();
+  delete snapshotSerializer;
+  snapshotSerializer = nullptr;
+  files->filesChanged = true;
+
+  // print->printJson("Write model", *model); //this shows the model before exclusion
+
+  //a reboot before the rename keeps the previous snapshot and its journal
+  files->rename("/model.tmp", "/model.json");
+  //a reboot before the remove replays records which are already in the snapshot: same values
+  //  journal (not written to the file yet) is kept: values changed while writing may be newer than the snapshot
+  files->remove("/model.jnl");
+  journalFileSize = 0;
+  snapshotVersion = snapshotStructureVersion;
+  ppf("Written model to /model.json\n");
+}
+
+void releaseHandles(JsonObject var) {
+  mdl->structureVersion = ++mdl->modelVersion; //clients with an older version need the whole model
+  uint16_t handle = var["h"] | UINT16_MAX;
+  if (handle < mdl->varsByHandle.size()) mdl->varsByHandle[handle] = JsonObject();
+  for (JsonObject childVar: Variable(var).children())
+    releaseHandles(childVar);
 }
 
 void SysModModel::cleanUpModel(JsonObject parent, bool oPos, bool ro) {
@@ -126,8 +305,10 @@ void SysModModel::cleanUpModel(JsonObject parent, bool oPos, bool ro) {
         if (oPos) {
           if (var["o"].isNull() || variable.order() >= 0) { //not set negative in initVar
             ppf("obsolete found %s removed: %d\n", variable.id(), showObsolete);
-            if (!showObsolete)
+            if (!showObsolete) {
+              releaseHandles(var);
               vars.remove(varV); //remove the obsolete var (no o or )
+            }
           }
           else {
             variable.order( -variable.order()); //make it possitive
@@ -135,6 +316,7 @@ void SysModModel::cleanUpModel(JsonObject parent, bool oPos, bool ro) {
         } else { //!oPos
           if (var["o"].isNull() || variable.order() < 0) { 
             ppf("cleanUpModel remove var %s (""o""<0)\n", variable.id());          
+            releaseHandles(var);
             vars.remove(varV); //remove the obsolete var (no o or o is negative - not cleanedUp)
           }
         }
@@ -246,7 +428,7 @@ bool SysModModel::callVarOnChange(JsonObject var, uint8_t rowNr, bool init) {
 
   if (!init) {
     if (checkDash(var))
-      instances->changedVarsQueue.push_back(var); //tbd: check value arrays / rowNr is working
+      instances->varChanged(var); //tbd: check value arrays / rowNr is working
   }
 
   //if var is bound by pointer, set the pointer value before calling onChange
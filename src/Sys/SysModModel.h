@@ -17,6 +17,8 @@
 
 typedef std::function<void(JsonObject)> FindFun;
 
+class StarJsonSerializer; //forward, see SysStarJson.h
+
 struct Coord3D {
   int x;
   int y;
@@ -190,6 +192,9 @@ struct RAM_Allocator: ArduinoJson::Allocator {
   }
 };
 
+//var and its children are removed from the model: their handles find nothing anymore, see SysModModel::findVar(handle)
+void releaseHandles(JsonObject var);
+
 class Variable {
   public:
 
@@ -309,6 +314,7 @@ class Variable {
             }
             if (allNull) {
               ppf("remove allnulls %s\n", childVariable.id());
+              releaseHandles(childVar);
               children().remove(childVarIt);
             }
             web->getResponseObject()["details"]["rowNr"] = rowNr;
@@ -324,6 +330,7 @@ class Variable {
               // setValue(var, -99, rowNr); //set value -99
             // childVariable.order(-childVariable.order());
             print->printJson("remove", childVar);
+            releaseHandles(childVar);
             children().remove(childVarIt);
           }
         }
@@ -352,12 +359,42 @@ public:
 
   uint8_t setValueRowNr = UINT8_MAX;
   uint8_t getValueRowNr = UINT8_MAX;
+  //getValueRowNr for code running in workerTask (e.g. layers rendered on the other core), as getValueRowNr is used by the loop task
+  TaskHandle_t workerTask = nullptr;
+  uint8_t getValueRowNrWorker = UINT8_MAX;
   int varCounter = 1; //start with 1 so it can be negative, see var["o"]
+  std::vector<JsonObject> varsByHandle; //index is var["h"], set in initVar
+  //var["ver"] is set to ++modelVersion when its value changes, clients resume from the version they have (see SysModWeb::syncClient)
+  uint32_t modelVersion = 0;
+  uint32_t structureVersion = 0; //modelVersion when vars or rows were last added / removed
+  uint32_t optionsVersion = 0; //modelVersion when options were last rebuilt by the server (not in the model, clients need the whole model)
+  uint32_t modelBoot = esp_random() | 1; //versions restart after a reboot, 0 is used by clients without model
+
+  //value changes are appended to /model.jnl and replayed on top of /model.json at boot
+  //  /model.json (snapshot) is rewritten if the journal grows or vars have been added (compaction)
+  std::vector<byte> journal; //records not written to /model.jnl yet (loop1s)
+  size_t journalFileSize = 0;
+  uint32_t snapshotVersion = 0; //structureVersion of the last snapshot
+  uint32_t lastStructureVersion = 0; //structureVersion at the previous loop10s, see debounce
+  //the snapshot is written a part at a time in loop20ms, so a big model doesn't stall the loop
+  StarJsonSerializer *snapshotSerializer = nullptr; //not nullptr while writing
+  File snapshotFile;
+  uint32_t snapshotStructureVersion = 0; //structureVersion when the snapshot being written started
+  uint32_t snapshotPartVersion = 0; //modelVersion when the previous part was written
 
   SysModModel();
   void setup();
   void loop20ms();
   void loop1s();
+  void loop10s();
+
+  //add a record with the value of var to the journal
+  void journalVar(JsonObject var, uint8_t rowNr = UINT8_MAX);
+  //apply the records in /model.jnl to the model, returns the number of records applied
+  uint16_t replayJournal();
+  //write the model to /model.json via a temp file and remove the journal, the model itself is not changed
+  void startSnapshot();
+  void writeSnapshotPart();
   
   //scan all vars in the model and remove vars where var["o"] is negative or positive, if ro then remove ro values
   void cleanUpModel(JsonObject parent = JsonObject(), bool oPos = true, bool ro = false);
@@ -450,7 +487,11 @@ public:
       }
     }
 
-    if (changed) callVarOnChange(var, rowNr);
+    if (changed) {
+      var["ver"] = ++modelVersion;
+      if (cleanUpModelDone) journalVar(var, rowNr); //not the values set during setup
+      callVarOnChange(var, rowNr);
+    }
     
     return var;
   }
@@ -482,7 +523,7 @@ public:
     Variable variable = Variable(var);
     if (var["value"].is<JsonArray>()) {
       JsonArray valueArray = variable.valArray();
-      if (rowNr == UINT8_MAX) rowNr = getValueRowNr;
+      if (rowNr == UINT8_MAX) rowNr = (workerTask && xTaskGetCurrentTaskHandle() == workerTask)?getValueRowNrWorker:getValueRowNr;
       if (rowNr != UINT8_MAX && rowNr < valueArray.size())
         return valueArray[rowNr];
       else if (valueArray.size())
@@ -499,6 +540,10 @@ public:
   //returns the var defined by id (parent to recursively call findVar)
   bool walkThroughModel(std::function<bool(JsonObject)> fun, JsonObject parent = JsonObject());
   JsonObject findVar(const char * pid, const char * id, JsonObject parent = JsonObject());
+  //find var by var["h"] (binary ws protocol), null if the var has been removed (see releaseHandles)
+  JsonObject findVar(uint16_t handle) {
+    return handle < varsByHandle.size()?varsByHandle[handle]:JsonObject();
+  }
   void findVars(const char * id, bool value, FindFun fun, JsonArray parent = JsonArray());
 
   //recursively add values in  a variant, currently not used
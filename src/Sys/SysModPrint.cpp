@@ -49,6 +49,9 @@ SysModPrint::SysModPrint() :SysModule("Print") {
   }
   Serial.println("Ready.\n");
   if (Serial) Serial.flush(); // drain output buffer
+
+  //lowest priority: printing to Serial or UI never takes time from the frames
+  xTaskCreate(printTask, "printTask", 4096, this, tskIDLE_PRIORITY + 1, &printTaskHandle);
 };
 
 void SysModPrint::setup() {
@@ -57,7 +60,7 @@ void SysModPrint::setup() {
   parentVar = ui->initSysMod(parentVar, name, 2302);
 
   //default to Serial
-  ui->initSelect(parentVar, "output", 1, false, [](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+  ui->initSelect(parentVar, "output", &output, false, [](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
     case onUI:
     {
       JsonArray options = ui->setOptions(var);
@@ -79,44 +82,86 @@ void SysModPrint::loop20ms() {
 }
 
 void SysModPrint::printf(const char * format, ...) {
+  if (output == 0) return; //No
+
   va_list args;
 
   va_start(args, format);
 
-  uint8_t output = 1; //default serial
   char buffer[512]; //this is a lot for the stack - move to heap?
-  vsnprintf(buffer, sizeof(buffer)-1, format, args);
-  bool toSerial = false;
-  
-  if (mdls->isConnected) {
-    if (mdl->model)
-      output = mdl->getValue("Print", "output"); //"Print", 
-
-    if (output == 1) {
-      toSerial = true;
-    }
-    else if (output == 2) {
-      JsonObject responseObject = web->getResponseObject();
-      if (responseObject["Print.log"]["value"].isNull())
-        responseObject["Print.log"]["value"] = buffer;
-      else
-        responseObject["Print.log"]["value"] = responseObject["Print.log"]["value"].as<String>() + String(buffer);
-      // web->addResponse(var, "value", JsonString(buffer, JsonString::Copied)); //setValue not necessary
-      // mdl->setValue(var, "%s", buffer);
-    }
-    else if (output == 3) {
-      //tbd
+  size_t len = 0;
+  if (strncmp(pcTaskGetTaskName(NULL), "loopTask", 9) != 0) { //looptask λ/ asyncTCP task α
+    strcpy(buffer, "α");
+    len = strlen(buffer);
+  }
+  int formatLen = vsnprintf(buffer + len, sizeof(buffer) - len, format, args);
+
+  va_end(args);
+
+  if (formatLen <= 0) return;
+  len = min(len + formatLen, sizeof(buffer) - 1); //truncated
+
+  //claim consecutive slots, lock-free as ppf is called from all tasks
+  uint32_t nrOfSlots = (len + printSlotSize - 1) / printSlotSize;
+  uint32_t write = writeIndex.load(std::memory_order_relaxed);
+  do {
+    if (write + nrOfSlots - readIndex.load(std::memory_order_acquire) > nrOfPrintSlots) {
+      droppedLines++;
+      return;
     }
+  } while (!writeIndex.compare_exchange_weak(write, write + nrOfSlots, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+  for (size_t i = 0; i < nrOfSlots; i++) {
+    PrintSlot &slot = printSlots[(write + i) % nrOfPrintSlots];
+    slot.len = min(len - i * printSlotSize, (size_t)printSlotSize);
+    memcpy(slot.text, buffer + i * printSlotSize, slot.len);
+    slot.ready.store(true, std::memory_order_release);
   }
-  else
-    toSerial = true;
+}
 
-  if (toSerial) {
-    Serial.print(strncmp(pcTaskGetTaskName(NULL), "loopTask", 9) == 0?"":"α"); //looptask λ/ asyncTCP task α
-    Serial.print(buffer);
+void SysModPrint::printTask(void * parameter) {
+  SysModPrint * print = (SysModPrint *)parameter;
+  for (;;) {
+    print->drain();
+    vTaskDelay(pdMS_TO_TICKS(20));
   }
+}
 
-  va_end(args);
+void SysModPrint::drain() {
+  char batch[1024]; //lines for the UI are send as one message
+  size_t batchLen = 0;
+  bool toUI = output == 2 && mdls->isConnected;
+
+  auto sendBatch = [&batch, &batchLen]() {
+    JsonDocument logDoc;
+    logDoc["Print.log"]["value"] = JsonString(batch, batchLen, JsonString::Copied);
+    web->sendDataWs(logDoc.as<JsonVariant>());
+    batchLen = 0;
+  };
+
+  //only what is in the ring now, prints done while draining (e.g. by sendDataWs) are for the next drain
+  uint32_t end = writeIndex.load(std::memory_order_acquire);
+  uint32_t read = readIndex.load(std::memory_order_relaxed);
+  while (read != end) {
+    PrintSlot &slot = printSlots[read % nrOfPrintSlots];
+    if (!slot.ready.load(std::memory_order_acquire)) break; //still being written
+
+    if (toUI) {
+      if (batchLen + slot.len > sizeof(batch)) sendBatch();
+      memcpy(batch + batchLen, slot.text, slot.len);
+      batchLen += slot.len;
+    }
+    else
+      Serial.write(slot.text, slot.len);
+
+    slot.ready.store(false, std::memory_order_relaxed);
+    readIndex.store(++read, std::memory_order_release);
+  }
+
+  if (batchLen) sendBatch();
+
+  uint32_t dropped = droppedLines.exchange(0);
+  if (dropped) Serial.printf("printf %u lines dropped\n", dropped);
 }
 
 void SysModPrint::println(const __FlashStringHelper * x) {
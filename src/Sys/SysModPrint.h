@@ -11,8 +11,11 @@
 
 #pragma once
 #include "SysModule.h"
+#include <atomic>
 
 #define ppf(x...) print->printf(x)
+//debug prints (e.g. on hot paths) in SysModule member functions: only if printLevel of the module is Debug, checked before formatting
+#define ppfd(x...) do { if (printLevel >= 1) print->printf(x); } while (0)
 // #define ppf(x...) //to have no print code compiled, difference is only 6308 bytes 
 // Flash: [======    ]  62.8% (used 1194250 bytes from 1900544 bytes)
 // Flash: [======    ]  63.2% (used 1200558 bytes from 1900544 bytes)
@@ -25,7 +28,7 @@ public:
   void setup();
   void loop20ms();
 
-  //generic print function
+  //generic print function: formats into the print ring buffer, printTask sends it to Serial or UI
   void printf(const char * format, ...);
 
   //not used yet
@@ -40,8 +43,27 @@ public:
 
   void printJDocInfo(const char * text, JsonDocument source);
 
+  uint8_t output = 1; //0: No, 1: Serial, 2: UI, set by the output var
+
 private:
   bool setupsDone = false;
+
+  //lock-free ring of text slots: printf claims consecutive slots with compare and swap, printTask drains them in order
+  static constexpr uint8_t printSlotSize = 64;
+  static constexpr uint8_t nrOfPrintSlots = 64; //power of 2 as the indexes wrap around
+  struct PrintSlot {
+    std::atomic<bool> ready{false};
+    uint8_t len = 0;
+    char text[printSlotSize];
+  };
+  PrintSlot printSlots[nrOfPrintSlots];
+  std::atomic<uint32_t> writeIndex{0}; //slots claimed by printf
+  std::atomic<uint32_t> readIndex{0}; //slots drained by printTask
+  std::atomic<uint32_t> droppedLines{0}; //ring full
+
+  TaskHandle_t printTaskHandle = nullptr;
+  static void printTask(void * parameter);
+  void drain();
 };
 
 extern SysModPrint *print;
\ No newline at end of file
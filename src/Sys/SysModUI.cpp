@@ -82,6 +82,7 @@ JsonObject SysModUI::initVar(JsonObject parent, const char * id, const char * ty
       // serializeJson(model, Serial);Serial.println();
     }
     var["id"] = JsonString(id, JsonString::Copied);
+    mdl->structureVersion = ++mdl->modelVersion; //clients with an older version need the whole model
   }
   // else {
   //   ppf("initVar Var %s->%s already defined\n", modelParentId, id);
@@ -97,6 +98,12 @@ JsonObject SysModUI::initVar(JsonObject parent, const char * id, const char * ty
 
     var["pid"] = parentId;
 
+    //numeric handle to address the var in binary ws messages, handles are not reused
+    if (var["h"].isNull()) {
+      var["h"] = mdl->varsByHandle.size();
+      mdl->varsByHandle.push_back(var);
+    }
+
     if (var["ro"].isNull() || variable.readOnly() != readOnly) variable.readOnly(readOnly);
 
     //set order. make order negative to check if not obsolete, see cleanUpModel
@@ -236,9 +243,9 @@ void SysModUI::processJson(JsonVariant json) {
         if (pid && id) {
           JsonObject var = mdl->findVar(pid, id);
 
-          ppf("processJson var %s.%s", pid, id);
-          if (rowNr != UINT8_MAX) ppf("[%d]", rowNr);
-          ppf(" %s -> %s\n", var["value"].as<String>().c_str(), newValue.as<String>().c_str());
+          ppfd("processJson var %s.%s", pid, id);
+          if (rowNr != UINT8_MAX) ppfd("[%d]", rowNr);
+          ppfd(" %s -> %s\n", var["value"].as<String>().c_str(), newValue.as<String>().c_str());
 
           if (!var.isNull())
           {
@@ -311,6 +311,7 @@ public:
   //checks if var has fun of type funType implemented by calling it and checking result (for onUI on RO var, also onSetValue is called)
   bool callVarFun(const char * pid, const char * id, uint8_t rowNr = UINT8_MAX, uint8_t funType = onSetValue) {
     JsonObject var = mdl->findVar(pid, id);
+    if (funType == onUI) mdl->optionsVersion = ++mdl->modelVersion; //options rebuilt: not in the model, clients need the whole model
     return callVarFun(var, rowNr, funType);
   }
 
@@ -353,6 +354,7 @@ public:
       //if delete, delete also from vector ...
       //find the columns of the table
       if (funType == onDelete) {
+        mdl->structureVersion = ++mdl->modelVersion; //row removed: clients with an older version need the whole model
         for (JsonObject childVar: variable.children()) {
           int pointer;
           if (childVar["p"].is<JsonArray>())
@@ -13,6 +13,7 @@
 #include "SysModModel.h"
 #include "SysModUI.h"
 #include "SysModFiles.h"
+#include "SysStarJson.h"
 #include "SysModules.h"
 #include "SysModPins.h"
 #include "SysModNetwork.h" //for localIP
@@ -143,14 +144,323 @@ void SysModWeb::setup() {
 
 }
 
-void SysModWeb::loop20ms() {
+//split a binVars message in records, see BinRecord
+static void decodeBinRecords(const byte * data, size_t len, std::vector<BinRecord> &records) {
+  size_t pos = 1; //skip binVars
+  while (pos + 5 <= len) { //smallest record is binBool
+    BinRecord record;
+    record.start = data + pos;
+    record.handle = data[pos] | data[pos+1] << 8;
+    record.rowNr = data[pos+2];
+    record.type = data[pos+3];
+    switch (record.type) {
+      case binInt:
+      case binFloat: record.size = 8; break;
+      case binString: record.size = 5 + data[pos+4]; break;
+      case binBool: record.size = 5; break;
+      default:
+        ppf("dev decodeBinRecords unknown type %d\n", record.type);
+        return;
+    }
+    if (pos + record.size > len) {
+      ppf("dev decodeBinRecords record %d truncated\n", record.handle);
+      return;
+    }
+    records.push_back(record);
+    pos += record.size;
+  }
+}
+
+ModelStream::~ModelStream() {
+  delete serializer;
+}
+
+void SysModWeb::loop() {
+  //serialize the model for /json/mdl requests, not in the AsyncTCP task as the model changes in loopTask
+  std::shared_ptr<ModelStream> stream;
+  while (modelStreamQueue.pop(stream)) {
+    stream->serializer = new StarJsonSerializer(mdl->model->as<JsonVariant>());
+    stream->structureVersion = mdl->structureVersion;
+    stream->partVersion = mdl->modelVersion;
+    modelStreams.push_back(stream);
+  }
+  stream.reset();
+  for (auto it = modelStreams.begin(); it != modelStreams.end(); ) {
+    if (it->use_count() == 1) { //response deleted (e.g. client disconnected)
+      it = modelStreams.erase(it);
+      continue;
+    }
+    ModelStream &modelStream = **it;
+    size_t space = ModelStream::size - (modelStream.head.load(std::memory_order_relaxed) - modelStream.tail.load(std::memory_order_acquire));
+    if (space < ModelStream::size / 2) { ++it; continue;} //wait until the client has read more
+    //vars or rows removed: the serializer iterates over them. A value longer than a part changed: it would be half old, half new
+    //  end the response, the client gets incomplete json and retries
+    bool more = false;
+    if (modelStream.structureVersion != mdl->structureVersion || (modelStream.serializer->inValue() && modelStream.partVersion != mdl->modelVersion))
+      ppf("serveJson model changed while sending, stopped\n");
+    else {
+      modelStream.partVersion = mdl->modelVersion;
+      modelStream.pending = 0;
+      more = modelStream.serializer->next(modelStream, space);
+      modelStream.head.store(modelStream.head.load(std::memory_order_relaxed) + modelStream.pending, std::memory_order_release);
+    }
+    if (more) ++it;
+    else {
+      modelStream.done.store(true, std::memory_order_release);
+      it = modelStreams.erase(it);
+    }
+  }
+
+  //apply the commands received by the AsyncTCP task. Modules loop one after the other so this is between frames
+  std::vector<WebCommand> commands;
+  WebCommand command;
+  while (commandQueue.pop(command))
+    commands.push_back(command);
+  if (commands.empty()) return;
+
+  std::vector<JsonDocument> docs(commands.size());
+  std::vector<std::vector<BinRecord>> binRecords(commands.size());
+  for (size_t i = 0; i < commands.size(); i++) {
+    if (commands[i].isBinary) {
+      decodeBinRecords((const byte *)commands[i].json, commands[i].len, binRecords[i]); //records point into json, freed after applying
+      continue;
+    }
+    DeserializationError error = deserializeJson(docs[i], commands[i].json, commands[i].len); //strings are copied into the doc
+    if (error)
+      ppf("wsEvent deserializeJson failed with code %s\n", error.c_str());
+    free(commands[i].json);
+    commands[i].json = nullptr;
+  }
+
+  //coalesce: a var set again in a later command (e.g. slider moves) is only set to the latest value
+  std::vector<const char *> laterKeys;
+  std::vector<uint32_t> laterHandles; //handle and rowNr
+  for (size_t i = docs.size(); i-- > 0;) {
+    for (size_t r = binRecords[i].size(); r-- > 0;) {
+      BinRecord &record = binRecords[i][r];
+      uint32_t handleRow = record.handle << 8 | record.rowNr;
+      if (std::find(laterHandles.begin(), laterHandles.end(), handleRow) != laterHandles.end())
+        record.stale = true;
+      else
+        laterHandles.push_back(handleRow);
+    }
+
+    JsonObject object = docs[i].as<JsonObject>();
+    if (object.isNull()) continue;
+    std::vector<const char *> staleKeys;
+    for (JsonPair pair: object) {
+      const char * key = pair.key().c_str();
+      if (pair.key() == "v" || pair.key() == "view" || pair.key() == "canvasData" || pair.key() == "theme" || pair.key() == "onAdd" || pair.key() == "onDelete" || pair.key() == "onUI" || pair.key() == "sync") continue; //not a var
+      if (std::find_if(laterKeys.begin(), laterKeys.end(), [key](const char * laterKey) {return strcmp(key, laterKey) == 0;}) != laterKeys.end())
+        staleKeys.push_back(key);
+      else
+        laterKeys.push_back(key);
+    }
+    for (const char * key: staleKeys)
+      object.remove(key);
+    if (!object["onAdd"].isNull() || !object["onDelete"].isNull()) {
+      laterKeys.clear(); //rowNrs change, do not coalesce over it
+      laterHandles.clear();
+    }
+  }
+
+  for (size_t i = 0; i < docs.size(); i++) {
+    WebClient * client = commands[i].clientId?ws.client(commands[i].clientId):nullptr; //nullptr if disconnected meanwhile
+
+    if (commands[i].isBinary) {
+      applyBinRecords(binRecords[i], client); //the broadcast is also the ack to the sending client
+      free(commands[i].json);
+      continue;
+    }
+
+    JsonObject object = docs[i].as<JsonObject>();
+
+    if (!object["sync"].isNull()) {
+      if (client) syncClient(client, object["sync"]["boot"], object["sync"]["version"]);
+      object.remove("sync");
+      if (object.size() == 0) continue;
+    }
+
+    if (object.isNull() || object.size() == 0) { //invalid or all vars set later
+      if (client) client->text("{\"success\":true}"); // we have to send something back otherwise WS connection closes
+      continue;
+    }
+
+    sendResponseObject(); //send pending loopTask responses first as the responseDoc is reused for this command
+    getResponseDoc()->set(docs[i]);
+    JsonObject responseObject = getResponseObject();
+
+    bool isOnUI = !responseObject["onUI"].isNull();
+    ui->processJson(responseObject); //adds to responseDoc / responseObject
+
+    if (responseObject.size()) {
+      if (isOnUI && client)
+        sendResponseObject(client); //onUI only send to requesting client async response
+      else if (!isOnUI)
+        sendResponseObject();
+      else
+        getResponseDoc()->to<JsonObject>(); //requesting client gone
+    }
+    else {
+      if (!isOnUI) //for onui we know json.remove(key) is done
+        ppf("wsEvent no responseDoc ui:%d\n", isOnUI);
+      if (client) client->text("{\"success\":true}"); // we have to send something back otherwise WS connection closes
+    }
+  }
+
+  //all commands applied: verbose answers include their changes
+  for (WebCommand &command: commands) {
+    if (!command.reply) continue;
+    serializeWled(command.reply->json, command.reply->url);
+    command.reply->ready.store(true, std::memory_order_release);
+  }
+}
+
+void SysModWeb::syncClient(WebClient * client, uint32_t boot, uint32_t version) {
+  JsonDocument syncDoc;
+  JsonObject sync = syncDoc["sync"].to<JsonObject>();
+  sync["boot"] = mdl->modelBoot;
+  sync["version"] = mdl->modelVersion;
+
+  //client model from before a reboot or vars added / removed since: the client needs the whole model
+  bool full = boot != mdl->modelBoot || version < mdl->structureVersion || version < mdl->optionsVersion || version > mdl->modelVersion;
+  if (full && boot != 0) {
+    ppf("syncClient %d full (boot %u version %u)\n", client->id(), boot, version);
+    sync["full"] = true; //client reloads and asks again without model
+    sendDataWs(syncDoc, client);
+    return;
+  }
+
+  JsonArray model = mdl->model->as<JsonArray>();
+
+  //inspired by https://github.com/bblanchon/ArduinoJson/issues/1280
+  //store arrayindex and sort order in vector
+  std::vector<ArrayIndexSortValue> aisvs;
+  size_t index = 0;
+  for (JsonObject moduleVar: model) {
+    ArrayIndexSortValue aisv;
+    aisv.index = index++;
+    aisv.value = Variable(moduleVar).order();
+    aisvs.push_back(aisv);
+  }
+  //sort the vector by the order
+  std::sort(aisvs.begin(), aisvs.end(), [](const ArrayIndexSortValue &a, const ArrayIndexSortValue &b) {return a.value < b.value;});
+
+  //send model or changed values per module to stay under websocket size limit of 8192
+  size_t nrOfChanges = 0;
+  for (const ArrayIndexSortValue &aisv : aisvs) {
+    if (full)
+      sendDataWs(model[aisv.index], client); //send definition to client
+    else {
+      JsonDocument patchDoc;
+      JsonObject patch = patchDoc.to<JsonObject>();
+      mdl->walkThroughModel([patch, version](JsonObject var) {
+        if (var["ver"].as<uint32_t>() > version) {
+          char pidid[64];
+          print->fFormat(pidid, sizeof(pidid), "%s.%s", var["pid"].as<const char *>(), var["id"].as<const char *>());
+          patch[pidid]["value"] = var["value"];
+        }
+        return false; //don't stop
+      }, model[aisv.index]);
+      if (patch.size()) {
+        nrOfChanges += patch.size();
+        sendDataWs(patch, client);
+      }
+    }
+  }
+
+  ppf("syncClient %d %s from version %u to %u (%d vars)\n", client->id(), full?"model":"changes", version, mdl->modelVersion, nrOfChanges);
+  sendDataWs(syncDoc, client); //last, so the client knows all before has been received
+}
+
+void SysModWeb::applyBinRecords(std::vector<BinRecord> &records, WebClient * client) {
+  sendResponseObject(); //send pending loopTask responses first, what is left after the records is send below
+
+  size_t len = 1; //binVars
+  for (BinRecord &record: records) {
+    if (record.stale) continue;
+
+    JsonObject var = mdl->findVar(record.handle);
+    if (var.isNull()) {
+      ppf("dev applyBinRecords var %d not found\n", record.handle);
+      record.stale = true; //not in the broadcast
+      continue;
+    }
+
+    const byte * value = record.start + 4;
+    JsonDocument valueDoc;
+    switch (record.type) {
+      case binInt: valueDoc.set((int32_t)(value[0] | value[1] << 8 | value[2] << 16 | value[3] << 24)); break;
+      case binFloat: {
+        float floatValue;
+        memcpy(&floatValue, value, sizeof(floatValue)); //little endian as ESP32
+        valueDoc.set(floatValue);
+        break; }
+      case binString: valueDoc.set(JsonString((const char *)value + 1, value[0], JsonString::Copied)); break;
+      case binBool: valueDoc.set(value[0] != 0); break;
+    }
+
+    //a button never sets the value
+    if (var["type"] == "button")
+      mdl->callVarOnChange(var, record.rowNr);
+    else
+      mdl->setValueJV(var, valueDoc.as<JsonVariant>(), record.rowNr);
+
+    //the value is in the broadcast, other responses (e.g. from onChange) are send as json
+    char pidid[64];
+    print->fFormat(pidid, sizeof(pidid), "%s.%s", var["pid"].as<const char *>(), var["id"].as<const char *>());
+    JsonObject responseObject = getResponseObject();
+    if (responseObject[pidid].is<JsonObject>()) {
+      responseObject[pidid].remove("value");
+      if (responseObject[pidid].size() == 0) responseObject.remove(pidid);
+    }
+
+    len += record.size;
+  }
 
-  //currently not used as each variable is send individually
-  if (this->modelUpdated) {
-    sendDataWs(*mdl->model); //send new data, all clients, no def
+  sendResponseObject();
 
-    this->modelUpdated = false;
+  if (len > 1) {
+    sendDataWs([&records](AsyncWebSocketMessageBuffer * wsBuf) {
+      byte * buffer = wsBuf->get();
+      buffer[0] = binVars;
+      size_t pos = 1;
+      for (BinRecord &record: records) {
+        if (record.stale) continue;
+        memcpy(buffer + pos, record.start, record.size);
+        pos += record.size;
+      }
+    }, len, true, nullptr, false); //not lossy: all clients need the values
+  }
+  else if (client) {
+    //all records stale (set again later) or not found: the client waits for an answer (jsonTimeout in index.js)
+    sendDataWs([](AsyncWebSocketMessageBuffer * wsBuf) {
+      wsBuf->get()[0] = binVars;
+    }, 1, true, client, false);
   }
+}
+
+bool SysModWeb::queueCommand(const char * json, size_t len, uint32_t clientId, bool isBinary, std::shared_ptr<WebReply> reply) {
+  WebCommand command;
+  command.json = (char *)malloc(len);
+  if (!command.json) {
+    ppf("dev queueCommand no memory for %d bytes\n", len);
+    return false;
+  }
+  memcpy(command.json, json, len);
+  command.len = len;
+  command.clientId = clientId;
+  command.isBinary = isBinary;
+  command.reply = reply;
+  if (!commandQueue.push(command)) {
+    ppf("dev queueCommand queue full, dropped %d bytes\n", len);
+    free(command.json);
+    return false;
+  }
+  return true;
+}
+
+void SysModWeb::loop20ms() {
 
   // if something changed in clients
   if (clientsChanged) {
@@ -237,25 +547,7 @@ void SysModWeb::wsEvent(WebSocket * ws, WebClient * client, AwsEventType type, v
 
     sendResponseObject(client);
 
-    JsonArray model = mdl->model->as<JsonArray>();
-
-    //inspired by https://github.com/bblanchon/ArduinoJson/issues/1280
-    //store arrayindex and sort order in vector
-    std::vector<ArrayIndexSortValue> aisvs;
-    size_t index = 0;
-    for (JsonObject moduleVar: model) {
-      ArrayIndexSortValue aisv;
-      aisv.index = index++;
-      aisv.value = Variable(moduleVar).order();
-      aisvs.push_back(aisv);
-    }
-    //sort the vector by the order
-    std::sort(aisvs.begin(), aisvs.end(), [](const ArrayIndexSortValue &a, const ArrayIndexSortValue &b) {return a.value < b.value;});
-
-    //send model per module to stay under websocket size limit of 8192
-    for (const ArrayIndexSortValue &aisv : aisvs) {
-      sendDataWs(model[aisv.index], client); //send definition to client
-    }
+    //the model is send when the client asks for it with sync, see syncClient
 
     clientsChanged = true;
   } else if (type == WS_EVT_DISCONNECT) {
@@ -279,29 +571,15 @@ void SysModWeb::wsEvent(WebSocket * ws, WebClient * client, AwsEventType type, v
           ppf("pong\n");
           client->text("pong");
         } else {
-          JsonDocument *responseDoc = getResponseDoc(); //we need the doc for deserializeJson
-          JsonObject responseObject = getResponseObject();
-
-          DeserializationError error = deserializeJson(*responseDoc, data, len); //data to responseDoc
-
-          if (error || responseObject.isNull()) {
-            ppf("wsEvent deserializeJson failed with code %s\n", error.c_str());
-            client->text("{\"success\":true}"); // we have to send something back otherwise WS connection closes
-          } else {
-            bool isOnUI = !responseObject["onUI"].isNull();
-            ui->processJson(responseObject); //adds to responseDoc / responseObject
-
-            if (responseObject.size()) {
-              sendResponseObject(isOnUI?client:nullptr); //onUI only send to requesting client async response
-            }
-            else {
-              if (!isOnUI) //for onui we know json.remove(key) is done
-                ppf("wsEvent no responseDoc ui:%d\n", isOnUI);
-              client->text("{\"success\":true}"); // we have to send something back otherwise WS connection closes
-            }
-          }
+          //processed by loopTask between frames (see loop), so model and effects are not changed while rendering
+          if (!queueCommand((const char *)data, len, client->id()))
+            client->text("{\"success\":false}"); // we have to send something back otherwise WS connection closes
         }
       }
+      else if (info->opcode == WS_BINARY && len > 0 && data[0] == binVars) {
+        if (!queueCommand((const char *)data, len, client->id(), true))
+          client->text("{\"success\":false}");
+      }
     } else {
       //message is comprised of multiple frames or the frame is split into multiple packets
       if(info->index == 0){
@@ -384,7 +662,7 @@ void SysModWeb::sendDataWs(JsonVariant json, WebClient * client) {
 }
 
 //https://kcwong-joe.medium.com/passing-a-function-as-a-parameter-in-c-a132e69669f6
-void SysModWeb::sendDataWs(std::function<void(AsyncWebSocketMessageBuffer *)> fill, size_t len, bool isBinary, WebClient * client) {
+void SysModWeb::sendDataWs(std::function<void(AsyncWebSocketMessageBuffer *)> fill, size_t len, bool isBinary, WebClient * client, bool lossy) {
 
   xSemaphoreTake(wsMutex, portMAX_DELAY);
 
@@ -403,7 +681,7 @@ void SysModWeb::sendDataWs(std::function<void(AsyncWebSocketMessageBuffer *)> fi
       for (auto &loopClient:ws.getClients()) {
         if (!client || client == loopClient) {
           if (loopClient->status() == WS_CONNECTED && !loopClient->queueIsFull()) { //WS_MAX_QUEUED_MESSAGES / ws.count() / 2)) { //binary is lossy
-            if (!isBinary || loopClient->queueLen() <= 3) {
+            if (!isBinary || !lossy || loopClient->queueLen() <= 3) {
               isBinary?loopClient->binary(wsBuf): loopClient->text(wsBuf);
               sendWsCounter++;
               if (isBinary)
@@ -441,12 +719,12 @@ void SysModWeb::serveIndex(WebRequest *request) {
 
   if (captivePortal(request)) return;
 
-  // if (handleIfNoneMatchCacheHeader(request)) return;
+  if (handleIfNoneMatchCacheHeader(request, PAGE_index_ETag)) return;
 
   WebResponse *response;
   response = request->beginResponse_P(200, "text/html", PAGE_index, PAGE_index_L);
   response->addHeader("Content-Encoding","gzip");
-  // setStaticContentCacheHeaders(response);
+  setStaticContentCacheHeaders(response, PAGE_index_ETag);
   request->send(response);
 
   ppf("!\n");
@@ -457,12 +735,12 @@ void SysModWeb::serveNewUI(WebRequest *request) {
 
   if (captivePortal(request)) return;
 
-  // if (handleIfNoneMatchCacheHeader(request)) return;
+  if (handleIfNoneMatchCacheHeader(request, PAGE_newui_ETag)) return;
 
   WebResponse *response;
   response = request->beginResponse_P(200, "text/html", PAGE_newui, PAGE_newui_L);
   response->addHeader("Content-Encoding","gzip");
-  // setStaticContentCacheHeaders(response);
+  setStaticContentCacheHeaders(response, PAGE_newui_ETag);
   request->send(response);
 
   ppf("!\n");
@@ -491,7 +769,9 @@ void SysModWeb::serveUpload(WebRequest *request, const String& fileName, size_t
     request->_tempFile.write(data,len);
   }
   if (final) {
+    String path = request->_tempFile.path();
     request->_tempFile.close();
+    files->fileWritten(path.c_str()); //a request during the upload may have cached a part with the version of the open
 
     mdl->setValue("Files", "upload", UINT16_MAX - 10); //success
     sendResponseObject(); //otherwise not send in asyn_tcp thread
@@ -556,14 +836,86 @@ void SysModWeb::serveUpdate(WebRequest *request, const String& fileName, size_t
   }
 }
 
+bool SysModWeb::handleIfNoneMatchCacheHeader(WebRequest *request, const char * eTag) {
+  if (request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value() == eTag) {
+    WebResponse *response = request->beginResponse(304); //not modified, browser uses its cache
+    setStaticContentCacheHeaders(response, eTag);
+    request->send(response);
+    ppf(" 304");
+    return true;
+  }
+  return false;
+}
+
+void SysModWeb::setStaticContentCacheHeaders(WebResponse *response, const char * eTag) {
+  //no-cache: browser may store but has to check the eTag (304) before using it, as the url stays the same for new builds / files
+  response->addHeader("Cache-Control", "no-cache");
+  response->addHeader("ETag", eTag);
+}
+
 void SysModWeb::serveFiles(WebRequest *request) {
 
   const char * urlString = request->url().c_str();
   const char * path = urlString + strnlen("/file", 6); //remove the uri from the path (skip their positions)
   ppf("fileServer request %s\n", path);
-  if(LittleFS.exists(path)) {
-    request->send(LittleFS, path, "text/plain");//"application/json");
+  File file;
+  if (LittleFS.exists(path)) file = LittleFS.open(path, "r");
+  if (!file) {
+    request->send(404, "text/plain", "Not found");
+    return;
+  }
+
+  size_t fileSize = file.size();
+
+  //size and version of the file in this boot identify the content (versions restart after a reboot)
+  char eTag[32];
+  print->fFormat(eTag, sizeof(eTag), "\"%x-%x-%x\"", fileSize, mdl->modelBoot, files->fileVersion(path));
+  if (handleIfNoneMatchCacheHeader(request, eTag)) return;
+
+  //range requests, e.g. to resume large fixtures or live scripts: bytes=start-[end] or bytes=-suffixLength (last bytes)
+  size_t start = 0;
+  size_t end = fileSize?fileSize - 1:0;
+  bool isRange = false;
+  if (request->hasHeader("Range") && fileSize) {
+    const char * range = request->getHeader("Range")->value().c_str();
+    if (strncmp(range, "bytes=", 6) == 0) {
+      bool satisfiable = true;
+      if (range[6] == '-') { //suffix range
+        unsigned long suffixLength = strtoul(range + 7, nullptr, 10);
+        satisfiable = suffixLength > 0;
+        if (suffixLength < fileSize) start = fileSize - suffixLength;
+      }
+      else {
+        char * endPtr;
+        start = strtoul(range + 6, &endPtr, 10);
+        if (*endPtr == '-' && isdigit(*(endPtr + 1)))
+          end = min(strtoul(endPtr + 1, nullptr, 10), (unsigned long)fileSize - 1);
+        satisfiable = start <= end;
+      }
+      if (!satisfiable) {
+        WebResponse *response = request->beginResponse(416); //range not satisfiable
+        response->addHeader("Content-Range", String("bytes */") + fileSize);
+        request->send(response);
+        return;
+      }
+      isRange = true;
+    }
   }
+
+  //chunked from the file, not loaded in memory
+  file.seek(start);
+  WebResponse *response = request->beginResponse("text/plain", end - start + 1, [file](uint8_t *buffer, size_t maxLen, size_t index) mutable -> size_t {
+    return file.read(buffer, maxLen);
+  }); //file closed when the response is deleted
+  if (isRange) {
+    response->setCode(206);
+    char contentRange[48];
+    print->fFormat(contentRange, sizeof(contentRange), "bytes %d-%d/%d", start, end, fileSize);
+    response->addHeader("Content-Range", contentRange);
+  }
+  response->addHeader("Accept-Ranges", "bytes");
+  setStaticContentCacheHeaders(response, eTag);
+  request->send(response);
 }
 
 void SysModWeb::jsonHandler(WebRequest *request, JsonVariant json) {
@@ -572,11 +924,34 @@ void SysModWeb::jsonHandler(WebRequest *request, JsonVariant json) {
 
   JsonObject responseObject = getResponseObject();
 
-  ui->processJson(json);
+  std::shared_ptr<WebReply> reply;
+  if (json["onUI"].isNull()) {
+    //changes are applied by loopTask between frames (see loop), responses go to all ws clients from there
+    String jsonStr;
+    serializeJson(json, jsonStr);
+    if (json["v"]) { //WLED compatibility: verbose response, made after the change is applied
+      reply = std::make_shared<WebReply>();
+      reply->url = request->url();
+    }
+    if (!queueCommand(jsonStr.c_str(), jsonStr.length(), 0, false, reply))
+      reply = nullptr;
+  }
+  else
+    ui->processJson(json); //onUI only collects options, answered directly
 
   //WLED compatibility
-  if (json["v"]) { //WLED compatibility: verbose response
-    serveJson (request); //includes values just updated by processJson e.g. Bri
+  if (json["v"] && reply) {
+    WebResponse *response = request->beginChunkedResponse("application/json", [reply](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+      if (!reply->ready.load(std::memory_order_acquire)) return RESPONSE_TRY_AGAIN; //not applied yet
+      size_t len = min(maxLen, reply->json.length() - reply->offset); //0 bytes ends the response
+      memcpy(buffer, reply->json.c_str() + reply->offset, len);
+      reply->offset += len;
+      return len;
+    });
+    request->send(response);
+  }
+  else if (json["v"]) { //onUI or not queued: the current state
+    serveJson (request);
   }
   else {
   
@@ -667,71 +1042,94 @@ void SysModWeb::sendResponseObject(WebClient * client) {
   }
 }
 
-void SysModWeb::serializeState(JsonObject root) {
-    const char* jsonState;// = "{\"transition\":7,\"ps\":9,\"pl\":-1,\"nl\":{\"on\":false,\"dur\":60,\"mode\":1,\"tbri\":0,\"rem\":-1},\"udpn\":{\"send\":false,\"recv\":true},\"lor\":0,\"mainseg\":0,\"seg\":[{\"id\":0,\"start\":0,\"stop\":144,\"len\":144,\"grp\":1,\"spc\":0,\"of\":0,\"on\":true,\"frz\":false,\"bri\":255,\"cct\":127,\"col\":[[182,15,98,0],[0,0,0,0],[255,224,160,0]],\"fx\":0,\"sx\":128,\"ix\":128,\"pal\":11,\"c1\":8,\"c2\":20,\"c3\":31,\"sel\":true,\"rev\":false,\"mi\":false,\"o1\":false,\"o2\":false,\"o3\":false,\"ssim\":0,\"mp12\":1}]}";
-    jsonState = "{\"on\":true,\"bri\":60,\"transition\":7,\"ps\":1,\"pl\":-1,\"AudioReactive\":{\"on\":true},\"nl\":{\"on\":false,\"dur\":60,\"mode\":1,\"tbri\":0,\"rem\":-1},\"udpn\":{\"send\":false,\"recv\":true,\"sgrp\":1,\"rgrp\":1},\"lor\":0,\"mainseg\":0,\"seg\":[{\"id\":0,\"start\":0,\"stop\":16,\"startY\":0,\"stopY\":16,\"len\":16,\"grp\":1,\"spc\":0,\"of\":0,\"on\":true,\"frz\":false,\"bri\":255,\"cct\":127,\"set\":0,\"col\":[[255,160,0],[0,0,0],[0,255,200]],\"fx\":139,\"sx\":240,\"ix\":236,\"pal\":11,\"c1\":255,\"c2\":64,\"c3\":16,\"sel\":true,\"rev\":false,\"mi\":false,\"rY\":false,\"mY\":false,\"tp\":false,\"o1\":false,\"o2\":true,\"o3\":false,\"si\":0,\"m12\":0}],\"ledmap\":0}";
-    JsonDocument docState;
-    deserializeJson(root, jsonState);
+//constant parts of the WLED state and info (without the opening brace), the variable parts are put in front by serializeState / serializeInfo
+static const char wledStateTail[] PROGMEM = "\"transition\":7,\"ps\":1,\"pl\":-1,\"AudioReactive\":{\"on\":true},\"nl\":{\"on\":false,\"dur\":60,\"mode\":1,\"tbri\":0,\"rem\":-1},\"udpn\":{\"send\":false,\"recv\":true,\"sgrp\":1,\"rgrp\":1},\"lor\":0,\"mainseg\":0,\"seg\":[{\"id\":0,\"start\":0,\"stop\":16,\"startY\":0,\"stopY\":16,\"len\":16,\"grp\":1,\"spc\":0,\"of\":0,\"on\":true,\"frz\":false,\"bri\":255,\"cct\":127,\"set\":0,\"col\":[[255,160,0],[0,0,0],[0,255,200]],\"fx\":139,\"sx\":240,\"ix\":236,\"pal\":11,\"c1\":255,\"c2\":64,\"c3\":16,\"sel\":true,\"rev\":false,\"mi\":false,\"rY\":false,\"mY\":false,\"tp\":false,\"o1\":false,\"o2\":true,\"o3\":false,\"si\":0,\"m12\":0}],\"ledmap\":0}";
+static const char wledInfoTail[] PROGMEM = "\"ver\":\"0.14.1-b30.36\",\"rel\":\"abc_wled_controller_v43_M\",\"vid\":2402252,\"leds\":{\"count\":1024,\"countP\":1024,\"pwr\":1124,\"fps\":32,\"maxpwr\":9500,\"maxseg\":32,\"matrix\":{\"w\":32,\"h\":32},\"seglc\":[1],\"lc\":1,\"rgbw\":false,\"wv\":0,\"cct\":0},\"str\":false,\"udpport\":21324,\"live\":false,\"liveseg\":-1,\"lm\":\"\",\"lip\":\"\",\"ws\":2,\"fxcount\":195,\"palcount\":75,\"cpalcount\":0,\"maps\":[{\"id\":0}],\"outputs\":[1024],\"wifi\":{\"bssid\":\"\",\"rssi\":0,\"signal\":100,\"channel\":1},\"fs\":{\"u\":20,\"t\":983,\"pmt\":0},\"ndc\":16,\"arch\":\"esp32\",\"core\":\"v3.3.6-16-gcc5440f6a2\",\"lwip\":0,\"totalheap\":294784,\"getflash\":4194304,\"freeheap\":115988,\"freestack\":6668,\"minfreeheap\":99404,\"e32core0code\":12,\"e32core0text\":\"SW restart\",\"e32core1code\":12,\"e32core1text\":\"SW restart\",\"e32code\":4,\"e32text\":\"SW error (panic or exception)\",\"e32model\":\"ESP32-D0WDQ5 rev.3\",\"e32cores\":2,\"e32speed\":240,\"e32flash\":4,\"e32flashspeed\":80,\"e32flashmode\":2,\"e32flashtext\":\" (DIO)\",\"uptime\":167796,\"opt\":79,\"brand\":\"WLED\",\"product\":\"MoonModules\"}";
+
+void SysModWeb::serializeState(String &output) {
+  JsonDocument stateDoc;
 
-    //tbd:  //StarBase has no idea about leds so this should be led independent
-    root["bri"] = mdl->getValue("Fixture", "brightness");
-    root["on"] = mdl->getValue("Fixture", "on").as<bool>();
+  //tbd:  //StarBase has no idea about leds so this should be led independent
+  stateDoc["bri"] = mdl->getValue("Fixture", "brightness");
+  stateDoc["on"] = mdl->getValue("Fixture", "on").as<bool>();
 
+  String variable;
+  serializeJson(stateDoc, variable);
+  variable.remove(variable.length() - 1); //remove } to continue with the constant part
+  output += variable + "," + FPSTR(wledStateTail);
 }
-void SysModWeb::serializeInfo(JsonObject root) {
-    const char * jsonInfo = "{\"ver\":\"0.14.1-b30.36\",\"rel\":\"abc_wled_controller_v43_M\",\"vid\":2402252,\"leds\":{\"count\":1024,\"countP\":1024,\"pwr\":1124,\"fps\":32,\"maxpwr\":9500,\"maxseg\":32,\"matrix\":{\"w\":32,\"h\":32},\"seglc\":[1],\"lc\":1,\"rgbw\":false,\"wv\":0,\"cct\":0},\"str\":false,\"name\":\"WLED-Wladi\",\"udpport\":21324,\"live\":false,\"liveseg\":-1,\"lm\":\"\",\"lip\":\"\",\"ws\":2,\"fxcount\":195,\"palcount\":75,\"cpalcount\":0,\"maps\":[{\"id\":0}],\"outputs\":[1024],\"wifi\":{\"bssid\":\"\",\"rssi\":0,\"signal\":100,\"channel\":1},\"fs\":{\"u\":20,\"t\":983,\"pmt\":0},\"ndc\":16,\"arch\":\"esp32\",\"core\":\"v3.3.6-16-gcc5440f6a2\",\"lwip\":0,\"totalheap\":294784,\"getflash\":4194304,\"freeheap\":115988,\"freestack\":6668,\"minfreeheap\":99404,\"e32core0code\":12,\"e32core0text\":\"SW restart\",\"e32core1code\":12,\"e32core1text\":\"SW restart\",\"e32code\":4,\"e32text\":\"SW error (panic or exception)\",\"e32model\":\"ESP32-D0WDQ5 rev.3\",\"e32cores\":2,\"e32speed\":240,\"e32flash\":4,\"e32flashspeed\":80,\"e32flashmode\":2,\"e32flashtext\":\" (DIO)\",\"uptime\":167796,\"opt\":79,\"brand\":\"WLED\",\"product\":\"MoonModules\",\"mac\":\"08b61f6fa800\",\"ip\":\"192.168.8.171\"}";
-    JsonDocument docInfo;
-
-    deserializeJson(root, jsonInfo);
-
-    root["name"] = mdl->getValue("System", "name");
-    // docInfo["arch"] = "esp32"; //platformName
-
-    // docInfo["rel"] = _INIT(TOSTRING(APP));
-    // docInfo["ver"] = "0.0.1";
-    // docInfo["vid"] = 2025121212; //WLED-native needs int otherwise status offline!!!
-    // docInfo["leds"]["count"] = 999; //StarBase has no idea about leds
-    // docInfo["leds"]["countP"] = 998;  //StarBase has no idea about leds
-    // docInfo["leds"]["fps"] = mdl->getValue("fps"); //tbd: should be realFps but is ro var
-    // docInfo["wifi"]["rssi"] = WiFi.RSSI();// mdl->getValue("rssi"); (ro)
-
-    root["mac"] = JsonString(mdns->escapedMac.c_str(), JsonString::Copied);
-    root["ip"] = JsonString(net->localIP().toString().c_str(), JsonString::Copied);
-    // print->printJson("serveJson", root);
+
+void SysModWeb::serializeInfo(String &output) {
+  JsonDocument infoDoc;
+
+  infoDoc["name"] = mdl->getValue("System", "name");
+  // infoDoc["arch"] = "esp32"; //platformName
+
+  // infoDoc["rel"] = _INIT(TOSTRING(APP));
+  // infoDoc["ver"] = "0.0.1";
+  // infoDoc["vid"] = 2025121212; //WLED-native needs int otherwise status offline!!!
+  // infoDoc["leds"]["count"] = 999; //StarBase has no idea about leds
+  // infoDoc["leds"]["countP"] = 998;  //StarBase has no idea about leds
+  // infoDoc["leds"]["fps"] = mdl->getValue("fps"); //tbd: should be realFps but is ro var
+  // infoDoc["wifi"]["rssi"] = WiFi.RSSI();// mdl->getValue("rssi"); (ro)
+
+  infoDoc["mac"] = JsonString(mdns->escapedMac.c_str(), JsonString::Copied);
+  infoDoc["ip"] = JsonString(net->localIP().toString().c_str(), JsonString::Copied);
+
+  String variable;
+  serializeJson(infoDoc, variable);
+  variable.remove(variable.length() - 1); //remove } to continue with the constant part
+  output += variable + "," + FPSTR(wledInfoTail);
 }
 
-void SysModWeb::serveJson(WebRequest *request) {
+void SysModWeb::serializeWled(String &output, const String &url) {
+  output.reserve(2048);
+  if (url.indexOf("state") > 0) {
+    serializeState(output);
+  }
+  else if (url.indexOf("info") > 0) {
+    serializeInfo(output);
+  }
+  else {
+    output += "{\"state\":";
+    serializeState(output);
+    output += ",\"info\":";
+    serializeInfo(output);
+    output += "}";
+  }
+}
 
-  AsyncJsonResponse * response;
+void SysModWeb::serveJson(WebRequest *request) {
 
   // return model.json
   if (request->url().indexOf("mdl") > 0) {
-    JsonArray model = mdl->model->as<JsonArray>();
-    ppf("serveJson model ...%d, %s %d %d\n", request->client()->remoteIP()[3], request->url().c_str(), model.size(),  measureJson(model));
+    ppf("serveJson model ...%d, %s\n", request->client()->remoteIP()[3], request->url().c_str());
 
-    response = new AsyncJsonResponse(true); //array, removed size as ArduinoJson v7 doesnt care (tbd: here copy is mode, see WLED for using reference)
-    JsonArray root = response->getRoot();
-
-    root.set(model);
+    //the model is serialized by loopTask between frames (see loop), this task only streams the bytes into the tcp buffers
+    std::shared_ptr<ModelStream> stream = std::make_shared<ModelStream>();
+    if (!modelStreamQueue.push(stream)) {
+      request->send(503, "text/plain", "Busy");
+      return;
+    }
+    WebResponse *response = request->beginChunkedResponse("application/json", [stream](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+      bool done = stream->done.load(std::memory_order_acquire); //before head: if done, head is final
+      size_t head = stream->head.load(std::memory_order_acquire);
+      size_t tail = stream->tail.load(std::memory_order_relaxed);
+      if (head == tail) return done?0:RESPONSE_TRY_AGAIN; //0 bytes ends the response
+      size_t len = min(maxLen, head - tail);
+      for (size_t i = 0; i < len; i++)
+        buffer[i] = stream->buffer[(tail + i) % ModelStream::size];
+      stream->tail.store(tail + len, std::memory_order_release);
+      return len;
+    });
+    request->send(response);
   } else { //WLED compatible
     ppf("serveJson ...%d, %s\n", request->client()->remoteIP()[3], request->url().c_str());
-    response = new AsyncJsonResponse(false); //object. removed size as ArduinoJson v7 doesnt care
-    JsonObject root = response->getRoot();
 
     //temporary set all WLED variables (as otherwise WLED-native does not show the instance): tbd: clean up (state still needed, info not)
 
-    if (request->url().indexOf("state") > 0) {
-      serializeState(root);
-    }
-    else if (request->url().indexOf("info") > 0) {
-      serializeInfo(root);
-    }
-    else {
-      serializeState(root["state"].to<JsonObject>());
-      serializeInfo(root["info"].to<JsonObject>());
-    }
+    String output;
+    serializeWled(output, request->url());
+    request->send(200, "application/json", output);
   }
-
-  response->setLength();
-  request->send(response);
 } //serveJson
\ No newline at end of file
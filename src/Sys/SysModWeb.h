@@ -34,6 +34,99 @@
   #define WebResponse AsyncWebServerResponse
 #endif
 
+#include <atomic>
+#include <memory>
+
+//lock-free ring buffer for one producer task and one consumer task, holds N-1 items
+template <typename T, size_t N>
+class SPSCQueue {
+public:
+  bool push(const T &item) {
+    size_t head = this->head.load(std::memory_order_relaxed);
+    size_t next = (head + 1) % N;
+    if (next == tail.load(std::memory_order_acquire)) return false; //full
+    items[head] = item;
+    this->head.store(next, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &item) {
+    size_t tail = this->tail.load(std::memory_order_relaxed);
+    if (tail == head.load(std::memory_order_acquire)) return false; //empty
+    item = std::move(items[tail]); //release e.g. a shared_ptr in the slot
+    this->tail.store((tail + 1) % N, std::memory_order_release);
+    return true;
+  }
+
+private:
+  T items[N];
+  std::atomic<size_t> head{0};
+  std::atomic<size_t> tail{0};
+};
+
+//verbose answer of a WLED /json POST ("v":true): made by loopTask after the command is applied, the AsyncTCP task sends it
+struct WebReply {
+  String url; //state, info or both, see serializeWled
+  String json; //not changed after ready
+  std::atomic<bool> ready{false};
+  size_t offset = 0; //bytes sent (AsyncTCP task)
+};
+
+//json or binary var records received from a client (AsyncTCP task), applied by loopTask
+struct WebCommand {
+  char * json = nullptr; //malloced by queueCommand, freed after applying
+  size_t len = 0;
+  uint32_t clientId = 0; //0: no client (e.g. /json), response to all clients
+  bool isBinary = false;
+  std::shared_ptr<WebReply> reply; //nullptr: no answer with the state after applying
+};
+
+class StarJsonSerializer; //forward, see SysStarJson.h
+
+//chunked /json/mdl response: serialized by loopTask a part at a time into a small ring buffer, the AsyncTCP task sends the bytes
+//  so a big model is never in memory as a whole and the loop is not stalled to serialize it
+struct ModelStream: public Print {
+  static const size_t size = 2048;
+  char buffer[size];
+  std::atomic<size_t> head{0}; //bytes serialized (loopTask)
+  std::atomic<size_t> tail{0}; //bytes sent (AsyncTCP task)
+  std::atomic<bool> done{false}; //no more bytes after head
+
+  //loopTask only
+  StarJsonSerializer *serializer = nullptr;
+  uint32_t structureVersion = 0; //stop if vars are added / removed while serializing
+  uint32_t partVersion = 0; //modelVersion at the previous part
+  size_t pending = 0; //bytes written in this part, published in head after the part
+
+  ~ModelStream();
+  size_t write(uint8_t c) {
+    buffer[(head.load(std::memory_order_relaxed) + pending++) % size] = c;
+    return 1;
+  }
+};
+
+//binary ws message with var values: byte 0 is binVars, then records of
+//  handle (uint16_t little endian, var["h"]), rowNr (UINT8_MAX if no row), type, value
+//  binInt, binFloat: 4 bytes little endian, binString: length byte + chars, binBool: 1 byte
+//same format from client to server and as broadcast to all clients, see data/index.js
+#define binVars 2 //0: pins, 1: preview
+enum BinType {
+  binInt,
+  binFloat,
+  binString,
+  binBool,
+  binJson //journal only (see SysModModel::journalVar): length byte + serialized json
+};
+
+struct BinRecord {
+  const byte * start; //points into the message
+  uint16_t size; //bytes of the whole record, binString up to 260
+  uint16_t handle;
+  uint8_t rowNr;
+  uint8_t type;
+  bool stale = false; //var set again in a later record
+};
+
 class SysModWeb:public SysModule {
 
 public:
@@ -64,6 +157,7 @@ public:
   SysModWeb();
 
   void setup();
+  void loop();
   void loop20ms();
   void loop1s();
 
@@ -72,17 +166,28 @@ public:
   void connectedChanged();
 
   void wsEvent(WebSocket * ws, WebClient * client, AwsEventType type, void * arg, byte *data, size_t len);
+
+  //hand over json to loopTask, returns false if the queue is full
+  bool queueCommand(const char * json, size_t len, uint32_t clientId = 0, bool isBinary = false, std::shared_ptr<WebReply> reply = nullptr);
+  //send the model, or if the client has the model from boot and version, only the values changed since version
+  void syncClient(WebClient * client, uint32_t boot, uint32_t version);
+  //set the vars of binary records and broadcast them, client (sender) gets an empty binVars message as ack if nothing is broadcasted
+  void applyBinRecords(std::vector<BinRecord> &records, WebClient * client);
   
   //send json to client or all clients
   void sendDataWs(JsonVariant json = JsonVariant(), WebClient * client = nullptr);
-  void sendDataWs(std::function<void(AsyncWebSocketMessageBuffer *)> fill, size_t len, bool isBinary, WebClient * client = nullptr);
+  //lossy: skip clients with a long queue (e.g. previews)
+  void sendDataWs(std::function<void(AsyncWebSocketMessageBuffer *)> fill, size_t len, bool isBinary, WebClient * client = nullptr, bool lossy = true);
 
   //add an url to the webserver to listen to
   void serveIndex(WebRequest *request);
   void serveNewUI(WebRequest *request);
   //mdl and WLED style state and info
-  void serializeState(JsonObject root);
-  void serializeInfo(JsonObject root);
+  //append json to output
+  void serializeState(String &output);
+  void serializeInfo(String &output);
+  //state and / or info depending on url (/json/state, /json/info, /json)
+  void serializeWled(String &output, const String &url);
   void serveJson(WebRequest *request);
 
 
@@ -92,6 +197,10 @@ public:
   void serveUpdate(WebRequest *request, const String& fileName, size_t index, byte *data, size_t len, bool final);
   void serveFiles(WebRequest *request);
 
+  //send 304 if the browser has eTag in its cache
+  bool handleIfNoneMatchCacheHeader(WebRequest *request, const char * eTag);
+  void setStaticContentCacheHeaders(WebResponse *response, const char * eTag);
+
   //processJsonUrl handles requests send in javascript using fetch and from a browser or curl
   //try this !!!: curl -X POST "http://192.168.121.196/json" -d '{"pin2":false}' -H "Content-Type: application/json"
   //curl -X POST "http://4.3.2.1/json" -d '{"pin2":false}' -H "Content-Type: application/json"
@@ -155,13 +264,15 @@ public:
   }
 
 private:
-  bool modelUpdated = false;
-
   bool clientsChanged = false;
 
   JsonDocument *responseDocLoopTask = nullptr;
   JsonDocument *responseDocAsyncTCP = nullptr;
 
+  SPSCQueue<WebCommand, 32> commandQueue; //producer AsyncTCP task, consumer loopTask
+  SPSCQueue<std::shared_ptr<ModelStream>, 4> modelStreamQueue; //producer AsyncTCP task, consumer loopTask
+  std::vector<std::shared_ptr<ModelStream>> modelStreams; //being serialized (loopTask)
+
 };
 
 extern SysModWeb *web;
\ No newline at end of file
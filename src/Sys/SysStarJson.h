@@ -281,4 +281,160 @@ private:
       ppf("dev StarJson write %s not supported\n", variant.as<String>().c_str());
   }
 
-};
\ No newline at end of file
+};
+
+//serialize a json variant a part at a time, e.g. the model to a file or a web response without blocking the loop for the whole model
+//  between parts, elements must not be removed (iterators), check a version (e.g. mdl->structureVersion) and stop if changed
+class StarJsonSerializer {
+
+  public:
+
+  StarJsonSerializer(JsonVariant root) {
+    this->root = root;
+  }
+
+  void addExclusion(const char * key) {
+    keyList.push_back(key);
+  }
+
+  //exclude a key depending on the object it is in, e.g. the value of ro vars
+  void addExclusion(std::function<bool(JsonObject, const char *)> fun) {
+    exclusionFuns.push_back(fun);
+  }
+
+  //print the next part, at most maxLen bytes, returns false if all has been printed
+  bool next(Print &print, size_t maxLen) {
+    size_t len = 0; //printed in this part
+    //all or nothing
+    auto put = [&print, &len, maxLen](const char * text) -> bool {
+      size_t textLen = strlen(text);
+      if (len + textLen > maxLen) return false;
+      print.print(text);
+      len += textLen;
+      return true;
+    };
+
+    if (!started) {
+      if (!putValue(root, print, len, maxLen, put)) return true;
+      started = true;
+    }
+
+    while (!stack.empty()) {
+      Frame &frame = stack.back();
+      JsonVariant value;
+      if (!frame.object.isNull()) {
+        //skip excluded keys
+        while (!frame.separated && frame.objectIt != frame.object.end() && isExcluded(frame.object, (*frame.objectIt).key().c_str()))
+          ++frame.objectIt;
+        if (frame.objectIt == frame.object.end()) {
+          if (!put("}")) return true;
+          stack.pop_back();
+          continue;
+        }
+        if (!frame.separated) {
+          String key = String(frame.first?"":",") + "\"" + (*frame.objectIt).key().c_str() + "\":";
+          if (!put(key.c_str())) return true;
+          frame.separated = true;
+        }
+        value = (*frame.objectIt).value();
+      } else {
+        if (frame.arrayIt == frame.array.end()) {
+          if (!put("]")) return true;
+          stack.pop_back();
+          continue;
+        }
+        if (!frame.separated) {
+          if (!frame.first && !put(",")) return true;
+          frame.separated = true;
+        }
+        value = *frame.arrayIt;
+      }
+
+      //next element of frame before putValue pushes a new frame (invalidates the reference)
+      Frame next = frame;
+      if (!next.object.isNull()) ++next.objectIt; else ++next.arrayIt;
+      next.first = false;
+      next.separated = false;
+      size_t depth = stack.size();
+      if (!putValue(value, print, len, maxLen, put)) return true;
+      stack[depth - 1] = next;
+    }
+    return false;
+  }
+
+  //a value longer than a part is being printed: it must not change until done (check a version, e.g. mdl->modelVersion)
+  bool inValue() {return valueOffset > 0;}
+
+private:
+  struct Frame {
+    JsonObject object; //object or array
+    JsonObject::iterator objectIt;
+    JsonArray array;
+    JsonArray::iterator arrayIt;
+    bool first = true;
+    bool separated = false; //separator (and key) of the current element printed
+  };
+
+  //prints bytes skip .. skip + space of what is printed to it
+  class PartPrint: public Print {
+  public:
+    PartPrint(Print &print, size_t skip, size_t space): print(print), skip(skip), space(space) {}
+    size_t write(uint8_t c) {
+      if (count >= skip && count - skip < space) print.write(c);
+      count++;
+      return 1;
+    }
+    Print &print;
+    size_t skip;
+    size_t space;
+    size_t count = 0;
+  };
+
+  JsonVariant root;
+  bool started = false;
+  std::vector<Frame> stack;
+  size_t valueOffset = 0; //bytes printed of a value longer than a part
+  std::vector<const char *> keyList;
+  std::vector<std::function<bool(JsonObject, const char *)>> exclusionFuns;
+
+  bool isExcluded(JsonObject object, const char * key) {
+    for (const char * el: keyList)
+      if (strncmp(el, key, 32) == 0) return true;
+    for (auto &exclusionFun: exclusionFuns)
+      if (exclusionFun(object, key)) return true;
+    return false;
+  }
+
+  //object or array: print the opening and push a frame, else print the value (in parts if longer than a part)
+  template <typename Put>
+  bool putValue(JsonVariant value, Print &print, size_t &len, size_t maxLen, Put put) {
+    if (value.is<JsonObject>()) {
+      if (!put("{")) return false;
+      Frame frame;
+      frame.object = value.as<JsonObject>();
+      frame.objectIt = frame.object.begin();
+      stack.push_back(frame);
+      return true;
+    }
+    if (value.is<JsonArray>()) {
+      if (!put("[")) return false;
+      Frame frame;
+      frame.array = value.as<JsonArray>();
+      frame.arrayIt = frame.array.begin();
+      stack.push_back(frame);
+      return true;
+    }
+    size_t valueLen = measureJson(value);
+    //not fitting: wait for the next part, unless nothing else is printed in this part (longer than a part)
+    if (valueLen - valueOffset > maxLen - len && len > 0) return false;
+    PartPrint partPrint(print, valueOffset, maxLen - len);
+    serializeJson(value, partPrint);
+    size_t printed = min(valueLen - valueOffset, maxLen - len);
+    len += printed;
+    valueOffset += printed;
+    if (valueOffset < valueLen) return false; //rest in the next part
+    valueOffset = 0;
+    return true;
+  }
+
+};
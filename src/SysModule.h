@@ -42,6 +42,7 @@ public:
   const char * name;
   bool success;
   bool isEnabled;
+  uint8_t printLevel = 0; //0: Info (ppf), 1: Debug (also ppfd), set in the Modules table
   unsigned long twentyMsMillis = millis() - random(1000); //random so not all 1s are fired at once
   unsigned long oneSecondMillis = millis() - random(1000); //random so not all 1s are fired at once
   unsigned long tenSecondMillis = millis() - random(10000); //random within a second
@@ -79,6 +79,24 @@ void SysModules::setup() {
       return true;
     default: return false;
   }});
+
+  ui->initSelect(tableVar, "print", (uint8_t)0, false, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+    case onUI: {
+      ui->setComment(var, "Debug: also ppfd prints");
+      JsonArray options = ui->setOptions(var);
+      options.add("Info");
+      options.add("Debug");
+      return true; }
+    case onSetValue:
+      for (size_t rowNr = 0; rowNr < modules.size(); rowNr++)
+        mdl->setValue(var, modules[rowNr]->printLevel, rowNr);
+      return true;
+    case onChange:
+      if (rowNr != UINT8_MAX && rowNr < modules.size())
+        modules[rowNr]->printLevel = mdl->getValue(var, rowNr);
+      return true;
+    default: return false;
+  }});
 }
 
 void SysModules::loop() {
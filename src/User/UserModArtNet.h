@@ -71,7 +71,7 @@ public:
 
     if(!targetIp) return;
 
-    if(!eff->newFrame) return;
+    if(!eff->newFrame || !eff->fixture.frameChanged) return; //skip unchanged frames
 
     uint8_t bri = mdl->linearToLogarithm(fix->bri);
 
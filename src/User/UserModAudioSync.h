@@ -11,9 +11,66 @@
 
 #pragma once
 
+#include "../Sys/SysModPins.h"
+
 #include <WLED-sync.h> // https://github.com/netmindz/WLED-sync
+#include <driver/i2s.h>
+#include <atomic>
 
 #define MAX_FREQUENCY   11025          // sample frequency / 2 (as per Nyquist criterion)
+#define micSampleRate 22050
+#define micSamples 512 //fft size: 23 ms per block, 43 Hz per bin
+
+enum UM_AudioSources {
+  UMA_Sync = 0,
+  UMA_Mic
+};
+
+//audio for effects: bands, volume and peak of a captured block (mic) or packet (sync), see UserModAudioSync::frame
+struct AudioFrame {
+  byte bands[NUM_GEQ_CHANNELS] = {0};
+  float volumeSmth = 0; //0..255, after AGC
+  float volumeRaw = 0; //0..255, before AGC
+  float majorPeak = 0; //frequency with the highest magnitude
+  bool beat = false; //in the last captured frame
+  unsigned long micros = 0; //capture time
+};
+
+//first fft bin of each GEQ channel for micSamples at micSampleRate (as WLED audioreactive), last channel ends at bin 215 (9.3 kHz)
+static const uint8_t micBandBins[NUM_GEQ_CHANNELS + 1] = {1, 2, 3, 5, 7, 10, 13, 19, 26, 33, 44, 56, 70, 86, 104, 165, 215};
+
+//in place radix-2 fft, n is a power of 2
+static void fft(float *re, float *im, uint16_t n) {
+  //bit reversal permutation
+  for (uint16_t i = 1, j = 0; i < n; i++) {
+    uint16_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) {
+      std::swap(re[i], re[j]);
+      std::swap(im[i], im[j]);
+    }
+  }
+  for (uint16_t len = 2; len <= n; len <<= 1) {
+    float wRe = cosf(-2 * M_PI / len);
+    float wIm = sinf(-2 * M_PI / len);
+    for (uint16_t i = 0; i < n; i += len) {
+      float cRe = 1, cIm = 0;
+      for (uint16_t k = 0; k < len / 2; k++) {
+        uint16_t a = i + k, b = a + len / 2;
+        float tRe = re[b] * cRe - im[b] * cIm;
+        float tIm = re[b] * cIm + im[b] * cRe;
+        re[b] = re[a] - tRe;
+        im[b] = im[a] - tIm;
+        re[a] += tRe;
+        im[a] += tIm;
+        float nRe = cRe * wRe - cIm * wIm;
+        cIm = cRe * wIm + cIm * wRe;
+        cRe = nRe;
+      }
+    }
+  }
+}
 
 enum UM_SoundSimulations {
   UMS_BeatSin = 0,
@@ -26,8 +83,12 @@ class UserModAudioSync:public SysModule {
 public:
 
   WLEDSync sync;
-  byte fftResults[NUM_GEQ_CHANNELS]= {0};
-  float volumeSmth;
+
+  uint8_t source = UMA_Sync;
+  uint8_t sdPin = 32; //pins as WLED audioreactive
+  uint8_t wsPin = 15;
+  uint8_t sckPin = 14;
+  uint8_t squelch = 10; //volumeRaw below squelch is silence
 
   UserModAudioSync() :SysModule("Audio Sync") {
   };
@@ -36,11 +97,47 @@ public:
   void setup() {
     SysModule::setup();
     parentVar = ui->initUserMod(parentVar, name, 6300);
+
+    ui->initSelect(parentVar, "source", &source, false, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onUI: {
+        JsonArray options = ui->setOptions(var);
+        options.add("WLED Sync");
+        options.add("I2S Mic");
+        return true; }
+      case onChange:
+        onOffChanged();
+        return true;
+      default: return false;
+    }});
+
+    //mic pins changed: restart the mic
+    VarFun pinFun = [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onChange:
+        stopMic(); //releases the old pins
+        if (micPinsAvailable()) onOffChanged(); //else the mic stays stopped (status)
+        return true;
+      default: return false;
+    }};
+    ui->initPin(parentVar, "sd", &sdPin, false, pinFun);
+    ui->initPin(parentVar, "ws", &wsPin, false, pinFun);
+    ui->initPin(parentVar, "sck", &sckPin, false, pinFun);
+
+    ui->initSlider(parentVar, "squelch", &squelch, 0, 255, false, [](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onUI:
+        ui->setComment(var, "Mic noise gate");
+        return true;
+      default: return false;
+    }});
   
     ui->initText(parentVar, "status", nullptr, 16, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
     case onLoop1s: {
       String msg = "";
-      if((lastData != 0) && isTimeout()) {
+      if (source == UMA_Mic) {
+        uint32_t frameCounter = audioSeq / 2;
+        msg = micTaskHandle?"Mic " + String(frameCounter - frameCounter1s) + " /s":"Mic not started";
+        frameCounter1s = frameCounter;
+      }
+      else if((lastData != 0) && isTimeout()) {
         msg = sync.sourceIP.toString() + " Timeout " + ((millis() - lastData) / 1000)  +"s";
       }
       else {
@@ -63,7 +160,12 @@ public:
   }
 
   void onOffChanged() {
-    if (mdls->isConnected && isEnabled) {
+    if (isEnabled && source == UMA_Mic)
+      startMic();
+    else
+      stopMic();
+
+    if (mdls->isConnected && isEnabled && source == UMA_Sync) {
       sync.begin();
     } else {
       // sync.end();???
@@ -76,27 +178,268 @@ public:
 
   void loop20ms() {
     // SysModule::loop();
+    if (source == UMA_Mic) return; //published by micTask
+
+    AudioFrame frame;
     if (mdls->isConnected && sync.read()) {
       lastData = millis();
       if(debug) ppf("WLED-Sync: ");
       for (int b = 0; b < NUM_GEQ_CHANNELS; b++) {
         byte val = sync.fftResult[b];
-        fftResults[b] = val;
+        frame.bands[b] = val;
         if(debug) ppf("%u ", val);
       }
-      volumeSmth = sync.volumeSmth;
+      frame.volumeSmth = sync.volumeSmth;
+      frame.volumeRaw = sync.volumeRaw;
+      frame.majorPeak = sync.FFT_MajorPeak;
       if(debug) ppf("\n");
+      publish(frame);
     }
     else if((lastData == 0) || isTimeout()) { // Could also check for non-silent
-      simulateSound(UMS_BeatSin);
+      simulateSound(UMS_BeatSin, frame);
+      publish(frame);
     }
   }
 
+  //audio at time now, safe to call from any task (effects on both cores)
+  //  frames are captured every 20-23 ms, effects run faster: bands and volume are interpolated between the last two frames,
+  //  one frame interval behind the last capture, so effects at 100+ fps get smooth input instead of 50 Hz steps
+  AudioFrame frame(unsigned long now = micros()) {
+    AudioFrame previous, current;
+    //seqlock: audioSeq is odd while publish writes, retry if it changed during the copy
+    for (;;) {
+      uint32_t seq = audioSeq.load(std::memory_order_acquire);
+      if (seq & 1) {
+        taskYIELD(); //writer on the same core
+        continue;
+      }
+      previous = audioFrames[0];
+      current = audioFrames[1];
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (audioSeq.load(std::memory_order_relaxed) == seq) break;
+    }
+
+    unsigned long interval = current.micros - previous.micros;
+    if (previous.micros == 0 || interval == 0 || interval > 200000) return current; //no previous frame or stalled: no interpolation
+
+    float alpha = (float)(now - current.micros) / interval;
+    if ((long)(now - current.micros) < 0) alpha = 0; //now before the capture (captured during the frame)
+    if (alpha >= 1) return current;
+
+    AudioFrame audio = current;
+    for (uint8_t band = 0; band < NUM_GEQ_CHANNELS; band++)
+      audio.bands[band] = previous.bands[band] + (current.bands[band] - previous.bands[band]) * alpha;
+    audio.volumeSmth = previous.volumeSmth + (current.volumeSmth - previous.volumeSmth) * alpha;
+    audio.volumeRaw = previous.volumeRaw + (current.volumeRaw - previous.volumeRaw) * alpha;
+    audio.micros = now;
+    return audio;
+  }
+
   private:
     boolean debug = false;
     unsigned long lastData = 0; 
 
-    void simulateSound(uint8_t simulationId)
+    //last two published frames [previous, current], written by one task at a time: micTask or loop20ms (sync), see frame
+    AudioFrame audioFrames[2];
+    std::atomic<uint32_t> audioSeq{0}; //odd while writing, frames published is audioSeq / 2
+    uint32_t frameCounter1s = 0;
+    float volumeAvg = 0; //for beat detection
+    unsigned long lastBeat = 0;
+
+    //mic: sampled and analysed by micTask on the other core
+    TaskHandle_t micTaskHandle = nullptr;
+    //stopMic sets micStop, micTask ends after its current analyse (i2s_read has a timeout) and gives micStopped
+    std::atomic<bool> micStop{false};
+    SemaphoreHandle_t micStopped = xSemaphoreCreateBinary();
+
+    //analysis state, only used by micTask
+    int32_t *micBuffer = nullptr;
+    float *vReal = nullptr;
+    float *vImag = nullptr;
+    float *window = nullptr;
+    float bandsSmth[NUM_GEQ_CHANNELS] = {0};
+    float agcPeak = 0; //band peak, decays slowly
+    float agcVolume = 0; //volume peak, decays slowly
+    float volumeSmthMic = 0;
+
+    static void micTask(void *parameter) {
+      UserModAudioSync *audio = (UserModAudioSync *)parameter;
+      while (!audio->micStop) {
+        size_t bytesRead = 0;
+        //blocks until the dma buffers have a block, timeout to check micStop if no samples (e.g. mic not connected)
+        if (i2s_read(I2S_NUM_0, audio->micBuffer, micSamples * sizeof(int32_t), &bytesRead, pdMS_TO_TICKS(100)) == ESP_OK && bytesRead == micSamples * sizeof(int32_t))
+          audio->analyse();
+      }
+      xSemaphoreGive(audio->micStopped);
+      vTaskDelete(nullptr);
+    }
+
+    //mic pins must be valid, different and not allocated by another module (e.g. Leds)
+    bool micPinsAvailable() {
+      uint8_t pins[] = {sdPin, wsPin, sckPin};
+      for (uint8_t i = 0; i < 3; i++) {
+        if (pins[i] >= NUM_DIGITAL_PINS || !digitalPinIsValid(pins[i])) {
+          ppf("audio mic pin %d not valid\n", pins[i]);
+          return false;
+        }
+        if (!pinsM->isOwner(pins[i], "") && !pinsM->isOwner(pins[i], "Audio")) {
+          ppf("audio mic pin %d in use by %s\n", pins[i], pinsM->pinObjects[pins[i]].owner);
+          return false;
+        }
+        for (uint8_t j = 0; j < i; j++) {
+          if (pins[j] == pins[i]) {
+            ppf("audio mic pin %d used twice\n", pins[i]);
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    void startMic() {
+      if (micTaskHandle) return;
+      //check before i2s_set_pin, which takes the pins whoever owns them
+      if (!micPinsAvailable()) return;
+
+      //I2S#0 for audio, leds use I2S#1 or RMT, see LedLayer.h
+      i2s_config_t i2sConfig = {};
+      i2sConfig.mode = i2s_mode_t(I2S_MODE_MASTER | I2S_MODE_RX);
+      i2sConfig.sample_rate = micSampleRate;
+      i2sConfig.bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT; //INMP441, SPH0645: 24 bits in the upper bits
+      i2sConfig.channel_format = I2S_CHANNEL_FMT_ONLY_LEFT;
+      i2sConfig.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+      i2sConfig.intr_alloc_flags = ESP_INTR_FLAG_LEVEL1;
+      i2sConfig.dma_buf_count = 8;
+      i2sConfig.dma_buf_len = 128;
+
+      i2s_pin_config_t pinConfig = {};
+      pinConfig.mck_io_num = I2S_PIN_NO_CHANGE;
+      pinConfig.bck_io_num = sckPin;
+      pinConfig.ws_io_num = wsPin;
+      pinConfig.data_out_num = I2S_PIN_NO_CHANGE;
+      pinConfig.data_in_num = sdPin;
+
+      if (i2s_driver_install(I2S_NUM_0, &i2sConfig, 0, nullptr) != ESP_OK) {
+        ppf("audio i2s_driver_install failed\n");
+        return;
+      }
+      if (i2s_set_pin(I2S_NUM_0, &pinConfig) != ESP_OK) {
+        ppf("audio i2s_set_pin failed sd:%d ws:%d sck:%d\n", sdPin, wsPin, sckPin);
+        i2s_driver_uninstall(I2S_NUM_0);
+        return;
+      }
+      pinsM->allocatePin(sdPin, "Audio", "I2S SD");
+      pinsM->allocatePin(wsPin, "Audio", "I2S WS");
+      pinsM->allocatePin(sckPin, "Audio", "I2S SCK");
+
+      micBuffer = new int32_t[micSamples];
+      vReal = new float[micSamples];
+      vImag = new float[micSamples];
+      window = new float[micSamples];
+      for (uint16_t i = 0; i < micSamples; i++)
+        window[i] = 0.5f * (1 - cosf(2 * M_PI * i / (micSamples - 1))); //Hann
+
+      //the loop task runs on core 1, wifi on core 0 leaves most of core 0 idle
+      xTaskCreatePinnedToCore(micTask, "micTask", 4096, this, tskIDLE_PRIORITY + 1, &micTaskHandle, 0);
+      ppf("audio mic started sd:%d ws:%d sck:%d\n", sdPin, wsPin, sckPin);
+    }
+
+    void stopMic() {
+      if (!micTaskHandle) return;
+      //not vTaskDelete: the task could be in analyse, using the buffers freed below or publishing a frame
+      xSemaphoreTake(micStopped, 0); //stale give
+      micStop = true;
+      if (xSemaphoreTake(micStopped, pdMS_TO_TICKS(1000)) != pdTRUE) {
+        ppf("dev audio micTask did not stop\n");
+        return; //leak rather than free what the task may still use, stopMic can be called again
+      }
+      micStop = false;
+      micTaskHandle = nullptr;
+      i2s_driver_uninstall(I2S_NUM_0);
+      pinsM->deallocatePin(UINT8_MAX, "Audio");
+      delete[] micBuffer; micBuffer = nullptr;
+      delete[] vReal; vReal = nullptr;
+      delete[] vImag; vImag = nullptr;
+      delete[] window; window = nullptr;
+      ppf("audio mic stopped\n");
+    }
+
+    //fft of micBuffer, bands, volume, AGC and beat: publish a frame
+    void analyse() {
+      //24 bits samples to -1..1, remove dc
+      float mean = 0;
+      for (uint16_t i = 0; i < micSamples; i++) {
+        vReal[i] = (micBuffer[i] >> 8) / 8388608.0f;
+        mean += vReal[i];
+      }
+      mean /= micSamples;
+      float sumSquares = 0;
+      for (uint16_t i = 0; i < micSamples; i++) {
+        float sample = vReal[i] - mean;
+        sumSquares += sample * sample;
+        vReal[i] = sample * window[i];
+        vImag[i] = 0;
+      }
+
+      float volumeRaw = min(sqrtf(sumSquares / micSamples) * 1024.0f, 255.0f); //rms
+      bool silence = volumeRaw < squelch;
+
+      fft(vReal, vImag, micSamples);
+
+      float bands[NUM_GEQ_CHANNELS];
+      float maxBand = 0;
+      float maxMagnitude = 0;
+      uint16_t maxBin = 0;
+      for (uint8_t band = 0; band < NUM_GEQ_CHANNELS; band++) {
+        float sum = 0;
+        for (uint16_t bin = micBandBins[band]; bin < micBandBins[band + 1]; bin++) {
+          float magnitude = sqrtf(vReal[bin] * vReal[bin] + vImag[bin] * vImag[bin]);
+          sum += magnitude;
+          if (magnitude > maxMagnitude) {
+            maxMagnitude = magnitude;
+            maxBin = bin;
+          }
+        }
+        //average of the bins, higher bands boosted as the spectrum of music falls with frequency
+        bands[band] = silence?0:sum / (micBandBins[band + 1] - micBandBins[band]) * (1 + band * 0.25f);
+        maxBand = max(maxBand, bands[band]);
+      }
+
+      //AGC: scale to the peak of the last seconds, not below the squelch level
+      agcPeak = max(maxBand, max(agcPeak * 0.998f, 0.01f));
+      agcVolume = max(volumeRaw, max(agcVolume * 0.998f, (float)max(squelch, (uint8_t)1)));
+
+      AudioFrame frame;
+      for (uint8_t band = 0; band < NUM_GEQ_CHANNELS; band++) {
+        float value = 255.0f * sqrtf(bands[band] / agcPeak); //sqrt: perceptual
+        bandsSmth[band] = max(value, bandsSmth[band] * 0.85f); //fast attack, slow decay
+        frame.bands[band] = min(bandsSmth[band], 255.0f);
+      }
+      float volume = silence?0:255.0f * volumeRaw / agcVolume;
+      volumeSmthMic = volumeSmthMic * 0.8f + volume * 0.2f;
+      frame.volumeSmth = volumeSmthMic;
+      frame.volumeRaw = volumeRaw;
+      frame.majorPeak = silence?0:maxBin * (float)micSampleRate / micSamples;
+      publish(frame);
+    }
+
+    //beat detection and capture time, then the frame becomes current
+    void publish(AudioFrame &frame) {
+      unsigned long now = millis();
+      frame.beat = frame.volumeRaw > squelch && frame.volumeRaw > volumeAvg * 1.5f && now - lastBeat > 150;
+      if (frame.beat) lastBeat = now;
+      volumeAvg = volumeAvg * 0.95f + frame.volumeRaw * 0.05f;
+      frame.micros = micros();
+
+      uint32_t seq = audioSeq.load(std::memory_order_relaxed);
+      audioSeq.store(seq + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      audioFrames[0] = audioFrames[1];
+      audioFrames[1] = frame;
+      audioSeq.store(seq + 2, std::memory_order_release);
+    }
+
+    void simulateSound(uint8_t simulationId, AudioFrame &frame)
     {
       uint8_t samplePeak;
       float   FFT_MajorPeak;
@@ -112,49 +455,50 @@ public:
         default:
         case UMS_BeatSin:
           for (int i = 0; i<16; i++)
-            fftResults[i] = beatsin8(120 / (i+1), 0, 255);
+            frame.bands[i] = beatsin8(120 / (i+1), 0, 255);
             // fftResults[i] = (beatsin8(120, 0, 255) + (256/16 * i)) % 256;
-            volumeSmth = fftResults[8];
+            frame.volumeSmth = frame.bands[8];
           break;
         case UMS_WeWillRockYou:
           if (ms%2000 < 200) {
-            volumeSmth = random8(255);
+            frame.volumeSmth = random8(255);
             for (int i = 0; i<5; i++)
-              fftResults[i] = random8(255);
+              frame.bands[i] = random8(255);
           }
           else if (ms%2000 < 400) {
-            volumeSmth = 0;
+            frame.volumeSmth = 0;
             for (int i = 0; i<16; i++)
-              fftResults[i] = 0;
+              frame.bands[i] = 0;
           }
           else if (ms%2000 < 600) {
-            volumeSmth = random8(255);
+            frame.volumeSmth = random8(255);
             for (int i = 5; i<11; i++)
-              fftResults[i] = random8(255);
+              frame.bands[i] = random8(255);
           }
           else if (ms%2000 < 800) {
-            volumeSmth = 0;
+            frame.volumeSmth = 0;
             for (int i = 0; i<16; i++)
-              fftResults[i] = 0;
+              frame.bands[i] = 0;
           }
           else if (ms%2000 < 1000) {
-            volumeSmth = random8(255);
+            frame.volumeSmth = random8(255);
             for (int i = 11; i<16; i++)
-              fftResults[i] = random8(255);
+              frame.bands[i] = random8(255);
           }
           else {
-            volumeSmth = 0;
+            frame.volumeSmth = 0;
             for (int i = 0; i<16; i++)
-              fftResults[i] = 0;
+              frame.bands[i] = 0;
           }
           break;
       }
 
+      frame.volumeRaw = frame.volumeSmth;
+      frame.majorPeak = 21 + (frame.volumeSmth*frame.volumeSmth) / 8.0f; // WLEDMM 21hz...8200hz
+
       // samplePeak    = random8() > 250;
-      // FFT_MajorPeak = 21 + (volumeSmth*volumeSmth) / 8.0f; // WLEDMM 21hz...8200hz
       // maxVol        = 31;  // this gets feedback fro UI
       // binNum        = 8;   // this gets feedback fro UI
-      // volumeRaw = volumeSmth;
       // my_magnitude = 10000.0f / 8.0f; //no idea if 10000 is a good value for FFT_Magnitude ???
       // if (volumeSmth < 1 ) my_magnitude = 0.001f;             // noise gate closed - mute
 
@@ -87,7 +87,7 @@ public:
 
     if(!targetIp) return;
 
-    if(!eff->newFrame) return;
+    if(!eff->newFrame || !eff->fixture.frameChanged) return; //skip unchanged frames
 
     // calculate the number of UDP packets we need to send
     bool isRGBW = false;
@@ -13,6 +13,7 @@
 // #define __RUN_CORE 0
 #pragma once
 #include "ESPLiveScript.h"
+#include <atomic>
 
 long time1;
 long time4;
@@ -22,7 +23,69 @@ static uint32_t _nb_stat = 0;
 static float _totfps;
 static float fps = 0; //integer?
 static unsigned long frameCounter = 0;
-static uint8_t loopState = 0; //waiting on live script
+
+//compiled script, reused if the script and the defines (width, height, NUM_LEDS) did not change
+struct CompiledScript {
+  Executable exec;
+  char fileName[32];
+  uint32_t fileHash; //of the sc file
+  uint32_t definesHash; //of the defines added to the script
+  unsigned long lastUsed;
+};
+
+#define nrOfCompiledScriptsMax 6 //one per running script plus the last used
+
+//execution context of a running script: its layer, framebuffer and handshake with the render loop
+//  externals find the context of the script calling them via its task, see thisScript
+struct LiveScript {
+  CompiledScript *compiled = nullptr;
+
+  //LEDS specific
+  LedsLayer *leds = nullptr;
+  //framebuffer of the script (virtual leds of the layer): drawing externals write here bounds checked, without mapping per pixel
+  //  the render loop writes it to the layer in one go when frameReady (memcpy if the layer is not projected), see showFrame
+  std::vector<CRGB> ledsV;
+  std::vector<uint8_t> indexes; //palette indexes, see paletteMap
+  std::vector<CRGB> scratch; //rows for blur
+  uint16_t width = 0;
+  bool changed = false;
+  //End LEDS specific
+
+  //handshake: show() sets frameReady and blocks on frameShown, the render loop gives it after showing a frame which includes the script frame
+  std::atomic<bool> frameReady{false};
+  SemaphoreHandle_t frameShown = xSemaphoreCreateBinary();
+  unsigned long readyMicros = 0;
+  unsigned long releasedMicros = 0;
+  unsigned long scriptMicros = 0; //moving average of released until the next frame ready: the time the script needs for a frame
+  uint8_t holdFrames = 0; //frames to wait before release, if scriptMicros is over the budget
+
+  //per second: frames, frame latency (ready until shown) and jitter (deviation of the time between shown frames)
+  uint16_t shownCounter = 0;
+  uint16_t fps = 0;
+  unsigned long latencySum = 0;
+  unsigned long latencyMax = 0;
+  unsigned long jitterSum = 0;
+  unsigned long shownMicros = 0;
+  unsigned long interval = 0; //moving average
+  char stats[32] = "";
+
+  ~LiveScript() {
+    vSemaphoreDelete(frameShown);
+  }
+};
+
+#define nrOfLiveScriptsMax 4
+static LiveScript *liveScripts[nrOfLiveScriptsMax] = {}; //nullptr if free
+static LiveScript *liveScriptStarting = nullptr; //bound to its task in resetStat
+static SemaphoreHandle_t liveScriptBound = xSemaphoreCreateBinary();
+
+//context of the script running in this task, set in resetStat: externals (e.g. sPCLive per pixel) find it without searching
+//  thread_local (task local storage in esp-idf) instead of a FreeRTOS local storage pointer: index 0 is used by pthread
+static thread_local LiveScript *thisScript = nullptr;
+
+static LiveScript *currentScript() {
+  return thisScript;
+}
 
 //external function implementation (tbd: move into class)
 
@@ -59,14 +122,24 @@ static void show()
 
   // SKIPPED: check that both v1 and v2 are int numbers
   // RETURN_VALUE(VALUE_FROM_INT(0), rindex);
-  delay(1); //to feed the watchdog (also if loopState == 0)
-  while (loopState != 0) { //not waiting on live script
+  LiveScript *script = currentScript();
+  if (!script) {
     delay(1); //to feed the watchdog
-    // set to 0 by main loop
+    return;
+  }
+
+  script->readyMicros = micros();
+  if (script->releasedMicros) {
+    unsigned long frameMicros = script->readyMicros - script->releasedMicros;
+    script->scriptMicros = script->scriptMicros?(script->scriptMicros * 7 + frameMicros) / 8:frameMicros;
   }
-  //do live script cycle
-  loopState = 1; //live script produced a frame, main loop will deal with it
-  // ppf("loopState %d\n", loopState);
+  //a give after the previous timeout (frameShown raced with it) is stale: drain it, else this frame is released before shown
+  xSemaphoreTake(script->frameShown, 0);
+  script->frameReady = true; //live script produced a frame, the render loop will show it
+  //blocked, not busy waiting, until shown. Timeout if no render loop is showing frames
+  if (xSemaphoreTake(script->frameShown, pdMS_TO_TICKS(100)) != pdTRUE)
+    script->frameReady = false;
+  script->releasedMicros = micros();
 }
 
 static void resetShowStats()
@@ -75,6 +148,13 @@ static void resetShowStats()
     float max = 0;
     _nb_stat = 0;
     _totfps = 0;
+
+    //first call of main: bind the starting script to this task
+    if (liveScriptStarting) {
+      thisScript = liveScriptStarting;
+      liveScriptStarting = nullptr;
+      xSemaphoreGive(liveScriptBound);
+    }
 }
 
 static void dispshit(int g) { ppf("coming from assembly int %x %d", g, g);}
@@ -106,15 +186,79 @@ static uint8_t _cos8(uint8_t a) {return cos8(a);}
 static uint8_t _beatSin8(uint8_t a1, uint8_t a2, uint8_t a3) {return beatsin8(a1, a2, a3);}
 static uint8_t _inoise8(uint16_t a1, uint16_t a2, uint16_t a3) {return inoise8(a1, a2, a3);}
 static uint8_t _random8() {return random8();}
-static LedsLayer *gLeds = nullptr;
-static void _fadeToBlackBy(uint8_t a1) {if (gLeds) gLeds->fadeToBlackBy(a1);}
-
-static void _addPixelsPre() {if (gLeds) gLeds->fixture->projectAndMapPre();}
-static void _addPixel(uint8_t a1, uint8_t a2, uint8_t a3) {if (gLeds) gLeds->fixture->projectAndMapPixel({a1, a2, a3});}
-static void _addPin(uint8_t a1) {if (gLeds) gLeds->fixture->projectAndMapPin(a1);}
-static void _addPixelsPost() {if (gLeds) gLeds->fixture->projectAndMapPost();}
-static void sPCLive(uint16_t pixel, CRGB color) {if (gLeds) gLeds->setPixelColor(pixel, color);} //setPixelColor with color
-static void sCFPLive(uint16_t pixel, uint8_t index, uint8_t brightness) {if (gLeds) gLeds->setPixelColor(pixel, ColorFromPalette(gLeds->palette, index, brightness));} //setPixelColor within palette
+
+//fixture scripts run without layer (leds is nullptr) and define the fixture of the effects module
+static Fixture *scriptFixture() {
+  LiveScript *script = currentScript();
+  if (!script) return nullptr;
+  return script->leds?script->leds->fixture:&eff->fixture;
+}
+static void _addPixelsPre() {Fixture *fixture = scriptFixture(); if (fixture) fixture->projectAndMapPre();}
+static void _addPixel(uint8_t a1, uint8_t a2, uint8_t a3) {Fixture *fixture = scriptFixture(); if (fixture) fixture->projectAndMapPixel({a1, a2, a3});}
+static void _addPin(uint8_t a1) {Fixture *fixture = scriptFixture(); if (fixture) fixture->projectAndMapPin(a1);}
+static void _addPixelsPost() {Fixture *fixture = scriptFixture(); if (fixture) fixture->projectAndMapPost();}
+
+//framebuffer externals
+static void sPCLive(uint16_t pixel, CRGB color) { //setPixelColor with color
+  LiveScript *script = currentScript();
+  if (script && pixel < script->ledsV.size()) {
+    script->ledsV[pixel] = color;
+    script->changed = true;
+  }
+}
+static void sCFPLive(uint16_t pixel, uint8_t index, uint8_t brightness) { //setPixelColor within palette
+  LiveScript *script = currentScript();
+  if (script && script->leds && pixel < script->ledsV.size()) {
+    script->ledsV[pixel] = script->leds->colorFromPalette(index, brightness);
+    script->changed = true;
+  }
+}
+static void _fadeToBlackBy(uint8_t a1) {
+  LiveScript *script = currentScript();
+  if (!script) return;
+  fadeToBlackBy(script->ledsV.data(), script->ledsV.size(), a1);
+  script->changed = true;
+}
+static void _fill(CRGB color) {
+  LiveScript *script = currentScript();
+  if (!script) return;
+  std::fill(script->ledsV.begin(), script->ledsV.end(), color);
+  script->changed = true;
+}
+static void _fillRow(uint16_t y, CRGB color) {
+  LiveScript *script = currentScript();
+  if (script && script->width && (y + 1) * script->width <= script->ledsV.size()) {
+    std::fill(script->ledsV.begin() + y * script->width, script->ledsV.begin() + (y + 1) * script->width, color);
+    script->changed = true;
+  }
+}
+//copy count leds within the framebuffer, e.g. to scroll
+static void _blit(uint16_t from, uint16_t to, uint16_t count) {
+  LiveScript *script = currentScript();
+  if (script && from + count <= script->ledsV.size() && to + count <= script->ledsV.size()) {
+    memmove(script->ledsV.data() + to, script->ledsV.data() + from, count * sizeof(CRGB));
+    script->changed = true;
+  }
+}
+static void _blur(uint8_t amount) {
+  LiveScript *script = currentScript();
+  if (script && script->width) {
+    blurBuffer2d(script->ledsV.data(), script->width, script->ledsV.size() / script->width, amount, script->scratch);
+    script->changed = true;
+  }
+}
+static void _sIdx(uint16_t pixel, uint8_t index) { //palette index, for paletteMap
+  LiveScript *script = currentScript();
+  if (script && pixel < script->indexes.size()) script->indexes[pixel] = index;
+}
+//all palette indexes to colors in one go
+static void _paletteMap(uint8_t brightness) {
+  LiveScript *script = currentScript();
+  if (!script || !script->leds) return;
+  for (size_t i = 0; i < script->ledsV.size(); i++)
+    script->ledsV[i] = script->leds->colorFromPalette(script->indexes[i], brightness);
+  script->changed = true;
+}
 //End LEDS specific
 
 class UserModLive:public SysModule {
@@ -122,9 +266,9 @@ class UserModLive:public SysModule {
 public:
 
   Parser p = Parser();
-  Executable myexec;
-  char fileName[32] = ""; //running sc file
   string scPreBaseScript = ""; //externals etc generated (would prefer String for esp32...)
+  std::vector<CompiledScript *> compiledScripts;
+  uint16_t budget = 0; //µs per frame per script, 0: no budget
 
   UserModLive() :SysModule("LiveScripts") {
     isEnabled = false; //need to enable after fresh setup
@@ -157,7 +301,7 @@ public:
           ppf("script.onChange f:%d n:%s\n", fileNr, web->lastFileUpdated);
         }
         else {
-          kill();
+          kill(nullptr); //the script without layer
           ppf("script.onChange set to None\n");
         }
 
@@ -178,52 +322,90 @@ public:
         return true;
       default: return false; 
     }});
+    ui->initNumber(parentVar, "budget", &budget, 0, 50000, false, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onUI:
+        ui->setComment(var, "µs per frame per script, slower scripts skip frames (0: no budget)");
+        return true;
+      default: return false; 
+    }});
+    ui->initText(parentVar, "compile", nullptr, 32, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onUI:
+        ui->setComment(var, "Last compile: time, peak heap, cached");
+        return true;
+      default: return false; 
+    }});
 
     JsonObject tableVar = ui->initTable(parentVar, "scripts", nullptr, true);
 
     ui->initText(tableVar, "name", nullptr, 32, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
       case onSetValue:
-        for (size_t rowNr = 0; rowNr < _MAX_PROG_AT_ONCE; rowNr++) {
-          if (runningPrograms.execPtr[rowNr]) {
-            const char *name = runningPrograms.execPtr[rowNr]->name.c_str();
-            mdl->setValue(var, JsonString(name?name:"xx", JsonString::Copied), rowNr);
+        for (size_t rowNr = 0; rowNr < nrOfLiveScriptsMax; rowNr++) {
+          if (liveScripts[rowNr])
+            mdl->setValue(var, JsonString(liveScripts[rowNr]->compiled->fileName, JsonString::Copied), rowNr);
+        }
+        return true;
+      default: return false;
+    }});
+    //LEDs specific
+    ui->initNumber(tableVar, "layer", UINT16_MAX, 0, UINT8_MAX, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onSetValue:
+        for (size_t rowNr = 0; rowNr < nrOfLiveScriptsMax; rowNr++) {
+          if (liveScripts[rowNr]) {
+            std::vector<LedsLayer *> &layers = eff->fixture.layers;
+            mdl->setValue(var, std::find(layers.begin(), layers.end(), liveScripts[rowNr]->leds) - layers.begin(), rowNr); //size if no layer
           }
         }
         return true;
       default: return false;
     }});
+    //End LEDs specific
     ui->initCheckBox(tableVar, "running", UINT8_MAX, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
       case onSetValue:
-        for (size_t rowNr = 0; rowNr < _MAX_PROG_AT_ONCE; rowNr++) {
-          if (runningPrograms.execPtr[rowNr])
-            mdl->setValue(var, runningPrograms.execPtr[rowNr]->isRunning(), rowNr);
+        for (size_t rowNr = 0; rowNr < nrOfLiveScriptsMax; rowNr++) {
+          if (liveScripts[rowNr])
+            mdl->setValue(var, liveScripts[rowNr]->compiled->exec.isRunning(), rowNr);
         }
         return true;
       default: return false;
     }});
-    ui->initCheckBox(tableVar, "halted", UINT8_MAX, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+    ui->initNumber(tableVar, "fps", UINT16_MAX, 0, UINT16_MAX, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
       case onSetValue:
-        for (size_t rowNr = 0; rowNr < _MAX_PROG_AT_ONCE; rowNr++) {
-          if (runningPrograms.execPtr[rowNr])
-            mdl->setValue(var, runningPrograms.execPtr[rowNr]->isHalted, rowNr);
+        for (size_t rowNr = 0; rowNr < nrOfLiveScriptsMax; rowNr++) {
+          if (liveScripts[rowNr])
+            mdl->setValue(var, liveScripts[rowNr]->fps, rowNr);
         }
         return true;
       default: return false;
     }});
-    ui->initCheckBox(tableVar, "exe", UINT8_MAX, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+    ui->initNumber(tableVar, "time", UINT16_MAX, 0, UINT16_MAX, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onUI:
+        ui->setComment(var, "µs per frame");
+        return true;
       case onSetValue:
-        for (size_t rowNr = 0; rowNr < _MAX_PROG_AT_ONCE; rowNr++) {
-          if (runningPrograms.execPtr[rowNr])
-            mdl->setValue(var, runningPrograms.execPtr[rowNr]->exeExist, rowNr);
+        for (size_t rowNr = 0; rowNr < nrOfLiveScriptsMax; rowNr++) {
+          if (liveScripts[rowNr])
+            mdl->setValue(var, min(liveScripts[rowNr]->scriptMicros, (unsigned long)UINT16_MAX), rowNr);
+        }
+        return true;
+      default: return false;
+    }});
+    ui->initText(tableVar, "latency", nullptr, 32, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onUI:
+        ui->setComment(var, "Script frame until shown, jitter");
+        return true;
+      case onSetValue:
+        for (size_t rowNr = 0; rowNr < nrOfLiveScriptsMax; rowNr++) {
+          if (liveScripts[rowNr])
+            mdl->setValue(var, JsonString(liveScripts[rowNr]->stats, JsonString::Copied), rowNr);
         }
         return true;
       default: return false;
     }});
     ui->initNumber(tableVar, "handle", UINT16_MAX, 0, UINT16_MAX, true, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
       case onSetValue:
-        for (size_t rowNr = 0; rowNr < _MAX_PROG_AT_ONCE; rowNr++) {
-          if (runningPrograms.execPtr[rowNr])
-            mdl->setValue(var, runningPrograms.execPtr[rowNr]->__run_handle_index, rowNr);
+        for (size_t rowNr = 0; rowNr < nrOfLiveScriptsMax; rowNr++) {
+          if (liveScripts[rowNr])
+            mdl->setValue(var, liveScripts[rowNr]->compiled->exec.__run_handle_index, rowNr);
         }
         return true;
       default: return false;
@@ -270,6 +452,12 @@ public:
     addExternalFun("void", "sPC", "(uint16_t a1, CRGB a2)", (void *)sPCLive);
     addExternalFun("void", "sCFP", "(uint16_t a1, uint8_t a2, uint8_t a3)", (void *)sCFPLive);
     addExternalFun("void", "fadeToBlackBy", "(uint8_t a1)", (void *)_fadeToBlackBy);
+    addExternalFun("void", "fill", "(CRGB a1)", (void *)_fill);
+    addExternalFun("void", "fillRow", "(uint16_t a1, CRGB a2)", (void *)_fillRow);
+    addExternalFun("void", "blit", "(uint16_t a1, uint16_t a2, uint16_t a3)", (void *)_blit);
+    addExternalFun("void", "blur", "(uint8_t a1)", (void *)_blur);
+    addExternalFun("void", "sIdx", "(uint16_t a1, uint8_t a2)", (void *)_sIdx);
+    addExternalFun("void", "paletteMap", "(uint8_t a1)", (void *)_paletteMap);
     //address of overloaded function with no contextual type information: setPixelColorLive
     //ISO C++ forbids taking the address of a bound member function to form a pointer to member function.  Say '&LedsLayer::setPixelColorLive' [-fpermissive]
     //converting from 'void (LedsLayer::*)(uint16_t, uint32_t)' {aka 'void (LedsLayer::*)(short unsigned int, unsigned int)'} to 'void*' [-Wpmf-conversions]
@@ -316,33 +504,90 @@ public:
     time1 = ESP.getCycleCount();
   }
 
-  void loop() {
-    if (myexec.isRunning()) {
-      if (loopState == 2) {// show has been called (in other loop)
-        loopState = 0; //waiting on live script
-        // ppf("loopState %d\n", loopState);
+  //called by the render loop in the effect loop of leds: a ready script frame is written into the layer in the order of the layers (blending)
+  //  not by the script task, which would write while the render loop renders (torn frames). The script waits in show() until released
+  void showFrame(LedsLayer &leds) {
+    for (LiveScript *script: liveScripts) {
+      if (script && script->leds == &leds && script->frameReady && script->changed) { //LEDS specific
+        LedsLayer *leds = script->leds;
+        //group fixture: only the own slice
+        size_t start = leds->ownSlice?min((size_t)leds->mappingOffset, script->ledsV.size()):0;
+        size_t end = min(script->ledsV.size(), leds->ownSlice?(size_t)leds->mappingOffset + leds->mappingTable.size():(size_t)leds->nrOfLeds);
+        if (end > start) leds->writePixels(start, end - start, script->ledsV.data() + start);
+        script->changed = false;
       }
-      else if (loopState == 1) {
-        loopState = 2; //other loop can call show (or preview)
-        // ppf("loopState %d\n", loopState);
+    }
+  }
+
+  //called by the render loop after a frame is shown, frameStartMicros: start of rendering the frame
+  //  a script frame ready before the frame started is in the shown frame: release the script for its next frame
+  //  scripts over the budget are released every holdFrames + 1 frames (cooperative, the render loop keeps its fps)
+  void frameShown(unsigned long frameStartMicros) {
+    for (LiveScript *script: liveScripts) {
+      if (!script || !script->frameReady || (long)(frameStartMicros - script->readyMicros) < 0) continue;
+
+      if (script->holdFrames) {
+        script->holdFrames--;
+        continue;
       }
+
+      unsigned long now = micros();
+      unsigned long latency = now - script->readyMicros;
+      script->latencySum += latency;
+      script->latencyMax = max(script->latencyMax, latency);
+      if (script->shownMicros) {
+        unsigned long interval = now - script->shownMicros;
+        script->jitterSum += (interval > script->interval)?interval - script->interval:script->interval - interval;
+        script->interval = script->interval?(script->interval * 7 + interval) / 8:interval;
+      }
+      script->shownMicros = now;
+      script->shownCounter++;
+
+      if (budget && script->scriptMicros > budget)
+        script->holdFrames = min(script->scriptMicros / budget, (unsigned long)8);
+
+      script->frameReady = false;
+      xSemaphoreGive(script->frameShown);
     }
   }
 
+  //run fileName on leds in loop20ms (leds are mapped by then)
+  void runOn(const char *fileName, LedsLayer *leds) {
+    runQueue.push_back({leds, ""});
+    strlcpy(runQueue.back().fileName, fileName, sizeof(runQueue.back().fileName));
+  }
+
   void loop20ms() {
+    std::vector<RunRequest> requests;
+    requests.swap(runQueue); //run calls kill which removes requests from runQueue
+    for (RunRequest &request: requests)
+      run(request.fileName, request.leds);
+
     //workaround
     if (strnstr(web->lastFileUpdated, ".sc", sizeof(web->lastFileUpdated)) != nullptr) {
       if (strnstr(web->lastFileUpdated, "del:/", sizeof(web->lastFileUpdated)) != nullptr) {
-        if (strncmp(this->fileName, web->lastFileUpdated+4, sizeof(this->fileName)) == 0) { //+4 remove del:
-          ppf("loop20ms kill %s\n", web->lastFileUpdated);
-          kill();
-          // ui->callVarFun("effect", "script", UINT8_MAX, onUI); //LEDs specific. rebuild options LEDs specific
+        for (LiveScript *script: liveScripts) {
+          if (script && strncmp(script->compiled->fileName, web->lastFileUpdated+4, sizeof(script->compiled->fileName)) == 0) { //+4 remove del:
+            ppf("loop20ms kill %s\n", web->lastFileUpdated);
+            kill(script->leds);
+          }
         }
-        //else nothing
+        // ui->callVarFun("effect", "script", UINT8_MAX, onUI); //LEDs specific. rebuild options LEDs specific
       }
       else {
-        ppf("loop20ms run %s -> %s\n", this->fileName, web->lastFileUpdated);
-        run(web->lastFileUpdated);
+        //hot reload: restart the scripts running the file (on their layers), else run it without layer (fixture scripts)
+        bool running = false;
+        for (LiveScript *script: liveScripts) {
+          if (script && strncmp(script->compiled->fileName, web->lastFileUpdated, sizeof(script->compiled->fileName)) == 0) {
+            ppf("loop20ms rerun %s\n", web->lastFileUpdated);
+            run(web->lastFileUpdated, script->leds);
+            running = true;
+          }
+        }
+        if (!running) {
+          ppf("loop20ms run %s\n", web->lastFileUpdated);
+          run(web->lastFileUpdated, nullptr);
+        }
         // ui->callVarFun("effect, "script", UINT8_MAX, onUI); //LEDs specific. rebuild options
       }
       strlcpy(web->lastFileUpdated, "", sizeof(web->lastFileUpdated));
@@ -350,14 +595,35 @@ public:
   }
 
   void loop1s() {
+    for (LiveScript *script: liveScripts) {
+      if (!script) continue;
+      script->fps = script->shownCounter;
+      if (script->shownCounter)
+        print->fFormat(script->stats, sizeof(script->stats), "%d µs (max %d) ±%d µs", script->latencySum / script->shownCounter, script->latencyMax, script->jitterSum / script->shownCounter);
+      else
+        strlcpy(script->stats, "-", sizeof(script->stats));
+      script->latencySum = 0;
+      script->latencyMax = 0;
+      script->jitterSum = 0;
+      script->shownCounter = 0;
+    }
+
     for (JsonObject childVar: Variable(mdl->findVar("LiveScripts", "scripts")).children())
       ui->callVarFun(childVar, UINT8_MAX, onSetValue); //set the value (WIP)
   }
 
-  void run(const char *fileName) {
-    ppf("live run n:%s o:%s (f:%d)\n", fileName, this->fileName);
+  //run fileName on leds (nullptr: no layer), a script already running on leds is killed
+  void run(const char *fileName, LedsLayer *leds) {
+    ppf("live run n:%s\n", fileName);
 
-    kill(); //kill any old script
+    kill(leds); //kill the old script of the layer
+
+    uint8_t slot = 0;
+    while (slot < nrOfLiveScriptsMax && liveScripts[slot]) slot++;
+    if (slot == nrOfLiveScriptsMax) {
+      ppf("live run %s: max %d scripts running\n", fileName, nrOfLiveScriptsMax);
+      return;
+    }
 
     if (fileName && strnlen(fileName, 32) > 0) {
 
@@ -366,63 +632,183 @@ public:
         ppf("UserModLive setup script open %s for %s failed\n", fileName, "r");
       else {
 
-        string scScript = scPreBaseScript;
+        string scDefines = "";
 
         //LEDs specific
-        if (gLeds != nullptr) {
-          scScript += "define width " + to_string(gLeds->size.x) + "\n";
-          scScript += "define height " + to_string(gLeds->size.y) + "\n";
-          scScript += "define NUM_LEDS " + to_string(gLeds->nrOfLeds) + "\n";
-          scScript += "define panel_width " + to_string(gLeds->size.x) + "\n"; //isn't panel_width always the same as width?
+        if (leds != nullptr) {
+          scDefines += "define width " + to_string(leds->size.x) + "\n";
+          scDefines += "define height " + to_string(leds->size.y) + "\n";
+          scDefines += "define NUM_LEDS " + to_string(leds->nrOfLeds) + "\n";
+          scDefines += "define panel_width " + to_string(leds->size.x) + "\n"; //isn't panel_width always the same as width?
         }
         //end LEDs specific
 
-        Serial.println(scScript.c_str()); //ppf has a max
-
-        unsigned preScriptNrOfLines = 0;
+        string scFile = string(f.readString().c_str());
+        f.close();
 
-        for (size_t i = 0; i < scScript.length(); i++)
-        {
-          if (scScript[i] == '\n')
-            preScriptNrOfLines++;
+        uint32_t fileHash = hash(scFile);
+        uint32_t definesHash = hash(scDefines);
+
+        CompiledScript *compiled = findCompiled(fileName, fileHash, definesHash);
+
+        if (compiled)
+          ppf("live run %s cached, no parsing\n", fileName);
+        else
+          compiled = compile(fileName, scDefines, scFile, fileHash, definesHash);
+
+        if (compiled) {
+          LiveScript *script = new LiveScript();
+          script->compiled = compiled;
+          //LEDs specific
+          script->leds = leds;
+          size_t nrOfLeds = leds?leds->nrOfLeds:0;
+          script->ledsV.assign(nrOfLeds, CRGB::Black);
+          script->indexes.assign(nrOfLeds, 0);
+          script->width = leds?leds->size.x:0;
+          //end LEDs specific
+          liveScripts[slot] = script;
+
+          compiled->lastUsed = millis();
+          liveScriptStarting = script;
+          compiled->exec.executeAsTask("main");
+          //wait until the script task is bound (resetStat), so externals find its context
+          if (xSemaphoreTake(liveScriptBound, pdMS_TO_TICKS(1000)) != pdTRUE) {
+            ppf("live run %s not bound\n", fileName);
+            liveScriptStarting = nullptr;
+          }
+          // ppf("setup done\n");
         }
+      }
+    }
+    else
+      ppf("UserModLive setup file for %s not found\n", fileName);
+  }
 
-        ppf("preScript of %s has %d lines\n", fileName, preScriptNrOfLines+1); //+1 to subtract the line from parser error line reported
-
-        scScript += string(f.readString().c_str()); // add sc file
-
-        scScript += "void main(){resetStat();setup();while(2>1){loop();show();}}"; //add main which calls setup and loop
+  //kill the script running on leds (nullptr: the script without layer), also the runs queued for leds (e.g. the layer is deleted)
+  void kill(LedsLayer *leds) {
+    runQueue.erase(std::remove_if(runQueue.begin(), runQueue.end(), [leds](const RunRequest &request) {return request.leds == leds;}), runQueue.end());
+
+    for (LiveScript *&script: liveScripts) {
+      if (script && script->leds == leds) {
+        ppf("kill %s\n", script->compiled->fileName);
+        if (script->compiled->exec.isRunning())
+          script->compiled->exec._kill(); //stops the task, the compiled script stays in compiledScripts
+        if (leds) leds->fadeToBlackBy(255); // LEDs specific
+        delete script;
+        script = nullptr;
+      }
+    }
+  }
 
-        ppf("Before parsing of %s\n", fileName);
-        ppf("%s:%d f:%d / t:%d (l:%d) B [%d %d]\n", __FUNCTION__, __LINE__, ESP.getFreeHeap(), ESP.getHeapSize(), ESP.getMaxAllocHeap(), esp_get_free_heap_size(), esp_get_free_internal_heap_size());
+private:
+  struct RunRequest {
+    LedsLayer *leds;
+    char fileName[32];
+  };
+  std::vector<RunRequest> runQueue;
 
-        myexec = p.parseScript(&scScript);
-        myexec.name = string(fileName);
+  bool inUse(CompiledScript *compiled) {
+    for (LiveScript *script: liveScripts)
+      if (script && script->compiled == compiled) return true;
+    return false;
+  }
 
-        if (myexec.exeExist)
-        {
-          ppf("parsing %s done\n", fileName);
-          ppf("%s:%d f:%d / t:%d (l:%d) B [%d %d]\n", __FUNCTION__, __LINE__, ESP.getFreeHeap(), ESP.getHeapSize(), ESP.getMaxAllocHeap(), esp_get_free_heap_size(), esp_get_free_internal_heap_size());
+  //FNV-1a
+  uint32_t hash(const string &text) {
+    uint32_t hash = 2166136261;
+    for (char c: text)
+      hash = (hash ^ (uint8_t)c) * 16777619;
+    return hash;
+  }
 
-          myexec.executeAsTask("main");
-          // ppf("setup done\n");
-          strlcpy(this->fileName, fileName, sizeof(this->fileName));
+  CompiledScript * findCompiled(const char *fileName, uint32_t fileHash, uint32_t definesHash) {
+    for (std::vector<CompiledScript *>::iterator it = compiledScripts.begin(); it != compiledScripts.end(); ) {
+      CompiledScript *compiled = *it;
+      if (strncmp(compiled->fileName, fileName, sizeof(compiled->fileName)) == 0) {
+        if (compiled->fileHash == fileHash && compiled->definesHash == definesHash && !inUse(compiled))
+          return compiled; //an executable runs one task, so the same script on two layers is compiled twice
+        if (compiled->fileHash != fileHash && !inUse(compiled)) { //file changed: hot reload, other defines of the old file are stale too
+          ppf("live %s changed, remove compiled\n", fileName);
+          freeCompiled(compiled);
+          it = compiledScripts.erase(it);
+          continue;
         }
-        f.close();
       }
+      ++it;
     }
-    else
-      ppf("UserModLive setup file for %s not found\n", fileName);
+    return nullptr;
   }
 
-  void kill() {
-    if (myexec.isRunning()) {
-      ppf("kill %s\n", fileName);
-      myexec._kill();
-      fps = 0;
-      strlcpy(fileName, "", sizeof(fileName));
-      if (gLeds) gLeds->fadeToBlackBy(255); // LEDs specific
+  CompiledScript * compile(const char *fileName, const string &scDefines, const string &scFile, uint32_t fileHash, uint32_t definesHash) {
+    string scScript = scPreBaseScript + scDefines;
+
+    Serial.println(scScript.c_str()); //ppf has a max
+
+    unsigned preScriptNrOfLines = 0;
+
+    for (size_t i = 0; i < scScript.length(); i++)
+    {
+      if (scScript[i] == '\n')
+        preScriptNrOfLines++;
+    }
+
+    ppf("preScript of %s has %d lines\n", fileName, preScriptNrOfLines+1); //+1 to subtract the line from parser error line reported
+
+    scScript += scFile; // add sc file
+
+    scScript += "void main(){resetStat();setup();while(2>1){loop();show();}}"; //add main which calls setup and loop
+
+    //make room: least recently used first, not the running scripts
+    while (compiledScripts.size() >= nrOfCompiledScriptsMax || (compiledScripts.size() && ESP.getMaxAllocHeap() < scScript.length() * 8)) {
+      std::vector<CompiledScript *>::iterator oldest = compiledScripts.end();
+      for (std::vector<CompiledScript *>::iterator it = compiledScripts.begin(); it != compiledScripts.end(); ++it)
+        if (!inUse(*it) && (oldest == compiledScripts.end() || (*it)->lastUsed < (*oldest)->lastUsed)) oldest = it;
+      if (oldest == compiledScripts.end()) break; //all running
+      ppf("live remove compiled %s\n", (*oldest)->fileName);
+      freeCompiled(*oldest);
+      compiledScripts.erase(oldest);
     }
+
+    ppf("Before parsing of %s\n", fileName);
+    ppf("%s:%d f:%d / t:%d (l:%d) B [%d %d]\n", __FUNCTION__, __LINE__, ESP.getFreeHeap(), ESP.getHeapSize(), ESP.getMaxAllocHeap(), esp_get_free_heap_size(), esp_get_free_internal_heap_size());
+
+    //heap high-water: the lifetime minimum free heap only goes down, if it did during parsing that is the low point of the compile
+    uint32_t freeBefore = ESP.getFreeHeap();
+    uint32_t minFreeBefore = ESP.getMinFreeHeap();
+    unsigned long startMillis = millis();
+
+    CompiledScript *compiled = new CompiledScript();
+    compiled->exec = p.parseScript(&scScript);
+    compiled->exec.name = string(fileName);
+
+    uint32_t lowest = (ESP.getMinFreeHeap() < minFreeBefore)?ESP.getMinFreeHeap():ESP.getFreeHeap(); //else only what the compiled script keeps is known
+    uint32_t peak = (freeBefore > lowest)?freeBefore - lowest:0;
+
+    JsonObject compileVar = mdl->findVar("LiveScripts", "compile");
+
+    if (!compiled->exec.exeExist) {
+      delete compiled;
+      mdl->setValue(compileVar, "%s failed %d ms", fileName, millis() - startMillis);
+      return nullptr;
+    }
+
+    ppf("parsing %s done\n", fileName);
+    ppf("%s:%d f:%d / t:%d (l:%d) B [%d %d]\n", __FUNCTION__, __LINE__, ESP.getFreeHeap(), ESP.getHeapSize(), ESP.getMaxAllocHeap(), esp_get_free_heap_size(), esp_get_free_internal_heap_size());
+    ppf("live compile %s %d ms peak heap %d B\n", fileName, millis() - startMillis, peak);
+
+    strlcpy(compiled->fileName, fileName, sizeof(compiled->fileName));
+    compiled->fileHash = fileHash;
+    compiled->definesHash = definesHash;
+    compiledScripts.push_back(compiled);
+
+    mdl->setValue(compileVar, "%d ms %d KB %d cached", millis() - startMillis, peak / 1024, compiledScripts.size());
+
+    return compiled;
+  }
+
+  void freeCompiled(CompiledScript *compiled) {
+    compiled->exec.free(); //the compiled binary
+    delete compiled;
   }
 
 };
@@ -461,6 +847,12 @@ external uint8_t cos8(uint8_t a1);
 external void sPC(uint16_t a1, CRGB a2);
 external void sCFP(uint16_t a1, uint8_t a2, uint8_t a3);
 external void fadeToBlackBy(uint8_t a1);
+external void fill(CRGB a1);
+external void fillRow(uint16_t a1, CRGB a2);
+external void blit(uint16_t a1, uint16_t a2, uint16_t a3);
+external void blur(uint8_t a1);
+external void sIdx(uint16_t a1, uint8_t a2);
+external void paletteMap(uint8_t a1);
 define width 32
 define height 32
 define NUM_LEDS 1024
@@ -15,19 +15,30 @@
 #include "../Sys/SysModPins.h"
 
 #include <MPU6050_6Axis_MotionApps20.h>
+#include <atomic>
 
 //see https://github.com/ElectronicCats/mpu6050/blob/0281cd4532b36922f4d68a4cae70eca7aebe9988/examples/MPU6050_DMP6/MPU6050_DMP6.ino
 
+//orientation and acceleration of a DMP FIFO packet
+struct MotionFrame {
+  Quaternion q; //fused by the DMP
+  VectorInt16 accel; //gravity-free, low pass filtered
+  unsigned long micros = 0; //read time
+};
+
 class UserModMPU6050: public SysModule {
 
 public:
 
   bool motionTrackingReady = false;  // set true if DMP init was successful
 
+  //per frame, set by newFrame: same values for all pixels of a frame
   Coord3D gyro; // in degrees (not radians)
   Coord3D accell;
   VectorFloat gravityVector;
 
+  uint8_t interruptPin = UINT8_MAX; //INT of the MPU6050, UINT8_MAX: poll at the DMP rate
+
   UserModMPU6050() :SysModule("Motion Tracking") {
     isEnabled = false; //need to enable after fresh setup
   };
@@ -63,6 +74,16 @@ public:
       default: return false;
     }}); 
 
+    ui->initPin(parentVar, "interrupt", &interruptPin, false, [this](JsonObject var, uint8_t rowNr, uint8_t funType) { switch (funType) { //varFun
+      case onUI:
+        ui->setComment(var, "Data ready pin (INT), none: poll");
+        return true;
+      case onChange:
+        attachDataReady();
+        return true;
+      default: return false;
+    }});
+
     if (pinsM->initI2S()) {
       mpu.initialize();
 
@@ -96,55 +117,142 @@ public:
     }
 
     mdl->setValue("Motion Tracking", "ready", motionTrackingReady);
-  }
 
-  void loop20ms() { // loop(): 700/s, loop20ms: 3000/s, loop1s(): 5500/s, disabled: 6000/s
-    // mpu.getMotion6(&accell.x, &accell.y, &accell.z, &gyro.x, &gyro.y, &gyro.z);
-    // // display tab-separated accel/gyro x/y/z values
-    // ppf("mpu6050 %d,%d,%d %d,%d,%d\n", accell.x, accell.y, accell.z, gyro.x, gyro.y, gyro.z);
-
-    // if programming failed, don't try to do anything
-    if (!motionTrackingReady) return;
-    // read a packet from FIFO
-    if (mpu.dmpGetCurrentFIFOPacket(fifoBuffer)) { // Get the Latest packet 
-      mpu.dmpGetQuaternion(&q, fifoBuffer);
-      mpu.dmpGetGravity(&gravity, &q);
-      mpu.dmpGetYawPitchRoll(ypr, &q, &gravity);
-      gyro.y = ypr[0] * 180/M_PI; //pan = yaw !
-      gyro.x = ypr[1] * 180/M_PI; //tilt = pitch !
-      gyro.z = ypr[2] * 180/M_PI; //roll = roll
-      gravityVector = gravity;
-      // display real acceleration, adjusted to remove gravity
+    if (motionTrackingReady) {
+      //FIFO reads (I2C) on core 0: loop(): 700/s, loop20ms: 3000/s, loop1s(): 5500/s, disabled: 6000/s
+      xTaskCreatePinnedToCore(mpuTask, "mpuTask", 4096, this, tskIDLE_PRIORITY + 2, &mpuTaskHandle, 0);
+      attachDataReady();
+    }
+  }
 
-      //needed to repeat the following 3 lines (yes if you look at the output: otherwise not 0)
-      mpu.dmpGetQuaternion(&q, fifoBuffer); 
-      mpu.dmpGetAccel(&aa, fifoBuffer);
-      mpu.dmpGetGravity(&gravity, &q);
+  //called by the render loop at the start of a frame: orientation predicted to the frame, converted once per frame instead of per pixel
+  void newFrame(unsigned long frameStartMicros) {
+    if (!motionTrackingReady || !isEnabled) return;
 
-      mpu.dmpGetLinearAccel(&aaReal, &aa, &gravity);
-      // mpu.dmpGetLinearAccelInWorld(&aaWorld, &aaReal, &q); //worked in 0.6.0, not in 1.3.0 anymore
+    MotionFrame frame = motion(frameStartMicros);
+    float ypr[3];           // [yaw, pitch, roll]   yaw/pitch/roll container and gravity vector
+    mpu.dmpGetGravity(&gravityVector, &frame.q);
+    mpu.dmpGetYawPitchRoll(ypr, &frame.q, &gravityVector);
+    gyro.y = ypr[0] * 180/M_PI; //pan = yaw !
+    gyro.x = ypr[1] * 180/M_PI; //tilt = pitch !
+    gyro.z = ypr[2] * 180/M_PI; //roll = roll
+    accell.x = frame.accel.x;
+    accell.y = frame.accel.y;
+    accell.z = frame.accel.z;
+  }
 
-      accell.x = aaReal.x;
-      accell.y = aaReal.y;
-      accell.z = aaReal.z;
+  //orientation at time now, safe to call from any task
+  //  the rotation between the last two packets is extrapolated (at most one packet interval): packets come at 100 Hz, frames faster
+  MotionFrame motion(unsigned long now = micros()) {
+    MotionFrame previous, current;
+    //seqlock: motionSeq is odd while publish writes, retry if it changed during the copy
+    for (;;) {
+      uint32_t seq = motionSeq.load(std::memory_order_acquire);
+      if (seq & 1) {
+        taskYIELD(); //writer on the same core
+        continue;
+      }
+      previous = motionFrames[0];
+      current = motionFrames[1];
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (motionSeq.load(std::memory_order_relaxed) == seq) break;
     }
+
+    unsigned long interval = current.micros - previous.micros;
+    if (previous.micros == 0 || interval == 0 || interval > 100000) return current; //no previous packet or stalled: no prediction
+    if ((long)(now - current.micros) <= 0) return current;
+    float t = min((float)(now - current.micros) / interval, 1.0f);
+
+    //normalized linear extrapolation, accurate enough for the small rotation of one interval
+    Quaternion &p = previous.q;
+    Quaternion &c = current.q;
+    float sign = (p.w * c.w + p.x * c.x + p.y * c.y + p.z * c.z < 0)?-1:1; //q and -q are the same rotation
+    MotionFrame frame = current;
+    frame.q = Quaternion(c.w + (c.w - sign * p.w) * t, c.x + (c.x - sign * p.x) * t, c.y + (c.y - sign * p.y) * t, c.z + (c.z - sign * p.z) * t);
+    frame.q.normalize();
+    frame.micros = now;
+    return frame;
   }
 
   private:
     MPU6050 mpu;
 
+    TaskHandle_t mpuTaskHandle = nullptr;
+    uint8_t attachedPin = UINT8_MAX;
+
+    //last two packets [previous, current], written by mpuTask, see motion
+    MotionFrame motionFrames[2];
+    std::atomic<uint32_t> motionSeq{0}; //odd while writing
+    VectorFloat accelSmth;
+
     // MPU control/status vars
     uint8_t devStatus;      // return status after each device operation (0 = success, !0 = error)
     uint8_t fifoBuffer[64]; // FIFO storage buffer
 
     // orientation/motion vars
-    Quaternion q;           // [w, x, y, z]         quaternion container
     VectorInt16 aa;         // [x, y, z]            accel sensor measurements
     VectorInt16 aaReal;     // [x, y, z]            gravity-free accel sensor measurements
     // VectorInt16 aaWorld;    // [x, y, z]            world-frame accel sensor measurements
     VectorFloat gravity;    // [x, y, z]            gravity vector
     // float euler[3];         // [psi, theta, phi]    Euler angle container
-    float ypr[3];           // [yaw, pitch, roll]   yaw/pitch/roll container and gravity vector
+
+    static void IRAM_ATTR dataReady(void *arg) {
+      BaseType_t woken = pdFALSE;
+      vTaskNotifyGiveFromISR(((UserModMPU6050 *)arg)->mpuTaskHandle, &woken);
+      if (woken) portYIELD_FROM_ISR();
+    }
+
+    static void mpuTask(void *parameter) {
+      UserModMPU6050 *mpuM = (UserModMPU6050 *)parameter;
+      for (;;) {
+        //woken by data ready, or poll at the DMP rate (100 Hz)
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(mpuM->attachedPin != UINT8_MAX?50:10));
+        if (mpuM->isEnabled) mpuM->readFIFO();
+      }
+    }
+
+    void attachDataReady() {
+      if (attachedPin != UINT8_MAX) {
+        detachInterrupt(attachedPin);
+        pinsM->deallocatePin(attachedPin, "MPU6050");
+        attachedPin = UINT8_MAX;
+      }
+      if (mpuTaskHandle && interruptPin < NUM_DIGITAL_PINS) {
+        pinMode(interruptPin, INPUT);
+        attachInterruptArg(interruptPin, dataReady, this, RISING);
+        pinsM->allocatePin(interruptPin, "MPU6050", "Interrupt");
+        attachedPin = interruptPin;
+      }
+    }
+
+    //read the latest packet and publish it (mpuTask)
+    void readFIFO() {
+      if (!mpu.dmpGetCurrentFIFOPacket(fifoBuffer)) return; // Get the Latest packet 
+
+      MotionFrame frame;
+      mpu.dmpGetQuaternion(&frame.q, fifoBuffer);
+      mpu.dmpGetAccel(&aa, fifoBuffer);
+      mpu.dmpGetGravity(&gravity, &frame.q);
+      // display real acceleration, adjusted to remove gravity
+      mpu.dmpGetLinearAccel(&aaReal, &aa, &gravity);
+      // mpu.dmpGetLinearAccelInWorld(&aaWorld, &aaReal, &q); //worked in 0.6.0, not in 1.3.0 anymore
+
+      //the orientation is fused by the DMP, the acceleration is noisy: low pass
+      accelSmth.x = accelSmth.x * 0.5f + aaReal.x * 0.5f;
+      accelSmth.y = accelSmth.y * 0.5f + aaReal.y * 0.5f;
+      accelSmth.z = accelSmth.z * 0.5f + aaReal.z * 0.5f;
+      frame.accel.x = accelSmth.x;
+      frame.accel.y = accelSmth.y;
+      frame.accel.z = accelSmth.z;
+      frame.micros = micros();
+
+      uint32_t seq = motionSeq.load(std::memory_order_relaxed);
+      motionSeq.store(seq + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      motionFrames[0] = motionFrames[1];
+      motionFrames[1] = frame;
+      motionSeq.store(seq + 2, std::memory_order_release);
+    }
 
 };
 
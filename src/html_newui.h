@@ -7,644 +7,650 @@
  */
  
 // Autogenerated from data/newui/index.htm, do not edit!!
-const uint16_t PAGE_newui_L = 10206;
+const uint16_t PAGE_newui_L = 10285;
+const char PAGE_newui_ETag[] = "\"bb6e58519b9d8fe8\"";
 const uint8_t PAGE_newui[] PROGMEM = {
-  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0xd5, 0x7d, 0x49, 0x76, 0xe3, 0xc8,
-  0x92, 0xe0, 0x5e, 0xa7, 0x40, 0x20, 0xb3, 0x24, 0x20, 0x08, 0x82, 0xe0, 0x28, 0x89, 0x14, 0x18,
-  0x5f, 0x63, 0x84, 0x62, 0x54, 0x6a, 0x88, 0xb1, 0xf4, 0xbe, 0x40, 0xc2, 0x49, 0x22, 0x04, 0x02,
-  0x48, 0x00, 0x14, 0x45, 0x31, 0x78, 0x83, 0x5e, 0xf5, 0xab, 0x45, 0xed, 0x6a, 0xdd, 0xaf, 0xef,
-  0xd0, 0x8b, 0x3e, 0x4a, 0x9f, 0xa0, 0x8e, 0xd0, 0x66, 0x3e, 0x60, 0x20, 0xa1, 0x21, 0xf2, 0x67,
-  0xfd, 0x57, 0x19, 0x03, 0x09, 0x98, 0x9b, 0xbb, 0x9b, 0x9b, 0x9b, 0xdb, 0xe0, 0x13, 0xa5, 0x9d,
-  0x67, 0x07, 0x1f, 0xf6, 0xcf, 0xbf, 0x9c, 0x1c, 0x4a, 0xa3, 0x78, 0xec, 0x76, 0xa5, 0x1d, 0xf1,
-  0x45, 0x2c, 0x1b, 0xbe, 0xc6, 0x24, 0xb6, 0xa4, 0xfe, 0xc8, 0x0a, 0x23, 0x12, 0x9b, 0xf2, 0x24,
-  0x1e, 0x94, 0xb7, 0xe4, 0x04, 0xec, 0x7b, 0x31, 0xf1, 0x00, 0x3c, 0x23, 0x91, 0x2c, 0xad, 0x79,
-  0xd6, 0x98, 0x98, 0xb2, 0x15, 0x04, 0x2e, 0x29, 0x8f, 0xfd, 0x9e, 0x03, 0x5f, 0x53, 0xd2, 0x2b,
-  0x03, 0xa0, 0xdc, 0xb7, 0x02, 0xab, 0xe7, 0x92, 0x24, 0xe7, 0x5a, 0x92, 0x75, 0xea, 0xd8, 0xf1,
-  0xc8, 0xb4, 0xc9, 0x8d, 0xd3, 0x07, 0x74, 0x7c, 0xd1, 0x1c, 0xcf, 0x89, 0x1d, 0xcb, 0x2d, 0x47,
-  0x7d, 0xcb, 0x25, 0x66, 0x55, 0x96, 0x58, 0xc1, 0x37, 0x0e, 0x99, 0x06, 0x7e, 0x18, 0xa7, 0x85,
-  0xf0, 0x0a, 0x27, 0xf1, 0xc8, 0x0f, 0xe5, 0x94, 0x9a, 0x77, 0xbe, 0xef, 0xbd, 0xf3, 0xed, 0x89,
-  0x4b, 0x22, 0xc9, 0xf2, 0x6c, 0xc9, 0x89, 0x23, 0x9a, 0x18, 0x3a, 0xbd, 0x49, 0xec, 0x87, 0x11,
-  0x16, 0xe0, 0x3a, 0xde, 0xb5, 0x14, 0x12, 0xd7, 0x94, 0x1d, 0x48, 0x02, 0xe2, 0x47, 0x21, 0x19,
-  0x98, 0xb2, 0x6d, 0xc5, 0x56, 0xdb, 0x19, 0x5b, 0x43, 0x52, 0x09, 0xbc, 0x61, 0xa7, 0x67, 0x45,
-  0xa4, 0xd5, 0xd0, 0x9c, 0x8f, 0x7b, 0x1f, 0x4e, 0xa7, 0xc6, 0x9b, 0x97, 0x43, 0x7f, 0x17, 0xfe,
-  0xbc, 0x3f, 0xbb, 0x18, 0x1d, 0x5e, 0x0c, 0xe1, 0x69, 0x0f, 0x5f, 0x77, 0x7f, 0xdb, 0xdf, 0xfd,
-  0x82, 0xdf, 0x83, 0xad, 0xca, 0xf6, 0x88, 0x42, 0x3e, 0xbf, 0x3f, 0x3b, 0x35, 0x8e, 0x77, 0xc3,
-  0xa8, 0xd1, 0x6f, 0xfd, 0x06, 0xef, 0x87, 0xa7, 0xee, 0xa7, 0x43, 0x77, 0x7c, 0x7e, 0x61, 0xec,
-  0xbe, 0xc1, 0x7c, 0xbb, 0xf0, 0xf1, 0xc5, 0x0e, 0x20, 0xeb, 0xae, 0x28, 0xe5, 0x25, 0x85, 0xc3,
-  0x9f, 0x16, 0xbe, 0xbf, 0xe3, 0xf0, 0xc3, 0xdd, 0xdd, 0x37, 0xbb, 0xfb, 0x59, 0xbc, 0xc3, 0x37,
-  0xbb, 0x07, 0xb9, 0x77, 0x96, 0xcb, 0xf8, 0xf8, 0xf9, 0xd5, 0x0c, 0x61, 0xb5, 0x43, 0xf7, 0xf0,
-  0xb7, 0x8f, 0xbf, 0x35, 0x0e, 0xbf, 0x7c, 0x3c, 0x3b, 0xbf, 0x88, 0x7b, 0x17, 0xa7, 0xbb, 0xdb,
-  0x5b, 0xb7, 0x6f, 0xce, 0xdd, 0x97, 0x7b, 0x17, 0x77, 0x87, 0x5f, 0xdf, 0x1c, 0x5d, 0xbc, 0xda,
-  0x73, 0xfb, 0x1f, 0x9d, 0xa3, 0x3d, 0xfb, 0x6c, 0xdf, 0x7d, 0x6d, 0x9d, 0x5d, 0xbf, 0xae, 0x7f,
-  0x26, 0xe1, 0x7e, 0x7c, 0x7e, 0xf3, 0xf9, 0xf4, 0xe3, 0xec, 0x75, 0x63, 0x77, 0xcb, 0x7f, 0x1b,
-  0xdf, 0x56, 0xbd, 0xd9, 0x6e, 0xdc, 0xbb, 0xf6, 0x3f, 0x87, 0x9f, 0xf6, 0x5d, 0xdf, 0x36, 0x7e,
-  0x3f, 0x3a, 0xfe, 0x6c, 0x8d, 0x4e, 0x5f, 0xf6, 0x3e, 0xbd, 0x7c, 0x4f, 0xce, 0xde, 0x37, 0x8d,
-  0x66, 0xd8, 0x3c, 0x39, 0x69, 0x1c, 0x1f, 0x6c, 0x6e, 0x57, 0xef, 0x9a, 0xcd, 0xe9, 0x9d, 0xbd,
-  0x39, 0xaa, 0xef, 0xef, 0xd5, 0xf6, 0x67, 0x95, 0xeb, 0x7e, 0xed, 0xe6, 0x7c, 0xdf, 0x38, 0x78,
-  0x55, 0x3a, 0xdb, 0xfb, 0xe0, 0xf6, 0xea, 0xf6, 0xeb, 0xd6, 0x27, 0xeb, 0x6c, 0x70, 0x77, 0x7b,
-  0xe2, 0x37, 0xdd, 0xd6, 0x7e, 0x23, 0xfa, 0x3c, 0x25, 0xc3, 0xbb, 0x93, 0x0f, 0x87, 0xfd, 0x83,
-  0xb1, 0xe1, 0x18, 0x1f, 0x9d, 0xd1, 0xed, 0xdd, 0xe4, 0xf3, 0x45, 0xbf, 0x54, 0xdd, 0xf5, 0xee,
-  0xa6, 0xef, 0xfc, 0x0f, 0x95, 0xad, 0x8b, 0xad, 0xe1, 0xc9, 0xf1, 0xf8, 0xcd, 0x6e, 0x74, 0xd7,
-  0xf8, 0x1e, 0x6f, 0x7e, 0x7a, 0x77, 0x1b, 0x6e, 0x5f, 0x9c, 0xbc, 0xbf, 0x73, 0x87, 0x95, 0x77,
-  0x9f, 0xfc, 0xea, 0x8d, 0x7d, 0x70, 0x16, 0xfe, 0xb6, 0x3b, 0x09, 0x5f, 0x8f, 0x5e, 0xef, 0xed,
-  0x6d, 0xce, 0x06, 0x77, 0x46, 0xf8, 0x76, 0x50, 0x6f, 0xd8, 0x9f, 0xa3, 0xf3, 0x93, 0x37, 0xdf,
-  0xbf, 0x8c, 0xbf, 0x6e, 0xbe, 0xd9, 0x6d, 0x6c, 0x8e, 0xce, 0x66, 0x5b, 0x6f, 0x4b, 0xbd, 0xe1,
-  0xe7, 0xed, 0xda, 0xd9, 0xd9, 0xcb, 0xd3, 0xcd, 0xa0, 0x77, 0x31, 0x76, 0x76, 0x5f, 0x5f, 0x47,
-  0x1f, 0x5f, 0xf7, 0xdf, 0x7d, 0x78, 0x79, 0x70, 0x3d, 0xfa, 0x7e, 0xe2, 0x5d, 0x4f, 0x76, 0x9b,
-  0x93, 0xf7, 0x47, 0x07, 0x83, 0x52, 0xed, 0xb8, 0x74, 0xfb, 0x35, 0x3c, 0x9f, 0xfe, 0xfe, 0xfb,
-  0xe9, 0xb0, 0xfe, 0xba, 0x74, 0x58, 0x3f, 0x1c, 0xec, 0x9f, 0xbc, 0x3b, 0x9e, 0x06, 0xce, 0xf9,
-  0xd7, 0xd2, 0xf9, 0xf4, 0xd3, 0xe8, 0x73, 0xbf, 0x37, 0x1a, 0x5b, 0xe3, 0xbb, 0x2f, 0x6f, 0x7a,
-  0xd3, 0xaf, 0x07, 0xbf, 0xdb, 0x2f, 0x5b, 0xb5, 0xcd, 0xdd, 0xdd, 0xad, 0x8f, 0xb7, 0x87, 0xbb,
-  0x67, 0x37, 0xe7, 0xc3, 0xca, 0xb9, 0x11, 0xbe, 0xe9, 0xbf, 0xf9, 0x7a, 0xd6, 0x1b, 0x59, 0xf1,
-  0x56, 0xf0, 0xde, 0x1b, 0xec, 0x9e, 0x54, 0x2b, 0xd5, 0x69, 0xef, 0x6b, 0x69, 0x56, 0x6a, 0xed,
-  0xb5, 0x36, 0xbf, 0x7b, 0x77, 0x9b, 0xa3, 0x7d, 0xc3, 0x73, 0x8f, 0x1b, 0xdb, 0x37, 0x1e, 0xb0,
-  0xeb, 0x4b, 0xfc, 0xe1, 0xec, 0x6b, 0xe9, 0xb4, 0x15, 0x1a, 0xe3, 0x99, 0xd1, 0x0a, 0x0e, 0x87,
-  0x6f, 0xc3, 0xca, 0xe4, 0xb4, 0x17, 0x6f, 0x07, 0xfb, 0x5b, 0xc3, 0xcf, 0x7b, 0x47, 0x87, 0x33,
-  0x23, 0x30, 0x0e, 0x3e, 0x7c, 0xad, 0x46, 0xa7, 0x9f, 0xae, 0x67, 0xbb, 0x7b, 0x4e, 0x74, 0xf6,
-  0xb2, 0xbe, 0xbb, 0xf5, 0x7a, 0xf3, 0xf5, 0x51, 0x70, 0xd7, 0x7f, 0x1b, 0x7e, 0xba, 0x7d, 0xf5,
-  0xdd, 0x32, 0xac, 0x19, 0x0c, 0x93, 0xb3, 0xf0, 0x95, 0xef, 0x0e, 0x0f, 0xbc, 0xe9, 0xf9, 0x66,
-  0xe9, 0xd3, 0x60, 0x36, 0x79, 0xf7, 0xe9, 0xeb, 0xd7, 0xca, 0x6d, 0x7f, 0xbb, 0x69, 0x0d, 0x1b,
-  0xef, 0xf6, 0xcf, 0xbf, 0x5e, 0x94, 0x4e, 0x2b, 0x1f, 0xea, 0xfb, 0xce, 0x30, 0xf8, 0xed, 0xee,
-  0xd3, 0xf1, 0x28, 0xac, 0x1d, 0x9d, 0xbe, 0x79, 0xfb, 0xca, 0x79, 0x7d, 0xf3, 0xfe, 0x8d, 0xfb,
-  0xf6, 0xf5, 0xde, 0xe9, 0x98, 0x34, 0x5a, 0xa3, 0xaf, 0x5b, 0x5f, 0xea, 0xf5, 0x2d, 0xe2, 0x7c,
-  0xbf, 0xae, 0x7e, 0x6a, 0x5e, 0xdf, 0xbd, 0x0a, 0x7a, 0x5b, 0xf1, 0xf5, 0xcb, 0xdd, 0xc9, 0xfe,
-  0xc7, 0xe9, 0xe7, 0x13, 0xd2, 0x08, 0x86, 0xfb, 0x67, 0xfd, 0xdb, 0xb3, 0x5d, 0x77, 0x4a, 0x8e,
-  0x4e, 0x5a, 0xa5, 0xfd, 0x41, 0xf8, 0xb1, 0xf2, 0xa1, 0xf9, 0xe9, 0xd5, 0x9b, 0x7a, 0xe3, 0xae,
-  0xd2, 0x34, 0xac, 0xe3, 0xfe, 0xe8, 0xb7, 0x57, 0x7b, 0x4d, 0x26, 0x9a, 0xaf, 0x4f, 0x2f, 0x9a,
-  0x87, 0xe1, 0xf5, 0xeb, 0xe1, 0x70, 0x68, 0x9a, 0x72, 0x77, 0x4d, 0xda, 0x89, 0xfa, 0xa1, 0x13,
-  0xc4, 0xdd, 0x4a, 0x45, 0xfa, 0x9b, 0x0b, 0x63, 0xdd, 0x8b, 0x88, 0x24, 0x49, 0x2f, 0xdf, 0x5f,
-  0x48, 0x2f, 0x0f, 0xdf, 0x1f, 0x9e, 0xee, 0xbe, 0x95, 0x4e, 0x2e, 0xf6, 0xde, 0x1e, 0xef, 0x4b,
-  0xf0, 0xff, 0xf0, 0xfd, 0xd9, 0xa1, 0xf4, 0x91, 0x84, 0x91, 0xe3, 0x7b, 0x52, 0x5d, 0x93, 0x6a,
-  0xdb, 0xd2, 0xeb, 0x89, 0x47, 0xa4, 0x9a, 0x61, 0x6c, 0xae, 0xe5, 0x0b, 0x38, 0xf2, 0x43, 0xc9,
-  0x03, 0xac, 0x97, 0x27, 0x6f, 0xcb, 0x37, 0x75, 0x69, 0x12, 0xc1, 0xd0, 0xd5, 0x60, 0xb4, 0x8f,
-  0xc7, 0x24, 0xec, 0x83, 0x12, 0x91, 0x38, 0x6a, 0x24, 0x8d, 0x27, 0x51, 0x2c, 0xf5, 0x88, 0x14,
-  0x4c, 0x42, 0x50, 0x67, 0x11, 0xb1, 0x75, 0x69, 0x1f, 0x94, 0x82, 0xd5, 0x8f, 0xa5, 0x31, 0x28,
-  0x8c, 0x31, 0x53, 0x18, 0x7f, 0x73, 0xfa, 0xae, 0x3f, 0xb1, 0x75, 0x28, 0x61, 0xad, 0xef, 0x5a,
-  0x51, 0x44, 0x91, 0x42, 0xdf, 0x75, 0x49, 0x38, 0x9f, 0x46, 0xa6, 0x37, 0x71, 0xdd, 0x4e, 0x34,
-  0x8b, 0x8e, 0xbd, 0x81, 0x6f, 0xce, 0x17, 0x1d, 0x9e, 0x8d, 0xc1, 0xe3, 0x11, 0x01, 0x85, 0x44,
-  0x1f, 0xc7, 0x96, 0xe3, 0xbd, 0xb7, 0x6e, 0xd8, 0x8b, 0xef, 0xbd, 0xf5, 0x2d, 0x5b, 0x51, 0xe7,
-  0xb6, 0xdf, 0x9f, 0x8c, 0x41, 0x47, 0xe9, 0xb1, 0x13, 0x83, 0x6a, 0x03, 0xcd, 0xf8, 0x1e, 0x54,
-  0x98, 0xa2, 0x96, 0xe4, 0xff, 0xfc, 0x8f, 0xff, 0xf9, 0xbf, 0xa5, 0xde, 0x4c, 0xca, 0xea, 0xae,
-  0xff, 0xfc, 0x8f, 0xff, 0xf1, 0x6f, 0xb2, 0x36, 0x75, 0x3c, 0xdb, 0x9f, 0xea, 0xae, 0xdf, 0xb7,
-  0x62, 0xe0, 0x87, 0x8e, 0x8a, 0x4a, 0x77, 0xbc, 0xbe, 0x3b, 0xb1, 0x49, 0xa4, 0xc8, 0xd5, 0xda,
-  0xa6, 0x6e, 0xc0, 0xdf, 0xaa, 0xac, 0xbe, 0x88, 0x47, 0x4e, 0xa4, 0x0f, 0x48, 0xdc, 0x1f, 0x41,
-  0x11, 0xc4, 0x05, 0xde, 0xbc, 0x75, 0x6e, 0xc8, 0x19, 0x09, 0x6f, 0x48, 0xa8, 0xa8, 0x6d, 0x9a,
-  0x3c, 0xb6, 0xae, 0xc9, 0xa7, 0x33, 0x45, 0xd5, 0xd8, 0x9b, 0x20, 0x9f, 0x4c, 0x25, 0x5e, 0x2d,
-  0x4b, 0xe0, 0x4d, 0x01, 0xf0, 0x39, 0x3e, 0x65, 0x80, 0x7a, 0x3f, 0x24, 0x56, 0x4c, 0x5e, 0x9d,
-  0xbf, 0x7b, 0x2b, 0x4a, 0x61, 0xf0, 0x21, 0x89, 0x29, 0x6e, 0x52, 0xb6, 0x60, 0x01, 0x96, 0xcd,
-  0x9e, 0x95, 0x6c, 0xa5, 0xf8, 0x4d, 0xdc, 0x3c, 0x72, 0xbe, 0xf0, 0x49, 0x44, 0xc2, 0xa3, 0x89,
-  0x77, 0x46, 0xe2, 0x49, 0xa0, 0xa8, 0x0b, 0x2b, 0x9a, 0x79, 0x7d, 0xe9, 0xde, 0xf6, 0xcd, 0x5d,
-  0x12, 0x4b, 0xc0, 0xd4, 0xa9, 0xe5, 0xc4, 0x0a, 0xfd, 0x64, 0xb8, 0x8a, 0x5c, 0x19, 0x3b, 0x51,
-  0xbf, 0x42, 0xab, 0xd3, 0xbf, 0x47, 0xa0, 0xee, 0x55, 0x95, 0x7e, 0x2b, 0x6a, 0x87, 0xe8, 0x11,
-  0x98, 0x14, 0x45, 0x19, 0x4c, 0xbc, 0x3e, 0xb2, 0x57, 0x81, 0xa6, 0xaa, 0xf3, 0x10, 0x6a, 0x0c,
-  0x3d, 0xa0, 0x3a, 0x1e, 0xe9, 0x56, 0x2f, 0x52, 0x88, 0xee, 0xab, 0xe5, 0xe4, 0x2d, 0x86, 0xb7,
-  0x85, 0xaa, 0x76, 0x06, 0x7e, 0xa8, 0x60, 0x9d, 0xb1, 0xe4, 0x0f, 0x24, 0xa2, 0xe6, 0xda, 0x66,
-  0xd9, 0x36, 0xe3, 0xa7, 0x12, 0xab, 0x1d, 0x8a, 0x64, 0xce, 0xb9, 0xd8, 0xb4, 0xe7, 0x8b, 0x45,
-  0x27, 0xd6, 0xf9, 0x9b, 0xde, 0xf3, 0xad, 0xd0, 0x36, 0x65, 0x12, 0x05, 0xf5, 0x9a, 0xac, 0xa5,
-  0x70, 0x2f, 0xfc, 0x30, 0x38, 0x71, 0xbc, 0xc8, 0x6c, 0x18, 0x19, 0x68, 0xe0, 0x78, 0xe7, 0xb3,
-  0x00, 0x7a, 0xec, 0xdb, 0x65, 0x52, 0x3f, 0x31, 0x8d, 0x0e, 0xd9, 0x59, 0xcd, 0xd9, 0x21, 0xa5,
-  0x92, 0xba, 0x9a, 0xf5, 0x1b, 0xb9, 0x34, 0x69, 0x5b, 0x42, 0x7f, 0xe2, 0xd9, 0x4a, 0xfd, 0x39,
-  0x7b, 0x01, 0x4b, 0xe9, 0x8f, 0x15, 0x68, 0x16, 0x6d, 0x47, 0x48, 0xfa, 0x04, 0x78, 0x7b, 0x00,
-  0xf6, 0x10, 0x5a, 0x20, 0x84, 0x10, 0x7c, 0x80, 0x63, 0x30, 0xb2, 0xe1, 0x8d, 0xe5, 0x66, 0x58,
-  0xa6, 0xce, 0xfb, 0xc9, 0x18, 0x49, 0x18, 0x30, 0x24, 0x1e, 0x09, 0xa1, 0x2b, 0x69, 0x09, 0xc0,
-  0x2e, 0xad, 0x4a, 0xea, 0x8f, 0x96, 0xc3, 0x5a, 0xf3, 0xcd, 0xd0, 0xaa, 0x5a, 0x4d, 0xab, 0x6b,
-  0x8d, 0xcb, 0x8e, 0x33, 0x50, 0xc8, 0x37, 0x23, 0x47, 0x70, 0x9e, 0x5c, 0xcd, 0x30, 0x4d, 0xc4,
-  0x60, 0x99, 0x63, 0x73, 0x78, 0x6c, 0x2b, 0x32, 0xb6, 0x9e, 0x31, 0x56, 0x56, 0xb1, 0x08, 0xe8,
-  0xd2, 0xa4, 0xb3, 0x80, 0x59, 0xf1, 0x4e, 0x86, 0xe0, 0x15, 0xae, 0xc5, 0xc0, 0x35, 0xf2, 0x2d,
-  0x2e, 0x35, 0x73, 0xb5, 0xd6, 0x9a, 0xad, 0x65, 0x46, 0x15, 0xb4, 0x3a, 0x08, 0x09, 0xba, 0x29,
-  0x7b, 0x58, 0xb5, 0x12, 0x6b, 0x44, 0x5d, 0x2c, 0x88, 0x0b, 0x8a, 0x0a, 0x68, 0xa8, 0x0a, 0x3a,
-  0xe1, 0x99, 0x12, 0x79, 0xe4, 0xdc, 0x82, 0x94, 0x11, 0x91, 0x07, 0x84, 0x92, 0x37, 0xa1, 0xa0,
-  0xdc, 0x01, 0xf0, 0xed, 0xa3, 0x15, 0x26, 0x99, 0x64, 0x4d, 0x4e, 0xb2, 0xd1, 0x06, 0x02, 0x86,
-  0x4b, 0xd4, 0x39, 0xf9, 0x56, 0xbd, 0x34, 0x0d, 0x8d, 0x7c, 0xab, 0xb1, 0xaf, 0x3a, 0x7c, 0x25,
-  0x72, 0xe2, 0xc3, 0xb3, 0xbf, 0xc3, 0x50, 0x69, 0x73, 0xdf, 0x12, 0x3b, 0xea, 0xf8, 0xb4, 0xb9,
-  0x8d, 0x52, 0xfd, 0xb9, 0x7f, 0x69, 0xae, 0xb4, 0x52, 0xe3, 0x49, 0xa5, 0xea, 0x43, 0x89, 0xb5,
-  0x82, 0xc4, 0x0e, 0x1f, 0xbd, 0x0a, 0x32, 0x61, 0x81, 0x02, 0x60, 0x18, 0xea, 0x42, 0xa8, 0x1f,
-  0xe4, 0x02, 0x15, 0xb4, 0x69, 0xa4, 0xb2, 0xd1, 0xd6, 0x61, 0x9d, 0xaf, 0xc8, 0xa3, 0x38, 0x0e,
-  0xa2, 0xb6, 0x6c, 0x9a, 0xcb, 0x9a, 0x2f, 0x08, 0xfd, 0xd8, 0xef, 0xfb, 0xee, 0x0b, 0x79, 0x1a,
-  0x45, 0x72, 0x1b, 0x3e, 0x65, 0xd0, 0x9c, 0xed, 0x4a, 0x45, 0x2e, 0xad, 0x28, 0x49, 0x3f, 0x8a,
-  0xd1, 0x3b, 0x2c, 0xc9, 0x15, 0xc0, 0xc2, 0x9e, 0x8a, 0x7c, 0x68, 0xb4, 0xeb, 0x0f, 0x15, 0x99,
-  0x91, 0x20, 0x4d, 0x42, 0x57, 0x86, 0x0e, 0xd2, 0x38, 0x15, 0x54, 0x4d, 0x7d, 0x22, 0xbd, 0x33,
-  0xbf, 0x7f, 0x4d, 0x62, 0x25, 0x4d, 0xd0, 0x7b, 0x8e, 0x67, 0x85, 0x33, 0x1c, 0x3a, 0xe0, 0x6b,
-  0x86, 0xa1, 0x35, 0xeb, 0x4d, 0x06, 0x03, 0x12, 0xca, 0x09, 0x02, 0x18, 0x0f, 0x12, 0xa1, 0xe1,
-  0x31, 0x89, 0xd9, 0xc5, 0x86, 0x11, 0x1d, 0xfd, 0x48, 0x09, 0x84, 0x29, 0xb6, 0xbc, 0x3e, 0x01,
-  0xed, 0xb0, 0x8b, 0xf9, 0xf6, 0x68, 0x3e, 0xd1, 0xcb, 0x58, 0xdf, 0x85, 0xe3, 0xc5, 0x5b, 0x34,
-  0x8d, 0xe7, 0xa1, 0x9d, 0x09, 0x12, 0x1d, 0x27, 0x12, 0x4d, 0x0a, 0x24, 0x9a, 0xac, 0xaf, 0xe7,
-  0x94, 0x4d, 0x4e, 0xea, 0x50, 0x81, 0x31, 0xa1, 0x13, 0x1d, 0xc0, 0xdf, 0x45, 0xbd, 0xd4, 0x52,
-  0x85, 0xb3, 0x79, 0x6c, 0xbe, 0x3e, 0xfb, 0xf0, 0x5e, 0x0f, 0xd0, 0xb5, 0x17, 0xd5, 0x2f, 0x80,
-  0x7f, 0xa0, 0x31, 0x7d, 0x75, 0xce, 0x10, 0x35, 0xc1, 0x39, 0x12, 0x86, 0x20, 0x45, 0x82, 0x77,
-  0xa8, 0x3c, 0x25, 0x0a, 0x92, 0x35, 0x5f, 0x13, 0x79, 0xe9, 0x40, 0xa3, 0xc2, 0x18, 0x03, 0xb3,
-  0xd6, 0xd7, 0xbf, 0x61, 0x2c, 0x00, 0x34, 0x82, 0xb0, 0x22, 0x29, 0xec, 0x09, 0x86, 0x1b, 0x3e,
-  0x5c, 0xa6, 0x26, 0x8c, 0xa1, 0xab, 0xa2, 0xb9, 0xcf, 0xaa, 0xa9, 0xc0, 0xa2, 0x62, 0x2d, 0x30,
-  0x19, 0xbe, 0xee, 0xd8, 0xc0, 0x23, 0xf8, 0x5c, 0x5f, 0x57, 0x20, 0x87, 0x01, 0x2c, 0x79, 0x91,
-  0xeb, 0x63, 0x8c, 0x61, 0x30, 0x33, 0xcb, 0x27, 0x59, 0x2e, 0x98, 0x15, 0x7b, 0x26, 0x09, 0xa5,
-  0x04, 0x84, 0xc4, 0xc2, 0x1e, 0x16, 0x28, 0x6c, 0xc6, 0x3e, 0xda, 0x2f, 0xba, 0x13, 0xb1, 0xfe,
-  0x89, 0xd5, 0x7c, 0x0d, 0x10, 0xb1, 0x48, 0x54, 0x1a, 0xc0, 0xfd, 0x00, 0xb2, 0x6f, 0x03, 0xd2,
-  0xcf, 0x95, 0x9b, 0x57, 0xa0, 0x8b, 0x45, 0x46, 0x5a, 0xc0, 0xc3, 0x88, 0x98, 0xac, 0xe4, 0x4a,
-  0x04, 0xbe, 0xd2, 0x14, 0x1a, 0xb3, 0xc0, 0x98, 0x08, 0x67, 0x54, 0x3e, 0x41, 0x57, 0x9e, 0x3b,
-  0x63, 0xe2, 0x4f, 0x62, 0x85, 0x71, 0x5f, 0xab, 0x36, 0x61, 0x24, 0xa5, 0x72, 0x0b, 0xdd, 0x94,
-  0x2d, 0xdd, 0x0f, 0x88, 0x57, 0x58, 0x38, 0x26, 0x60, 0x89, 0x59, 0x64, 0xda, 0x87, 0x85, 0xd8,
-  0xbc, 0x77, 0x71, 0xf0, 0x86, 0xe4, 0xf7, 0x09, 0x89, 0xe2, 0xd7, 0x68, 0x31, 0x09, 0x1d, 0xb9,
-  0x4f, 0xf7, 0x49, 0xa0, 0x67, 0x50, 0xf4, 0x20, 0xcf, 0xb3, 0x82, 0xe1, 0xce, 0x45, 0x30, 0x82,
-  0xd0, 0xcc, 0x1b, 0x3a, 0x03, 0x18, 0x05, 0xdc, 0xfc, 0x00, 0x71, 0x11, 0x01, 0xad, 0x1b, 0xd3,
-  0xea, 0x53, 0x4e, 0xb2, 0xea, 0x9d, 0xe8, 0x43, 0xef, 0x3b, 0xf0, 0x1b, 0x5e, 0xd5, 0x9c, 0x11,
-  0x66, 0x60, 0xfd, 0x9a, 0xcc, 0x22, 0x45, 0x48, 0x94, 0x0f, 0x6a, 0x37, 0xbe, 0xd4, 0x3c, 0x90,
-  0x97, 0x28, 0x70, 0xc1, 0x35, 0x90, 0x75, 0x19, 0xb8, 0x6a, 0xe6, 0x7a, 0x5f, 0xe8, 0x57, 0x0f,
-  0xc6, 0x9d, 0xe6, 0x81, 0x12, 0xa5, 0x03, 0x31, 0x52, 0xe7, 0x37, 0x56, 0x88, 0xed, 0x3e, 0xf7,
-  0xf7, 0xd1, 0x19, 0x04, 0x48, 0xae, 0x63, 0x7d, 0x26, 0x2a, 0x32, 0xb7, 0x21, 0xa0, 0xb3, 0x62,
-  0x90, 0x48, 0x5a, 0xb2, 0xf0, 0x11, 0x7d, 0xd4, 0x7e, 0x9c, 0x5f, 0xa9, 0x62, 0xa7, 0xa3, 0x3f,
-  0xf5, 0x2c, 0xa9, 0x82, 0x8a, 0xa5, 0x8b, 0xe3, 0xf7, 0xe7, 0x5b, 0x7f, 0x7f, 0xb7, 0xfb, 0x19,
-  0xb4, 0x69, 0x53, 0xc3, 0xb7, 0x6a, 0x8b, 0xbe, 0xb6, 0x9a, 0xcd, 0x7a, 0xb3, 0x23, 0x0c, 0xa5,
-  0x84, 0x1a, 0x81, 0x24, 0x5e, 0x4a, 0xe2, 0x54, 0x82, 0x03, 0x76, 0xe8, 0x12, 0x7c, 0xdc, 0x9b,
-  0x51, 0x8c, 0x45, 0x92, 0xa3, 0x7f, 0x58, 0x94, 0x81, 0x39, 0x5b, 0x3c, 0x4f, 0x0e, 0xdf, 0x89,
-  0xde, 0xfa, 0x53, 0x88, 0x0a, 0x2d, 0x54, 0x0d, 0x49, 0x46, 0xa2, 0xc7, 0x7e, 0x0a, 0x57, 0xc1,
-  0xa0, 0x65, 0x72, 0x40, 0xd0, 0xbe, 0x6f, 0x05, 0xbc, 0x87, 0x64, 0xd6, 0xa5, 0xf2, 0x33, 0x13,
-  0xc7, 0x36, 0x75, 0x8f, 0x58, 0x19, 0xb2, 0xcc, 0x3b, 0x1e, 0x1e, 0xf2, 0x76, 0x09, 0x44, 0x8f,
-  0x78, 0xc3, 0x78, 0x44, 0x0d, 0x12, 0xa8, 0x40, 0xff, 0x45, 0x5c, 0x32, 0xc1, 0xdb, 0x1c, 0x59,
-  0xe1, 0x6e, 0x0c, 0x9c, 0x86, 0xba, 0x2f, 0x82, 0x40, 0xd4, 0xdd, 0x7e, 0x96, 0x23, 0x31, 0x45,
-  0x53, 0xd7, 0xd7, 0x8b, 0x53, 0xca, 0x55, 0x55, 0xc5, 0x22, 0x65, 0x49, 0x2e, 0x65, 0xf0, 0xdb,
-  0x72, 0x19, 0xba, 0x2d, 0x03, 0xf8, 0xf1, 0x43, 0xfe, 0x7b, 0x1e, 0xc2, 0x73, 0xb5, 0xf3, 0xf4,
-  0x74, 0x38, 0x53, 0xe2, 0x2c, 0xd7, 0x12, 0xb9, 0xe4, 0x2c, 0x7b, 0x96, 0x57, 0x22, 0x04, 0xa8,
-  0x53, 0x70, 0xc0, 0x3e, 0x83, 0x0a, 0xe0, 0x51, 0x16, 0x59, 0x51, 0x72, 0x38, 0xa3, 0xa0, 0x7e,
-  0x9f, 0x96, 0x92, 0x81, 0xa9, 0x99, 0xae, 0xa1, 0x3e, 0xed, 0xae, 0x67, 0x1f, 0xde, 0x92, 0xfe,
-  0x24, 0x26, 0xa8, 0xef, 0x41, 0x07, 0x7b, 0x1a, 0xd3, 0x04, 0xe0, 0xe8, 0x50, 0x9f, 0x97, 0x94,
-  0x62, 0x6d, 0x3e, 0x26, 0xf1, 0xc8, 0xb7, 0xdb, 0x32, 0x08, 0x86, 0xbc, 0x50, 0xd1, 0x4d, 0x87,
-  0x01, 0x6c, 0x76, 0xc1, 0x9b, 0xbd, 0x7e, 0x01, 0x7d, 0x49, 0x6e, 0x63, 0x60, 0xa4, 0x12, 0xad,
-  0xaf, 0x47, 0xe8, 0x58, 0x80, 0x9e, 0x94, 0x4b, 0x71, 0x49, 0xa6, 0x0a, 0x6d, 0x80, 0x4e, 0x0f,
-  0x8c, 0x13, 0x19, 0x7d, 0x65, 0x91, 0x71, 0xee, 0x29, 0x3e, 0x6a, 0x04, 0x55, 0x67, 0x66, 0x22,
-  0xe3, 0x35, 0xab, 0x73, 0x5a, 0x8c, 0xaf, 0xc9, 0x87, 0xa8, 0x38, 0x40, 0xd3, 0xc6, 0x31, 0x08,
-  0x00, 0x96, 0xa8, 0x6a, 0x59, 0xdd, 0x82, 0xd9, 0x55, 0x1c, 0x6f, 0x96, 0xeb, 0xce, 0x14, 0x10,
-  0xa2, 0xee, 0x7c, 0xa1, 0x2e, 0xd6, 0x76, 0x2a, 0x3c, 0x3e, 0x4c, 0x02, 0xc5, 0xb5, 0xbf, 0x5c,
-  0xa4, 0x48, 0xa3, 0x9f, 0x79, 0x36, 0x82, 0x99, 0x53, 0xdb, 0xdd, 0xf3, 0xed, 0x99, 0xac, 0x82,
-  0x7e, 0x04, 0x75, 0x8b, 0xf0, 0x92, 0xb9, 0xb1, 0x13, 0x74, 0x77, 0x5c, 0xab, 0x47, 0xdc, 0x2e,
-  0xcd, 0xb4, 0x53, 0x61, 0x2f, 0xd2, 0xbf, 0x7a, 0x40, 0x29, 0xb0, 0x80, 0xb8, 0x20, 0x00, 0x7c,
-  0xde, 0x8b, 0x46, 0x57, 0x65, 0x06, 0x92, 0x25, 0xb0, 0x7c, 0x4b, 0x10, 0x30, 0x28, 0x23, 0xcb,
-  0x03, 0xef, 0x43, 0xce, 0x38, 0x8e, 0x2c, 0x24, 0x8b, 0x44, 0x48, 0x46, 0x55, 0x12, 0x78, 0xdb,
-  0x13, 0xa2, 0xca, 0x5d, 0x56, 0x09, 0x54, 0xe3, 0x07, 0x54, 0xa2, 0x28, 0xdc, 0x84, 0x21, 0x6b,
-  0x85, 0x38, 0xe1, 0x25, 0x77, 0xcf, 0xe0, 0x69, 0x0f, 0x9e, 0x76, 0x2a, 0x0c, 0xe3, 0xa1, 0x1c,
-  0xae, 0x33, 0x1c, 0xc5, 0x2c, 0xcb, 0x5b, 0x7c, 0x7c, 0x2c, 0xcf, 0xd4, 0x05, 0x2b, 0xd9, 0xfd,
-  0xf4, 0xf6, 0xf0, 0xe0, 0x31, 0xcc, 0x21, 0x8c, 0x18, 0x02, 0x26, 0xab, 0xfb, 0x92, 0x3d, 0x3c,
-  0x86, 0x0f, 0x16, 0x59, 0xee, 0x1e, 0x90, 0x9b, 0xc7, 0xf0, 0x38, 0xc5, 0x4f, 0xa2, 0xd6, 0xb6,
-  0xc2, 0x6b, 0x2c, 0x14, 0x1c, 0x5b, 0x6c, 0xe1, 0x63, 0xe8, 0x3d, 0xf8, 0x94, 0xbb, 0x7b, 0xf0,
-  0xf9, 0x18, 0x26, 0x04, 0x63, 0x50, 0x30, 0x78, 0x75, 0xd7, 0x8f, 0x32, 0x39, 0xb0, 0xfa, 0xd8,
-  0x27, 0xf8, 0xf5, 0x18, 0xae, 0x37, 0xb3, 0x80, 0x5f, 0xef, 0xe1, 0x73, 0x09, 0x13, 0x86, 0x17,
-  0x95, 0x96, 0xee, 0x4e, 0x25, 0xe8, 0x6e, 0x2c, 0x12, 0xb9, 0x20, 0x6a, 0xde, 0xf0, 0x8b, 0x04,
-  0xea, 0x79, 0xa0, 0x79, 0x77, 0xcf, 0x62, 0x3f, 0x84, 0x91, 0x42, 0x43, 0xb6, 0x98, 0x8c, 0x15,
-  0x26, 0x7c, 0x34, 0x3d, 0xb1, 0x23, 0xe2, 0x81, 0x5b, 0x12, 0x9d, 0x0e, 0x07, 0x9c, 0xd9, 0x00,
-  0x03, 0x91, 0xce, 0x0a, 0x70, 0xff, 0x2e, 0x57, 0xea, 0x30, 0x5f, 0x2a, 0x75, 0x6d, 0x65, 0xd4,
-  0x63, 0x60, 0x39, 0x50, 0x41, 0xd2, 0xf1, 0x93, 0x13, 0x77, 0x95, 0x89, 0xb1, 0x89, 0x8e, 0x49,
-  0x4e, 0x6b, 0xc4, 0x33, 0x97, 0x74, 0xd7, 0xda, 0xa1, 0xef, 0xc7, 0x1a, 0xfd, 0xd4, 0x85, 0x40,
-  0xcf, 0xcb, 0xe5, 0xde, 0xb0, 0x0c, 0x81, 0x83, 0x1f, 0xb6, 0x7f, 0xa9, 0xd6, 0xf0, 0x6f, 0xa7,
-  0x5c, 0x46, 0xf5, 0x27, 0x80, 0xfd, 0x81, 0x6d, 0x6c, 0xb7, 0x10, 0x38, 0x4a, 0x40, 0xb5, 0x4d,
-  0xd2, 0x42, 0xd0, 0x2a, 0xa4, 0xe7, 0x87, 0x36, 0x09, 0x13, 0xb0, 0x6d, 0xd9, 0x2d, 0x0b, 0xc0,
-  0x8c, 0xc0, 0xa4, 0x1e, 0x6b, 0xcb, 0x1a, 0x0c, 0x00, 0x4c, 0x47, 0xb6, 0x80, 0x6e, 0xd5, 0xfb,
-  0x4d, 0xd2, 0x03, 0x28, 0xd5, 0x3b, 0x5e, 0x82, 0xdd, 0xdc, 0xde, 0xb2, 0x1a, 0x75, 0x80, 0x0f,
-  0x60, 0x08, 0x97, 0x23, 0xe7, 0x8e, 0xb4, 0xab, 0x46, 0x70, 0xbb, 0x48, 0x1b, 0x42, 0xa5, 0x36,
-  0xdb, 0x12, 0xd7, 0xf1, 0x88, 0x15, 0x96, 0x61, 0x94, 0xd8, 0x0e, 0x9a, 0xef, 0xd8, 0x97, 0x7a,
-  0x7e, 0x1c, 0xfb, 0x63, 0x4d, 0xfa, 0x65, 0x30, 0xe8, 0x91, 0x7a, 0x5d, 0x32, 0xfe, 0x05, 0x9e,
-  0x7b, 0x2d, 0x63, 0xd0, 0xaa, 0x49, 0x10, 0x7d, 0xfd, 0x8b, 0xba, 0xd4, 0x6c, 0xa3, 0x8e, 0x7f,
-  0x73, 0xcd, 0x66, 0xd8, 0x5b, 0xd5, 0x6c, 0xc3, 0x19, 0x6c, 0xa5, 0xe1, 0x2d, 0xca, 0x8c, 0x7c,
-  0xab, 0x8f, 0xe8, 0x9f, 0x95, 0x56, 0xb7, 0x48, 0x6f, 0xeb, 0xde, 0xd6, 0xa1, 0x46, 0x78, 0xbc,
-  0x8b, 0x06, 0x94, 0x99, 0x09, 0xa1, 0xe1, 0xb0, 0xa7, 0xa0, 0x93, 0x24, 0x55, 0x5b, 0x86, 0x26,
-  0x19, 0x6a, 0x86, 0xde, 0x82, 0xa4, 0x1c, 0xe1, 0x05, 0xe9, 0xb9, 0x46, 0x14, 0xa4, 0x17, 0xd2,
-  0xcd, 0xf5, 0xd3, 0x53, 0xfb, 0x64, 0x7b, 0x73, 0xbb, 0xb6, 0xdd, 0x60, 0x7d, 0xd2, 0xd8, 0x6c,
-  0x34, 0x1b, 0xc5, 0x7d, 0x32, 0xe8, 0x0d, 0x1a, 0x83, 0x46, 0xae, 0x4f, 0x6a, 0xd5, 0xc6, 0x56,
-  0xad, 0x97, 0xed, 0x91, 0x04, 0x92, 0xef, 0x91, 0x04, 0x9c, 0xef, 0x94, 0x04, 0x9c, 0x6f, 0x46,
-  0x16, 0x50, 0x8e, 0xda, 0x5b, 0x49, 0xc3, 0x40, 0x91, 0xfe, 0xe5, 0x87, 0xcc, 0xca, 0x70, 0x11,
-  0x02, 0x94, 0x69, 0x42, 0xb5, 0x56, 0xcf, 0x12, 0x6b, 0xd0, 0x3f, 0xb9, 0x16, 0xb5, 0xec, 0xd6,
-  0x56, 0xcb, 0xa2, 0xa3, 0x21, 0x4f, 0xaa, 0x48, 0x10, 0x1c, 0x03, 0x33, 0xf1, 0x38, 0xcb, 0x5a,
-  0xdb, 0x2d, 0x7b, 0xd3, 0xe6, 0x59, 0xd0, 0x54, 0xe4, 0xb2, 0x18, 0xcd, 0xfa, 0x76, 0x6b, 0x6f,
-  0x29, 0xcb, 0xe1, 0xe6, 0x51, 0xf5, 0xe8, 0xf0, 0xe9, 0x23, 0x34, 0x4f, 0xa5, 0x40, 0xe5, 0x55,
-  0xa2, 0xcd, 0x59, 0x62, 0x49, 0xdf, 0xb2, 0x1b, 0x4b, 0x55, 0x92, 0xcd, 0x66, 0x63, 0xcb, 0x58,
-  0x29, 0x8b, 0x81, 0x85, 0x42, 0x42, 0x63, 0x94, 0xa7, 0x9e, 0x71, 0x2e, 0x2b, 0xc8, 0xb5, 0x9e,
-  0x5d, 0xa5, 0x7d, 0x3f, 0x2c, 0x4f, 0x42, 0xb7, 0x0d, 0xff, 0x95, 0x0d, 0xba, 0xbe, 0x86, 0x2b,
-  0x84, 0x0e, 0x8b, 0x1c, 0x2b, 0x3e, 0x44, 0xcd, 0xd0, 0x7b, 0x31, 0x38, 0x4d, 0x63, 0xb1, 0xdc,
-  0xb6, 0x91, 0x0c, 0xb9, 0x81, 0x35, 0x76, 0xdc, 0x59, 0x7b, 0xe3, 0x24, 0x24, 0xe0, 0x5f, 0xa1,
-  0x05, 0x8e, 0xa5, 0xda, 0xc9, 0x86, 0xd6, 0x9f, 0x80, 0xc7, 0x77, 0x43, 0x38, 0x35, 0x68, 0xf5,
-  0xf2, 0xc4, 0x54, 0xeb, 0xf5, 0xd6, 0x66, 0xa1, 0x02, 0xf9, 0x13, 0x88, 0xd9, 0xf7, 0xc7, 0x4e,
-  0x5f, 0x7a, 0x4f, 0x26, 0x24, 0x25, 0x04, 0x2d, 0x11, 0x35, 0x40, 0xb9, 0x75, 0x0e, 0x3a, 0xcb,
-  0x4f, 0xed, 0xb4, 0xf0, 0xa8, 0xa8, 0x4f, 0x8a, 0xf3, 0x6f, 0xcc, 0x7c, 0xe3, 0xac, 0xb7, 0x67,
-  0xdd, 0xe8, 0xdf, 0x23, 0x9a, 0x00, 0x04, 0xf1, 0x84, 0x9a, 0x51, 0x6b, 0x18, 0x5b, 0xd5, 0x6d,
-  0x0a, 0x0e, 0x49, 0xe0, 0x33, 0x30, 0x9b, 0x1a, 0xab, 0x54, 0x86, 0x4e, 0x3c, 0x9a, 0xf4, 0xd0,
-  0xf5, 0xac, 0x90, 0xa9, 0x3f, 0x75, 0x2a, 0xa2, 0x7c, 0x4d, 0x8a, 0x26, 0xbd, 0xb1, 0x13, 0x4b,
-  0xcc, 0x25, 0x8c, 0x24, 0xd0, 0x40, 0xe8, 0xfb, 0x49, 0xb4, 0x4e, 0x2b, 0x92, 0x4e, 0x4e, 0x29,
-  0x2c, 0x9f, 0x8b, 0xd6, 0xb2, 0x4b, 0x97, 0x51, 0xa3, 0xa7, 0xd4, 0x52, 0xc1, 0xa1, 0xe8, 0xc4,
-  0x51, 0x05, 0xe9, 0xa7, 0x99, 0xf7, 0xfd, 0x60, 0x16, 0xe2, 0x90, 0x93, 0xfe, 0xef, 0xff, 0xa2,
-  0xc4, 0x4b, 0x2f, 0x69, 0xe6, 0xa4, 0xe1, 0xe0, 0x41, 0x63, 0x16, 0x89, 0xd7, 0xf2, 0x57, 0x72,
-  0xee, 0xd7, 0x2a, 0xcf, 0x9f, 0xaf, 0x49, 0xcf, 0xd1, 0xbd, 0xa7, 0x1d, 0x26, 0x65, 0x44, 0x46,
-  0xa2, 0xae, 0x0e, 0xa6, 0x9e, 0x84, 0xce, 0x0d, 0x76, 0x5f, 0x40, 0x63, 0xae, 0x48, 0xb2, 0x42,
-  0x78, 0x0e, 0xc9, 0xc0, 0xb9, 0x25, 0xb6, 0x34, 0x05, 0x66, 0x48, 0x96, 0xb4, 0xf1, 0xcb, 0x86,
-  0x14, 0x61, 0x87, 0x90, 0x19, 0x80, 0x5c, 0x17, 0xe9, 0x18, 0x43, 0xe0, 0x3c, 0x06, 0xe5, 0x65,
-  0xe3, 0xea, 0x0f, 0xa4, 0x48, 0x3d, 0x08, 0xbc, 0xc0, 0x83, 0x87, 0x32, 0x2b, 0x3c, 0xae, 0xe0,
-  0x8b, 0x27, 0xd2, 0x7c, 0x6d, 0x4d, 0x92, 0xb2, 0xe1, 0x05, 0x40, 0x50, 0x2a, 0xd0, 0xaf, 0xc2,
-  0x18, 0x43, 0x32, 0xa5, 0x4c, 0xbc, 0xd1, 0x59, 0xa3, 0x89, 0xf8, 0xc2, 0x1c, 0xb2, 0xb7, 0x0e,
-  0xb4, 0xbc, 0x64, 0x4a, 0xb2, 0x5d, 0x1e, 0xb8, 0xe4, 0x56, 0xc2, 0x0f, 0x1c, 0x1c, 0x93, 0xb1,
-  0x27, 0x67, 0x91, 0x93, 0x38, 0x05, 0x91, 0xaf, 0x76, 0x9e, 0x95, 0xcb, 0xd2, 0x2e, 0x10, 0x14,
-  0xd3, 0x36, 0x59, 0x52, 0x84, 0xcb, 0xe9, 0x56, 0x4c, 0x69, 0x8d, 0xfd, 0x40, 0xb2, 0x7a, 0xfe,
-  0x0d, 0xa1, 0x6f, 0x94, 0x39, 0x20, 0xce, 0xce, 0x90, 0xcd, 0x0a, 0x41, 0x36, 0xd7, 0x9f, 0xd2,
-  0xa4, 0x11, 0xa1, 0xc2, 0x81, 0x92, 0x77, 0x1b, 0xe0, 0xfc, 0xd6, 0x0d, 0x14, 0x08, 0x3c, 0x84,
-  0x18, 0x10, 0x81, 0x03, 0x90, 0x0c, 0xcb, 0x9b, 0x89, 0x25, 0x7c, 0x69, 0x8d, 0x89, 0xbb, 0x04,
-  0xbd, 0x1a, 0x8d, 0x42, 0x5c, 0xaa, 0x77, 0x70, 0x22, 0x90, 0x00, 0x4f, 0x41, 0x96, 0x21, 0x3e,
-  0x1d, 0x61, 0x6c, 0x09, 0x19, 0xa3, 0x11, 0x54, 0x00, 0xb5, 0x62, 0x1d, 0x56, 0x86, 0xc8, 0x72,
-  0xb9, 0x0b, 0x65, 0xec, 0xd8, 0xce, 0x0d, 0x0d, 0x98, 0x58, 0x92, 0xcc, 0x7a, 0x0b, 0xe2, 0x27,
-  0xaa, 0x16, 0x08, 0xae, 0x40, 0x48, 0xa0, 0x10, 0xd8, 0x54, 0x57, 0x97, 0x56, 0x4a, 0x9b, 0x7b,
-  0xe2, 0x82, 0x7a, 0x4b, 0xcb, 0x94, 0x10, 0x1f, 0x6b, 0xb1, 0xa4, 0xc0, 0xb2, 0x6d, 0xe8, 0x2a,
-  0x2c, 0x97, 0x76, 0x24, 0xf0, 0x61, 0x0a, 0xc1, 0xb1, 0xe4, 0xc4, 0x1b, 0x94, 0x2e, 0xec, 0xf2,
-  0x08, 0x5b, 0x90, 0x66, 0xa6, 0xf4, 0x88, 0xde, 0x1e, 0x39, 0x90, 0xdf, 0x63, 0xd4, 0x71, 0xfa,
-  0x38, 0x4d, 0x81, 0x55, 0xae, 0x4b, 0x19, 0xc2, 0xe4, 0x6e, 0xe4, 0x8f, 0xb3, 0x04, 0xec, 0x54,
-  0x00, 0x9b, 0xb6, 0x4a, 0x3c, 0xac, 0x71, 0x72, 0xdf, 0xe5, 0xf9, 0x2e, 0xf5, 0xac, 0x50, 0x02,
-  0xd1, 0x06, 0x72, 0x99, 0xf4, 0x71, 0xe6, 0x23, 0xdb, 0x81, 0x68, 0x60, 0x35, 0xf0, 0xd0, 0x72,
-  0xa7, 0xd6, 0x2c, 0x92, 0x6e, 0x9c, 0xc8, 0xe9, 0x81, 0x66, 0x58, 0xe2, 0x17, 0xf6, 0x64, 0x19,
-  0x4a, 0x4c, 0x38, 0xc6, 0x45, 0xc6, 0x02, 0xb3, 0xea, 0x51, 0x05, 0x09, 0xe1, 0x3f, 0x13, 0x20,
-  0xd6, 0x3f, 0x65, 0x43, 0xee, 0x72, 0xba, 0x72, 0x54, 0xd1, 0xc6, 0x63, 0xaf, 0xc2, 0x4b, 0x44,
-  0x99, 0x12, 0xc0, 0xc8, 0x4c, 0xfa, 0x19, 0x49, 0x02, 0xcd, 0xe4, 0x02, 0x21, 0x64, 0x49, 0x1c,
-  0x28, 0x03, 0x6f, 0x2c, 0xc7, 0xc5, 0x7d, 0x23, 0x52, 0x2f, 0xf4, 0xa3, 0x29, 0xf4, 0x16, 0x35,
-  0x3c, 0xba, 0xf4, 0x01, 0xc4, 0x67, 0x80, 0xb2, 0x05, 0x2d, 0x81, 0xc0, 0x24, 0x91, 0x17, 0xc8,
-  0xcb, 0x38, 0x8c, 0x0d, 0xb5, 0x12, 0x21, 0x93, 0x40, 0x27, 0x43, 0x58, 0x8c, 0x7c, 0xf1, 0xc8,
-  0x0d, 0x16, 0x03, 0x62, 0x13, 0x69, 0xd0, 0x1c, 0x28, 0x83, 0x4a, 0x12, 0x54, 0x36, 0x00, 0x53,
-  0x02, 0x49, 0xe8, 0xb2, 0x11, 0xce, 0x38, 0x2e, 0xe5, 0xcc, 0x85, 0x2b, 0xe2, 0x51, 0xc2, 0x1f,
-  0xca, 0x8a, 0x61, 0xe8, 0x4f, 0xcb, 0x55, 0xc9, 0xe7, 0xc4, 0x95, 0x19, 0x29, 0x59, 0xc1, 0xa2,
-  0x3c, 0x49, 0x1a, 0x8f, 0xbc, 0x61, 0xfd, 0x14, 0x11, 0x00, 0x82, 0x13, 0x31, 0x83, 0xd1, 0x65,
-  0x93, 0x6c, 0x5f, 0x22, 0x87, 0x2c, 0xce, 0xc7, 0x01, 0x0c, 0x07, 0xca, 0x96, 0x7e, 0x0c, 0x36,
-  0x87, 0x71, 0x32, 0x27, 0x4a, 0x49, 0xd7, 0xf1, 0x2a, 0x96, 0xbb, 0x6f, 0x54, 0x06, 0x8f, 0x93,
-  0xd3, 0x93, 0xc9, 0xc2, 0x6a, 0xcf, 0xf5, 0x77, 0xae, 0x6b, 0xd3, 0x16, 0xcd, 0xca, 0xd6, 0x24,
-  0xf6, 0xd3, 0x12, 0x84, 0x24, 0xe6, 0x8a, 0x43, 0xba, 0x0a, 0x19, 0x93, 0x2d, 0xb4, 0xba, 0x52,
-  0xa8, 0x44, 0x0d, 0xa8, 0x29, 0x4f, 0xc1, 0x55, 0x2c, 0xf7, 0xa0, 0xbd, 0xd7, 0x6d, 0x89, 0x7e,
-  0x95, 0x11, 0x22, 0x77, 0xd7, 0x56, 0x2b, 0x4d, 0x25, 0x8e, 0xf3, 0xf7, 0x1c, 0x4d, 0x1d, 0x4a,
-  0xb7, 0x07, 0x7a, 0xc6, 0x1a, 0x07, 0x20, 0x39, 0xfe, 0x80, 0x0e, 0xdb, 0x21, 0x61, 0xa3, 0x55,
-  0xd4, 0x4a, 0xad, 0x20, 0x13, 0x8b, 0x8c, 0x2e, 0xd2, 0x50, 0xcf, 0xcc, 0xfc, 0x09, 0x88, 0x09,
-  0x74, 0x3f, 0xcd, 0x90, 0x30, 0x18, 0xca, 0x7f, 0x02, 0xa7, 0x29, 0x8b, 0xef, 0x67, 0xd8, 0xa8,
-  0x2a, 0x9a, 0xc9, 0x06, 0x65, 0xbb, 0x49, 0xc6, 0x72, 0xf7, 0x15, 0x81, 0x78, 0x01, 0xc4, 0xf0,
-  0x83, 0x07, 0x11, 0xfe, 0xa8, 0xfa, 0x44, 0xec, 0xf3, 0xa9, 0xff, 0x33, 0xd8, 0xa3, 0x90, 0xfc,
-  0x4c, 0xe9, 0x47, 0xfe, 0x24, 0xfc, 0x19, 0x74, 0x90, 0xc8, 0x14, 0x3d, 0xd3, 0x47, 0xc8, 0xbf,
-  0x9f, 0xe9, 0x20, 0xa6, 0x0e, 0x50, 0xcc, 0x81, 0xad, 0x4e, 0xc8, 0x75, 0xc5, 0x6d, 0xa2, 0x47,
-  0xc1, 0xba, 0x4e, 0x62, 0xde, 0x73, 0x50, 0xf1, 0x9f, 0xde, 0x63, 0x7c, 0xd0, 0x8a, 0xb6, 0xf6,
-  0xac, 0xfe, 0xf5, 0x90, 0xae, 0x00, 0x73, 0x3f, 0x52, 0x1a, 0x86, 0x64, 0x26, 0xa7, 0x6d, 0xe3,
-  0xdc, 0xa1, 0x66, 0x03, 0x08, 0xb3, 0xa8, 0x94, 0x4b, 0x84, 0xcd, 0x84, 0xa0, 0xd1, 0xa0, 0x56,
-  0x8b, 0x3a, 0x00, 0x4c, 0xb1, 0x03, 0x99, 0xfd, 0x91, 0xe3, 0xda, 0x21, 0x68, 0x29, 0x61, 0xc1,
-  0x28, 0xdd, 0x4c, 0x31, 0xc7, 0xd6, 0x35, 0xf2, 0x73, 0x12, 0x30, 0xa5, 0x34, 0x01, 0xf9, 0xa4,
-  0xbb, 0xe2, 0xa8, 0x26, 0xe0, 0x9a, 0x3c, 0x5f, 0x6f, 0x76, 0xfc, 0x15, 0x8c, 0x77, 0xae, 0xb4,
-  0xb9, 0xb9, 0xfb, 0x0e, 0xee, 0x8f, 0x33, 0x98, 0x25, 0x46, 0x46, 0x68, 0x4e, 0xec, 0xdf, 0xee,
-  0x39, 0x01, 0x0f, 0x61, 0x9f, 0xab, 0xa7, 0x23, 0xac, 0xfa, 0x13, 0xad, 0xba, 0x24, 0xbd, 0x22,
-  0x6c, 0xb6, 0x2c, 0x23, 0x0f, 0x49, 0x17, 0xaf, 0x76, 0xf6, 0x8a, 0x85, 0x3a, 0x62, 0xba, 0x35,
-  0xeb, 0x3a, 0x70, 0xa5, 0xca, 0x3d, 0xa3, 0x9c, 0xa1, 0x5a, 0x52, 0xb4, 0x4c, 0x31, 0xdf, 0xa3,
-  0x9a, 0xb2, 0xa6, 0x9c, 0x3e, 0xc7, 0xe1, 0xc4, 0xeb, 0x53, 0x47, 0x0c, 0x0c, 0xaa, 0xdc, 0x5d,
-  0xef, 0x83, 0x67, 0xda, 0x01, 0xaf, 0x1c, 0xbc, 0x0e, 0x5e, 0xc2, 0x06, 0x82, 0x36, 0xc0, 0x5c,
-  0x21, 0xac, 0x9b, 0xdb, 0x71, 0xf3, 0xff, 0xfe, 0xfd, 0xff, 0x48, 0x65, 0xea, 0xb3, 0x02, 0x44,
-  0x4b, 0x9d, 0x57, 0xe4, 0x7d, 0x32, 0xc3, 0x89, 0xbd, 0xc4, 0xdd, 0x49, 0x5b, 0x02, 0xc1, 0x80,
-  0x9a, 0x99, 0xdb, 0xc9, 0x9b, 0x7d, 0xc5, 0xe4, 0x1d, 0x1c, 0xd4, 0x8b, 0x80, 0x7a, 0xf4, 0xd8,
-  0xdc, 0x7e, 0xe2, 0x20, 0x83, 0x97, 0x00, 0x99, 0x85, 0xd3, 0xc2, 0x1a, 0x47, 0x33, 0x24, 0xd3,
-  0x69, 0xbf, 0x4f, 0x48, 0x38, 0x3b, 0xa3, 0xd1, 0x97, 0x1f, 0x2a, 0x1b, 0xbf, 0x70, 0xcb, 0xa4,
-  0x53, 0xba, 0xf9, 0x3c, 0xf2, 0x39, 0x0e, 0x09, 0x53, 0xc2, 0x65, 0xa4, 0x03, 0xa8, 0x43, 0x51,
-  0x71, 0x2a, 0x0d, 0xbb, 0xec, 0x0b, 0xb1, 0x42, 0x45, 0x85, 0x02, 0x17, 0x40, 0x01, 0x78, 0x2b,
-  0x7b, 0xe0, 0xd2, 0xad, 0x21, 0x45, 0xd4, 0x8b, 0x95, 0xc0, 0x53, 0x3d, 0x23, 0x71, 0xd6, 0x8c,
-  0x30, 0x8f, 0x97, 0x25, 0xfd, 0x2d, 0xb0, 0x42, 0x6b, 0x2c, 0xcd, 0xd9, 0x02, 0xc4, 0x42, 0x2c,
-  0x9f, 0x82, 0x03, 0x98, 0x45, 0xab, 0xc0, 0x27, 0x5a, 0x5d, 0x56, 0x00, 0xe3, 0x1d, 0x5d, 0x1c,
-  0x1c, 0x27, 0x8f, 0xc2, 0x35, 0x85, 0xc1, 0xa9, 0x3c, 0xcb, 0x82, 0xd9, 0xb2, 0x08, 0xe3, 0x10,
-  0x9d, 0x94, 0xfe, 0x65, 0xb9, 0x14, 0x68, 0x55, 0x9a, 0x81, 0x21, 0x16, 0x4e, 0x44, 0x6e, 0x64,
-  0x33, 0x1e, 0xdb, 0x1b, 0x5a, 0x26, 0x9b, 0xee, 0xd8, 0xc2, 0xff, 0xcd, 0x77, 0xc3, 0x92, 0x8b,
-  0xfa, 0x00, 0xdf, 0xc1, 0x77, 0x05, 0xd6, 0x0b, 0x47, 0x48, 0xd2, 0x01, 0x63, 0x52, 0x76, 0xa0,
-  0x62, 0xe8, 0x01, 0x30, 0xc4, 0x87, 0x56, 0x7f, 0xa4, 0x20, 0x0c, 0x69, 0x91, 0xcc, 0x2e, 0x6f,
-  0x2f, 0x6b, 0xb1, 0x80, 0xd3, 0x75, 0x71, 0xa0, 0x97, 0x2e, 0x70, 0x4b, 0xa6, 0x79, 0x4f, 0x8b,
-  0xd9, 0xfa, 0x77, 0x52, 0x02, 0x84, 0x85, 0x22, 0x7f, 0xe2, 0xb7, 0xe3, 0xf2, 0xb4, 0xb2, 0xc1,
-  0x22, 0x72, 0x62, 0x6f, 0xa8, 0x1c, 0x75, 0x21, 0xd1, 0x95, 0xea, 0x07, 0x73, 0x86, 0x64, 0x0c,
-  0xca, 0xad, 0x28, 0x33, 0xfd, 0x5e, 0xa8, 0x45, 0x7c, 0x4a, 0x1d, 0x92, 0x9f, 0x60, 0x56, 0xea,
-  0x47, 0xfc, 0x83, 0xec, 0x72, 0xec, 0x07, 0x98, 0x05, 0x5d, 0xfb, 0xdf, 0x8a, 0x55, 0x59, 0x87,
-  0x36, 0x91, 0x79, 0x46, 0x7b, 0x1a, 0xab, 0x1d, 0x4d, 0xbc, 0x2c, 0xd5, 0x18, 0xa6, 0x6d, 0x60,
-  0xc6, 0x8d, 0xcc, 0xb2, 0x10, 0x08, 0x3e, 0x47, 0xb8, 0x2a, 0xd0, 0xe5, 0x99, 0x68, 0x4d, 0x2a,
-  0x36, 0x59, 0x19, 0x5d, 0x9e, 0xc9, 0xbe, 0xe4, 0xa4, 0x27, 0x38, 0xcc, 0xa2, 0x8b, 0x80, 0x08,
-  0x27, 0x2a, 0xe4, 0xee, 0xaf, 0xf3, 0x7b, 0x79, 0xbe, 0xc8, 0xea, 0xfe, 0x25, 0xcf, 0x2f, 0x5f,
-  0xe1, 0x8a, 0xef, 0x73, 0x05, 0xf6, 0xa3, 0x80, 0x1f, 0x4a, 0x71, 0x5d, 0xaa, 0x54, 0x4a, 0x8a,
-  0xbd, 0xca, 0x3b, 0x98, 0xf4, 0xe5, 0x6a, 0x2d, 0xed, 0x90, 0x4a, 0xc5, 0xf6, 0x3d, 0x50, 0x64,
-  0x03, 0x54, 0x8f, 0x29, 0x1f, 0xc1, 0xa5, 0x06, 0x5b, 0x8a, 0x0e, 0x41, 0xc4, 0xa2, 0x09, 0xcf,
-  0xa6, 0x3d, 0xe5, 0xf9, 0x36, 0x89, 0x74, 0x29, 0xee, 0xd9, 0x6d, 0x29, 0x47, 0x8a, 0x04, 0x22,
-  0x43, 0x51, 0x6d, 0xb0, 0x48, 0x36, 0x38, 0x1d, 0xfd, 0xd8, 0x9d, 0x2d, 0xf5, 0x25, 0xc8, 0xe5,
-  0x01, 0x19, 0x58, 0x13, 0x37, 0xfe, 0x88, 0xeb, 0x0f, 0x51, 0xae, 0x47, 0xef, 0x45, 0xb9, 0xaf,
-  0x91, 0x49, 0x23, 0x50, 0x4b, 0x3f, 0xa6, 0x4b, 0x1f, 0xd7, 0xde, 0x6c, 0x9a, 0x07, 0xc3, 0x96,
-  0x10, 0x2c, 0x38, 0xf2, 0x84, 0x9b, 0x17, 0x9e, 0xec, 0x62, 0xe8, 0x3f, 0x1d, 0xe1, 0xe6, 0x12,
-  0xaa, 0x8a, 0xc6, 0xb8, 0x7c, 0x4b, 0xa2, 0xbc, 0xd2, 0x67, 0x4b, 0xf6, 0x42, 0xe9, 0xe3, 0x7e,
-  0x27, 0xa9, 0xcc, 0x26, 0x3d, 0x78, 0x1d, 0x00, 0x61, 0x39, 0x00, 0x71, 0x38, 0xa4, 0x9e, 0x4c,
-  0x6f, 0x46, 0xc7, 0x11, 0xae, 0x41, 0x82, 0x49, 0xbc, 0xbe, 0xd7, 0x3c, 0x60, 0x69, 0x4a, 0x5a,
-  0xb0, 0xe0, 0x1c, 0xe5, 0x4e, 0x81, 0x01, 0x28, 0xd8, 0x01, 0xc7, 0x76, 0x6f, 0x62, 0x5f, 0x66,
-  0x58, 0x83, 0x9a, 0x64, 0x9c, 0xd7, 0xa3, 0xa8, 0x39, 0x32, 0x15, 0x65, 0x0c, 0xcd, 0x84, 0x8e,
-  0xd9, 0x33, 0xa1, 0xd9, 0xde, 0x01, 0xdd, 0x0a, 0x58, 0x09, 0xec, 0x87, 0x27, 0x33, 0x98, 0xbf,
-  0x45, 0x01, 0xe9, 0x3b, 0x03, 0x27, 0x9d, 0xb4, 0x71, 0xec, 0x62, 0x5e, 0x82, 0x26, 0xcb, 0xf1,
-  0x50, 0xe0, 0xfd, 0x3c, 0x07, 0x41, 0x63, 0xa4, 0x9a, 0xef, 0x4f, 0xe6, 0x1b, 0xd3, 0xb7, 0x50,
-  0x7c, 0xc2, 0x8c, 0x8a, 0xf4, 0x92, 0xb3, 0x61, 0xe2, 0x39, 0xa0, 0xea, 0x99, 0x04, 0xa5, 0x1b,
-  0xaa, 0x90, 0xd3, 0x28, 0x3e, 0x9c, 0xa9, 0x18, 0xd7, 0x32, 0x7e, 0x72, 0x02, 0xd9, 0x7e, 0x16,
-  0x96, 0x97, 0x6e, 0x3a, 0x7d, 0x80, 0x38, 0x9a, 0x01, 0x37, 0x25, 0xc2, 0x28, 0x56, 0x32, 0x44,
-  0x82, 0x6b, 0x0f, 0xce, 0xd5, 0xad, 0xb0, 0xeb, 0x91, 0x9a, 0xb5, 0x1b, 0x7c, 0xf3, 0x45, 0x76,
-  0xff, 0xce, 0x31, 0x62, 0x2b, 0xd4, 0xba, 0x8c, 0x85, 0x28, 0x98, 0xcb, 0xe2, 0xa1, 0x52, 0x20,
-  0x2d, 0x58, 0xe8, 0x74, 0x5a, 0xfd, 0xd8, 0x0a, 0x1e, 0x96, 0xab, 0x54, 0xf7, 0xa3, 0x2d, 0xcb,
-  0xf2, 0x41, 0xea, 0x81, 0x48, 0x8d, 0xf1, 0xac, 0x09, 0x9d, 0x0f, 0x73, 0xc9, 0x0d, 0x71, 0x69,
-  0x9f, 0x66, 0x38, 0x41, 0xf7, 0xa3, 0x99, 0x59, 0x86, 0xf0, 0x76, 0xd0, 0x8a, 0x19, 0xb1, 0xdd,
-  0x8c, 0x81, 0x60, 0xb9, 0x84, 0x1d, 0x82, 0x9c, 0x4f, 0xf0, 0x20, 0xa4, 0x17, 0x52, 0x6a, 0xb9,
-  0xa4, 0xb6, 0xb4, 0xb1, 0x91, 0x14, 0xc7, 0xb9, 0xc5, 0xec, 0x0a, 0x97, 0xb4, 0xdc, 0x76, 0x01,
-  0xb1, 0xfd, 0x7a, 0x79, 0xcc, 0xb2, 0x5d, 0x52, 0x59, 0x37, 0x26, 0xf1, 0xc3, 0x13, 0x0b, 0xcf,
-  0xc9, 0xa4, 0xf3, 0x34, 0xbf, 0xce, 0x05, 0x05, 0x0b, 0x74, 0xc0, 0x1b, 0xb2, 0x84, 0x79, 0xcb,
-  0x31, 0xdd, 0x3c, 0x09, 0xe6, 0x05, 0xbe, 0x17, 0xd4, 0xce, 0xe0, 0x43, 0x56, 0xa1, 0x27, 0x3d,
-  0x01, 0x2c, 0xf9, 0xee, 0x3b, 0x9e, 0xb2, 0xc1, 0x8d, 0x2f, 0x35, 0x95, 0xc2, 0x0d, 0x5b, 0x32,
-  0x97, 0xc8, 0xd5, 0x8c, 0xc8, 0x3e, 0xe2, 0xbf, 0x88, 0x3e, 0x29, 0x56, 0x04, 0x39, 0xc1, 0xe5,
-  0x62, 0xf5, 0xf0, 0x88, 0xa2, 0xf2, 0xfa, 0xa8, 0x2e, 0x7a, 0xc8, 0xe5, 0x5b, 0x5b, 0x95, 0x10,
-  0x5e, 0xc9, 0x7d, 0x42, 0x29, 0x24, 0x64, 0x45, 0x3e, 0x56, 0x46, 0xf3, 0xbd, 0x96, 0xfc, 0x5e,
-  0x31, 0xf9, 0x43, 0x42, 0x72, 0x6c, 0xe7, 0x45, 0xc4, 0xb1, 0x9f, 0x2e, 0x20, 0x05, 0xf1, 0x1a,
-  0x13, 0x17, 0x8c, 0xfa, 0x7e, 0x9d, 0xe7, 0x9a, 0x44, 0xa5, 0x66, 0xbc, 0xe4, 0x91, 0x64, 0xfc,
-  0x01, 0x3e, 0x8c, 0x57, 0x45, 0x27, 0x75, 0x4a, 0x1f, 0x12, 0x1e, 0xa1, 0xfc, 0x33, 0x22, 0x74,
-  0x71, 0x9c, 0xe8, 0xe2, 0x4a, 0x85, 0x89, 0xcc, 0xc5, 0x31, 0xc6, 0x7e, 0x63, 0xcb, 0x16, 0x3e,
-  0x87, 0x05, 0x21, 0xb2, 0x90, 0x95, 0x91, 0x75, 0x83, 0xaa, 0x80, 0xf0, 0x1d, 0x5a, 0x04, 0xe2,
-  0x47, 0x1a, 0xda, 0xfb, 0xe0, 0x5d, 0x58, 0x41, 0xcc, 0x1e, 0x6c, 0x6a, 0x9c, 0x59, 0x96, 0x17,
-  0x50, 0xb2, 0x28, 0x37, 0xa7, 0xf6, 0x72, 0xbe, 0x89, 0x26, 0xdd, 0xe3, 0x79, 0x70, 0x75, 0x24,
-  0xb6, 0x60, 0x45, 0x12, 0xce, 0x60, 0xe1, 0x5a, 0x03, 0xce, 0x47, 0x33, 0x26, 0xe3, 0x44, 0x82,
-  0x95, 0x89, 0xdc, 0x8a, 0xdc, 0x30, 0x94, 0xf1, 0xec, 0xfb, 0xda, 0x83, 0xfe, 0x0c, 0x60, 0x17,
-  0x40, 0xd7, 0x56, 0xac, 0x6c, 0x6a, 0x10, 0x3a, 0x4f, 0xb1, 0xc0, 0xc9, 0x32, 0x46, 0x5e, 0xb4,
-  0xa0, 0xb6, 0xc2, 0xdd, 0x22, 0xcb, 0xa1, 0x1f, 0xaf, 0x84, 0xc6, 0x12, 0xcb, 0xe3, 0x20, 0x8f,
-  0xba, 0xe4, 0xb2, 0x3d, 0x18, 0x7b, 0x72, 0xcf, 0x2c, 0x31, 0xd5, 0xdc, 0x67, 0x13, 0x66, 0xe0,
-  0x38, 0xb7, 0x22, 0xb1, 0xe4, 0x2e, 0x60, 0x46, 0x27, 0x5e, 0x71, 0xcb, 0x12, 0x32, 0x97, 0xdb,
-  0x09, 0x91, 0x3c, 0x4e, 0xb7, 0xac, 0xaf, 0xdf, 0x1b, 0x14, 0x9b, 0x30, 0x50, 0x31, 0xfd, 0x5e,
-  0x85, 0xc4, 0x76, 0x4f, 0x3e, 0xde, 0xc0, 0xfb, 0x0a, 0xf8, 0x66, 0x5c, 0xa6, 0x5e, 0x69, 0xde,
-  0x23, 0x02, 0xf6, 0xf3, 0x59, 0x8c, 0x49, 0x18, 0x42, 0x98, 0xe3, 0xce, 0x0a, 0x26, 0x0f, 0x70,
-  0xa0, 0x14, 0x05, 0xf3, 0xa0, 0x5f, 0xe8, 0x10, 0x8a, 0xb0, 0x94, 0x88, 0xcf, 0x6a, 0xf1, 0xbd,
-  0x8c, 0x74, 0x3d, 0x88, 0x6e, 0x63, 0xa4, 0xde, 0xb7, 0x13, 0x05, 0xae, 0x35, 0xcb, 0x0c, 0x11,
-  0x2c, 0x72, 0x59, 0x5a, 0xe9, 0xfe, 0x75, 0x4c, 0x28, 0x16, 0x4f, 0x96, 0xbc, 0x58, 0xdd, 0x19,
-  0x84, 0x6b, 0x5b, 0x1a, 0x0e, 0xfa, 0x39, 0x9f, 0xbf, 0xc4, 0xdd, 0x17, 0x9d, 0xb1, 0x15, 0x0e,
-  0x1d, 0xaf, 0x6d, 0x74, 0x70, 0x65, 0x07, 0xc6, 0x4b, 0xdb, 0x58, 0x20, 0xe2, 0x3c, 0x9d, 0xf7,
-  0x63, 0x6b, 0xdb, 0x99, 0x45, 0xe4, 0xec, 0x62, 0x70, 0x64, 0x79, 0x51, 0x39, 0x22, 0xa1, 0x33,
-  0x58, 0xe8, 0xbd, 0x61, 0x39, 0x9a, 0xf4, 0xfb, 0x24, 0x8a, 0xe6, 0x2b, 0xb3, 0x86, 0xbf, 0x34,
-  0xfa, 0xd6, 0xa0, 0x69, 0x50, 0x24, 0xc7, 0x1b, 0xf8, 0x05, 0x18, 0xb5, 0xea, 0x76, 0x6b, 0x50,
-  0xa7, 0x18, 0x53, 0x2b, 0xf4, 0x0a, 0x30, 0x06, 0x83, 0x7e, 0xd5, 0xd8, 0xa4, 0x18, 0x74, 0xc9,
-  0xaa, 0x10, 0xa5, 0x59, 0x6b, 0xd6, 0x16, 0xc9, 0xbc, 0x45, 0x01, 0x4a, 0xbd, 0x5e, 0x5f, 0xf0,
-  0x29, 0xa5, 0xc2, 0xd4, 0xc6, 0x42, 0xb7, 0xcb, 0x3d, 0x18, 0x77, 0xd7, 0x73, 0xde, 0x21, 0x6d,
-  0xfa, 0x86, 0x60, 0x0c, 0x26, 0x13, 0x28, 0xbe, 0x20, 0xd0, 0x83, 0xfe, 0x4a, 0x80, 0xf8, 0xb2,
-  0xd0, 0x33, 0xc1, 0xea, 0x9c, 0x3e, 0xb3, 0xa0, 0x0a, 0xba, 0xbc, 0xcd, 0xa0, 0x1c, 0x85, 0x2d,
-  0x0c, 0xcc, 0x93, 0xe7, 0x76, 0x95, 0x27, 0x88, 0x80, 0x75, 0x9e, 0x79, 0x83, 0xae, 0xc9, 0x25,
-  0x56, 0x73, 0x89, 0x90, 0x73, 0x29, 0x20, 0x9e, 0x8b, 0xf7, 0x36, 0x7b, 0xcf, 0x20, 0xb0, 0xd0,
-  0x74, 0x9e, 0xbe, 0xb7, 0xf1, 0x7d, 0xa1, 0x4f, 0x31, 0xb0, 0x9e, 0xd3, 0xf9, 0x56, 0x2a, 0x1e,
-  0x0b, 0x9d, 0x86, 0xda, 0x59, 0x89, 0x59, 0x80, 0x19, 0x04, 0xba, 0x84, 0xdc, 0xd0, 0xd7, 0x9a,
-  0x78, 0xc5, 0x3d, 0x34, 0xfa, 0x78, 0x96, 0x00, 0xca, 0xe0, 0x10, 0x22, 0x90, 0x8b, 0x59, 0x99,
-  0x4d, 0x7a, 0x72, 0xb4, 0x90, 0x11, 0xc1, 0x93, 0xe8, 0xe4, 0x20, 0x27, 0x23, 0xc0, 0x22, 0x85,
-  0x40, 0x52, 0x64, 0x34, 0x8e, 0x09, 0xa4, 0x5a, 0xe3, 0xa0, 0x46, 0x0a, 0x6a, 0x51, 0xd0, 0x2c,
-  0xc5, 0xa2, 0x55, 0x23, 0xa6, 0x90, 0x6c, 0x51, 0x39, 0xcb, 0x9d, 0x99, 0x37, 0x9d, 0xd3, 0x67,
-  0x3a, 0x4b, 0xdc, 0x66, 0x10, 0x9e, 0x2c, 0x4c, 0xf3, 0x32, 0x23, 0x3b, 0x34, 0x35, 0x01, 0x12,
-  0xd7, 0x75, 0x82, 0xc8, 0x89, 0x3a, 0xd3, 0x11, 0x58, 0xfb, 0x32, 0x5d, 0xa2, 0x03, 0x39, 0x98,
-  0x86, 0x56, 0xb0, 0xd0, 0xb3, 0x93, 0xcf, 0x73, 0xf6, 0x82, 0x2e, 0x41, 0x94, 0xd4, 0x94, 0x5b,
-  0x52, 0xcc, 0x61, 0x70, 0xd8, 0x42, 0x17, 0x73, 0xd6, 0x3d, 0x12, 0x4f, 0x71, 0xc3, 0x55, 0x32,
-  0x87, 0xcd, 0x26, 0x5d, 0xda, 0xb4, 0x46, 0x91, 0x9a, 0xa2, 0xf3, 0x4a, 0x97, 0xb1, 0x45, 0xc5,
-  0xa9, 0x53, 0x32, 0xc7, 0x5d, 0x1c, 0x20, 0xfc, 0x01, 0x38, 0x0f, 0x4b, 0x49, 0xed, 0x11, 0x36,
-  0x73, 0x75, 0x9c, 0x84, 0xc3, 0x9e, 0x45, 0x37, 0x89, 0x89, 0xff, 0x7a, 0x4d, 0x5d, 0xe8, 0x78,
-  0x94, 0x3c, 0x19, 0x09, 0x8e, 0x87, 0xbb, 0xc1, 0xd8, 0x48, 0xea, 0x30, 0x91, 0xaa, 0x63, 0x77,
-  0x70, 0x59, 0xa2, 0xcf, 0x99, 0x72, 0x43, 0x12, 0x80, 0x9e, 0x03, 0xbe, 0xf1, 0xa7, 0x6c, 0x5a,
-  0xe0, 0x47, 0x0e, 0x1b, 0x3c, 0x9c, 0x76, 0xac, 0xa8, 0x8c, 0xfe, 0x55, 0x96, 0x32, 0x7a, 0x6c,
-  0x3d, 0xb3, 0xb3, 0x85, 0x1d, 0x63, 0x8f, 0x6e, 0x86, 0xa5, 0xdb, 0xb1, 0xdb, 0x11, 0x47, 0xf8,
-  0x2f, 0xce, 0x8f, 0xca, 0x5b, 0xda, 0x0e, 0x80, 0x25, 0x00, 0x7b, 0xb8, 0x00, 0x12, 0xc7, 0x41,
-  0xbb, 0x52, 0x99, 0x4e, 0xa7, 0xfa, 0xb4, 0xae, 0xfb, 0xe1, 0xb0, 0x52, 0x03, 0x8d, 0x87, 0x19,
-  0x65, 0xb6, 0xf4, 0x60, 0xca, 0x75, 0x43, 0xe6, 0x93, 0xf3, 0xec, 0x99, 0x9d, 0x36, 0xba, 0x35,
-  0x65, 0x43, 0x32, 0xa4, 0x3a, 0xfe, 0x93, 0xbb, 0x3b, 0x81, 0x15, 0x8f, 0x24, 0xf0, 0xdc, 0xde,
-  0x35, 0xa5, 0x4d, 0xbd, 0x39, 0xaa, 0x19, 0xf0, 0x50, 0xe5, 0xdf, 0xb5, 0x1a, 0x85, 0xe0, 0xb2,
-  0x4a, 0xe8, 0x5f, 0xe3, 0x2a, 0x1f, 0xca, 0x8a, 0x78, 0x2d, 0xf3, 0x6a, 0x1a, 0x09, 0x00, 0x59,
-  0xd7, 0xb7, 0x02, 0x53, 0xa6, 0x4d, 0x93, 0x2b, 0x38, 0x5b, 0x7f, 0x33, 0xec, 0x6e, 0xa8, 0x19,
-  0xd5, 0x26, 0x96, 0xa1, 0xea, 0xc0, 0xc8, 0xcc, 0x1e, 0xb0, 0x2d, 0xf1, 0x3a, 0x65, 0xe9, 0x9b,
-  0x86, 0xb1, 0x28, 0x9a, 0xc7, 0xd5, 0x85, 0x23, 0x3a, 0xef, 0xf9, 0xa8, 0x45, 0x2c, 0x1b, 0x64,
-  0xd9, 0xf1, 0xd0, 0x72, 0x1b, 0x52, 0xb9, 0x19, 0xdc, 0xc2, 0xd7, 0x2f, 0xad, 0xad, 0xc1, 0x22,
-  0x33, 0xaf, 0x29, 0x54, 0x43, 0x13, 0x0c, 0x07, 0x14, 0x28, 0xde, 0x0c, 0x3a, 0xc2, 0x6f, 0xf9,
-  0x3b, 0x70, 0x0f, 0xbb, 0x76, 0xb9, 0xd0, 0x72, 0x95, 0x16, 0x69, 0xe0, 0xee, 0xcc, 0x41, 0x63,
-  0x51, 0x3c, 0x5b, 0x9a, 0x21, 0x6a, 0x45, 0x35, 0x03, 0x2d, 0x8d, 0x82, 0x62, 0x9b, 0xa2, 0x58,
-  0x4a, 0x2b, 0x9d, 0x8d, 0x1c, 0x55, 0xd9, 0x01, 0xe3, 0x44, 0x4b, 0x75, 0xee, 0x2d, 0x8d, 0x6e,
-  0xcb, 0x13, 0x9a, 0x01, 0x4a, 0x8a, 0x7c, 0x17, 0xfc, 0x26, 0x4a, 0x62, 0x27, 0xa7, 0x6f, 0x56,
-  0x77, 0x38, 0xfd, 0xa5, 0x36, 0xe8, 0xd3, 0x78, 0x89, 0x9f, 0x80, 0x3d, 0xfe, 0x60, 0x1a, 0x1a,
-  0x7f, 0x3e, 0x25, 0x96, 0xfd, 0xc1, 0x73, 0x67, 0x66, 0x35, 0x85, 0x44, 0x78, 0xa0, 0xd8, 0x36,
-  0x6b, 0x02, 0x72, 0x16, 0x38, 0x66, 0x5d, 0xbc, 0x1c, 0x7b, 0x37, 0xa0, 0xa4, 0x6c, 0x33, 0x39,
-  0xab, 0xd3, 0xe1, 0x9b, 0x74, 0x58, 0xa5, 0x73, 0xea, 0x4b, 0xe1, 0xe9, 0xdc, 0xcc, 0x46, 0x1d,
-  0xc2, 0xf6, 0x3e, 0x5b, 0x78, 0xe8, 0xa5, 0xc0, 0xfd, 0x8a, 0x49, 0x14, 0x2b, 0x32, 0x7e, 0xca,
-  0xaa, 0x46, 0x74, 0x6f, 0xf5, 0x48, 0xb2, 0xf5, 0xd8, 0x91, 0x64, 0xab, 0xf0, 0x48, 0xb2, 0xee,
-  0xa9, 0x73, 0xab, 0x64, 0x2e, 0x9d, 0x61, 0x8a, 0xd5, 0xdc, 0x29, 0xeb, 0x05, 0x2f, 0x19, 0x10,
-  0xe5, 0x9d, 0x20, 0x24, 0x5d, 0xb9, 0xb4, 0x7c, 0x28, 0x4b, 0xa3, 0x47, 0x01, 0x6b, 0x6a, 0x49,
-  0xde, 0xa9, 0x50, 0x0c, 0xcd, 0x5a, 0x2c, 0x7b, 0x5f, 0x7c, 0x2b, 0xf9, 0x72, 0xdb, 0xa6, 0x96,
-  0x7b, 0x7d, 0x3e, 0x02, 0xc9, 0x1b, 0xb2, 0x33, 0xdb, 0xf9, 0x33, 0x23, 0xce, 0x40, 0x59, 0x3a,
-  0x20, 0xc3, 0x0f, 0x29, 0xe0, 0xb9, 0x3e, 0xb1, 0xd1, 0x9b, 0x7d, 0xe3, 0x81, 0x48, 0x8d, 0x1d,
-  0x9d, 0x11, 0x48, 0xcb, 0x87, 0xb3, 0x48, 0xfe, 0x70, 0xd6, 0x9c, 0x62, 0xb5, 0x39, 0xf6, 0x42,
-  0xc5, 0x33, 0xa8, 0xc8, 0x92, 0x05, 0xe5, 0x37, 0x64, 0x5f, 0xa4, 0x67, 0xfe, 0xf0, 0xe8, 0xac,
-  0xce, 0x66, 0x29, 0xf8, 0x99, 0x45, 0x3c, 0x01, 0x84, 0x80, 0x17, 0xc9, 0x21, 0xfd, 0x76, 0x72,
-  0x8a, 0x31, 0x49, 0x93, 0x2f, 0x00, 0x22, 0xb7, 0xe5, 0xb3, 0x59, 0x04, 0x83, 0x57, 0x4e, 0xce,
-  0xd4, 0x83, 0x3b, 0x1e, 0x4c, 0xa2, 0x11, 0x9e, 0x22, 0x2d, 0x88, 0x9f, 0x93, 0xa0, 0x8f, 0x1f,
-  0xab, 0x4f, 0x7b, 0x83, 0xbd, 0x2f, 0xb3, 0x56, 0x5d, 0xac, 0x70, 0x11, 0x44, 0xc2, 0x4c, 0x2b,
-  0xcb, 0x9c, 0x6e, 0xa6, 0xcb, 0xe9, 0x42, 0xdc, 0xa8, 0x2f, 0x0c, 0x3c, 0xb6, 0x4c, 0x3c, 0xd5,
-  0x08, 0x52, 0x24, 0xba, 0x9a, 0x1d, 0x19, 0xf6, 0x80, 0xcb, 0xbc, 0x98, 0x82, 0x0a, 0x20, 0x1d,
-  0xb3, 0x24, 0x79, 0x16, 0x8b, 0xfc, 0x91, 0xee, 0x79, 0x71, 0xc6, 0x5c, 0xff, 0xae, 0x76, 0xd0,
-  0xf2, 0xb1, 0x70, 0x75, 0x21, 0x8e, 0xde, 0x65, 0xa5, 0xfc, 0x09, 0x45, 0xd3, 0x63, 0xb6, 0x81,
-  0x63, 0x43, 0x97, 0xe2, 0x61, 0xd0, 0xa4, 0x6d, 0x04, 0xcb, 0x5c, 0x3a, 0x10, 0xcb, 0x19, 0x12,
-  0x77, 0x62, 0x7e, 0xce, 0x3e, 0xaa, 0x41, 0x1f, 0x16, 0x9c, 0x01, 0xa7, 0x07, 0x6c, 0x5f, 0xc8,
-  0xa0, 0x57, 0x02, 0x97, 0x40, 0xbf, 0x32, 0xe4, 0xfa, 0x83, 0xc8, 0xf4, 0xcc, 0x47, 0x5b, 0x1e,
-  0x86, 0x78, 0x56, 0x85, 0x1e, 0x6e, 0x73, 0x4c, 0x1a, 0xaa, 0xee, 0xb3, 0x8d, 0x0b, 0x8a, 0x5c,
-  0xc3, 0x83, 0x54, 0xa1, 0xf9, 0xc0, 0x99, 0xf3, 0x1d, 0xb3, 0x61, 0xbc, 0xa8, 0xb5, 0x1b, 0x9a,
-  0xfb, 0x10, 0x56, 0x25, 0xd4, 0x22, 0x76, 0x24, 0x1d, 0x8c, 0x0f, 0xb4, 0x9e, 0x9a, 0x1b, 0x00,
-  0x12, 0x9d, 0x99, 0xc2, 0x8a, 0xe2, 0x96, 0x6a, 0x2a, 0x8c, 0x12, 0xb3, 0x6a, 0x3c, 0x8f, 0x34,
-  0xdf, 0x74, 0xe1, 0xd3, 0x66, 0x39, 0xc0, 0x53, 0x03, 0x11, 0x11, 0x99, 0xca, 0x9e, 0x5a, 0xa9,
-  0x81, 0x6c, 0xe2, 0x0d, 0x16, 0x8e, 0xde, 0x77, 0x89, 0x15, 0x9e, 0xe2, 0xb9, 0x35, 0x43, 0x33,
-  0x34, 0x8e, 0x92, 0x94, 0x0a, 0x68, 0xfa, 0xad, 0x69, 0xc3, 0xe7, 0xcc, 0x8c, 0x34, 0x47, 0xef,
-  0x11, 0x30, 0x29, 0x27, 0x50, 0xa6, 0xa2, 0xc2, 0x1b, 0x6e, 0xd7, 0x38, 0xa3, 0x5b, 0x25, 0x62,
-  0xfe, 0x46, 0x0b, 0x82, 0x2c, 0x98, 0x41, 0xf3, 0x34, 0x3f, 0x8f, 0x45, 0x4f, 0xd4, 0xe0, 0x01,
-  0x19, 0x59, 0xab, 0x99, 0x66, 0xf8, 0x22, 0x9f, 0xa7, 0x54, 0xd5, 0x9b, 0x40, 0xb3, 0xa1, 0x6d,
-  0xc2, 0x67, 0xfd, 0x79, 0xa4, 0xb6, 0x97, 0xd2, 0x6b, 0x3c, 0xbd, 0xc9, 0xd3, 0xf3, 0x65, 0xe3,
-  0x8e, 0xfc, 0x87, 0xca, 0x05, 0x8a, 0x4a, 0x90, 0x8b, 0x96, 0xbe, 0x79, 0x6f, 0xe9, 0x02, 0xab,
-  0xc9, 0xfe, 0xab, 0xab, 0x6d, 0x86, 0x2e, 0x32, 0x69, 0x89, 0x25, 0x19, 0x4d, 0x26, 0x86, 0x7f,
-  0x72, 0x9e, 0x92, 0x9e, 0x0b, 0x06, 0x17, 0x61, 0x28, 0x01, 0xbb, 0xe8, 0xd4, 0x9a, 0x32, 0xdf,
-  0x72, 0xc1, 0x11, 0x71, 0x01, 0x5f, 0xb9, 0x4f, 0xaa, 0x90, 0xe5, 0x25, 0x41, 0x4b, 0x0b, 0x69,
-  0xc0, 0x46, 0xc1, 0x70, 0x2d, 0xae, 0x24, 0xd7, 0x88, 0x16, 0xcf, 0x56, 0xad, 0xc1, 0x43, 0x8d,
-  0xb7, 0x61, 0x85, 0x51, 0x64, 0xb6, 0x92, 0xb1, 0x4e, 0x5b, 0xef, 0x97, 0x29, 0x67, 0x29, 0x77,
-  0xa9, 0x34, 0x4f, 0x32, 0x37, 0x08, 0xb0, 0x9b, 0x26, 0x42, 0x7a, 0xb1, 0x44, 0xfe, 0x42, 0x05,
-  0x97, 0x5e, 0x9b, 0x40, 0x87, 0x19, 0xb5, 0x7e, 0xd1, 0xd4, 0xc1, 0x13, 0x82, 0x05, 0x0d, 0x4c,
-  0xae, 0xa1, 0x98, 0x5c, 0x82, 0xc5, 0xc0, 0xdd, 0x15, 0x46, 0x1b, 0xb2, 0x6c, 0x6e, 0x69, 0xd5,
-  0xcd, 0xba, 0xd6, 0x34, 0x2e, 0x3b, 0x74, 0xd7, 0x57, 0x87, 0x26, 0x55, 0x31, 0xa9, 0x56, 0x85,
-  0xb4, 0xfa, 0xb6, 0xd6, 0xd8, 0xce, 0xa5, 0xd5, 0x30, 0xad, 0xda, 0x6c, 0x41, 0x1e, 0xad, 0xd6,
-  0x68, 0x89, 0x34, 0x9b, 0xa9, 0x4e, 0x9a, 0xb8, 0x5d, 0xd3, 0x1a, 0x5b, 0x5a, 0x7d, 0xeb, 0x72,
-  0x91, 0x6d, 0xfe, 0x15, 0xf5, 0xde, 0x7f, 0x9d, 0xe3, 0x94, 0xc7, 0x42, 0xc3, 0xef, 0x2a, 0xff,
-  0xae, 0xd1, 0x6f, 0xeb, 0xdb, 0xa4, 0xd4, 0xbc, 0x5c, 0xa8, 0x57, 0x54, 0xe6, 0x95, 0xb8, 0xa4,
-  0x37, 0x55, 0xe8, 0xeb, 0x65, 0xe1, 0xc7, 0x61, 0x61, 0xd0, 0x73, 0x9c, 0xd8, 0x39, 0x3f, 0x7e,
-  0x90, 0x1d, 0xb3, 0xba, 0xbe, 0xde, 0x40, 0xe9, 0x53, 0x08, 0xcf, 0x63, 0xb7, 0x6b, 0xf9, 0xf7,
-  0xd2, 0xd6, 0xf3, 0xa8, 0x9d, 0x79, 0xc5, 0xde, 0x72, 0x74, 0x2b, 0xec, 0x27, 0x43, 0x46, 0x6f,
-  0x50, 0x09, 0xaf, 0xb1, 0xdb, 0x14, 0x4e, 0x8e, 0x45, 0xd7, 0x29, 0xf7, 0x08, 0xe2, 0x9f, 0x21,
-  0x87, 0x13, 0x8d, 0xd7, 0x5e, 0x8a, 0x2a, 0x0d, 0x55, 0x9b, 0x94, 0x4a, 0x8b, 0x45, 0x7a, 0xe2,
-  0x74, 0x45, 0x8b, 0xcf, 0x79, 0xef, 0x32, 0x2b, 0xc8, 0x7a, 0x91, 0x6e, 0xaa, 0x95, 0xdb, 0x5c,
-  0x0b, 0xd3, 0x8b, 0x63, 0x00, 0x00, 0x8a, 0xdd, 0xc1, 0x38, 0x0a, 0x0f, 0x76, 0x53, 0xac, 0xfe,
-  0x88, 0xf4, 0xaf, 0xc1, 0x89, 0xcd, 0x61, 0xee, 0x73, 0xe0, 0x0a, 0x76, 0x88, 0x9b, 0xd8, 0x73,
-  0xa8, 0xa7, 0x08, 0x59, 0xc1, 0xeb, 0x4d, 0xc0, 0x81, 0xf5, 0x72, 0x88, 0x7b, 0x14, 0xb4, 0x82,
-  0xc9, 0x4f, 0x91, 0x65, 0x31, 0xd9, 0x26, 0x86, 0x15, 0xcc, 0x20, 0xf4, 0x87, 0x78, 0xec, 0x20,
-  0x87, 0x7b, 0xc2, 0x81, 0xab, 0xed, 0xb2, 0xc0, 0x2f, 0xcc, 0xe3, 0xee, 0x53, 0xd0, 0x2a, 0x26,
-  0x28, 0x62, 0xbb, 0x7e, 0x90, 0x47, 0x65, 0xb0, 0x15, 0x5c, 0x1a, 0x83, 0xe6, 0x99, 0x8a, 0x90,
-  0x2c, 0x9e, 0x10, 0xf7, 0x0c, 0x4e, 0x26, 0x79, 0xb1, 0x60, 0xde, 0xa9, 0x00, 0xd1, 0xd3, 0x7e,
-  0x10, 0xd7, 0xd3, 0x9d, 0x45, 0x84, 0xdb, 0xf0, 0x1b, 0x9e, 0x68, 0x72, 0x7f, 0x04, 0xd7, 0xc9,
-  0xe9, 0xad, 0x13, 0xb9, 0x54, 0x34, 0xb6, 0x25, 0x59, 0x97, 0x4b, 0x79, 0xa8, 0x63, 0xab, 0x8b,
-  0xac, 0xab, 0x6b, 0x5e, 0xed, 0x38, 0x5e, 0x30, 0x89, 0x25, 0x36, 0x89, 0xff, 0xb4, 0x22, 0x16,
-  0xb2, 0x94, 0x2c, 0x11, 0xe5, 0x92, 0xd8, 0x82, 0x91, 0x58, 0x51, 0xb8, 0x27, 0x95, 0x1f, 0x7e,
-  0x5c, 0x4e, 0x65, 0x6e, 0x1f, 0xee, 0x4b, 0xa6, 0x04, 0x75, 0xaf, 0x84, 0x5b, 0x74, 0xb5, 0x13,
-  0x24, 0x07, 0x28, 0xf9, 0xd6, 0x02, 0x76, 0xfc, 0xf6, 0xd7, 0xb9, 0x38, 0xc5, 0xbe, 0xda, 0x46,
-  0x71, 0x44, 0x37, 0x9f, 0xf1, 0xd7, 0x39, 0x59, 0x2c, 0x15, 0x15, 0x74, 0xaf, 0xb4, 0x98, 0x1a,
-  0x56, 0xf4, 0xb1, 0x7c, 0xef, 0xe2, 0xd8, 0xfc, 0xf6, 0x34, 0x2e, 0x5c, 0x66, 0x9d, 0xc5, 0xec,
-  0xa5, 0x0b, 0x31, 0xbf, 0xed, 0x21, 0xc1, 0x65, 0x7e, 0xfd, 0x55, 0xb2, 0x45, 0xee, 0xc9, 0x7c,
-  0xfe, 0x7b, 0xba, 0x65, 0xd9, 0x83, 0xcc, 0x72, 0xf7, 0x2a, 0xd5, 0xed, 0xc9, 0x65, 0x1b, 0x4b,
-  0xd5, 0xac, 0x3a, 0x71, 0xb9, 0xf0, 0x81, 0xc6, 0x0d, 0x74, 0x29, 0x46, 0x4e, 0x42, 0x89, 0x82,
-  0x3b, 0x1b, 0x12, 0xc9, 0xe2, 0xae, 0x1b, 0xe5, 0xa6, 0xe8, 0x91, 0x24, 0x11, 0x6f, 0x23, 0x01,
-  0xf5, 0xf4, 0x1e, 0x1f, 0xf3, 0xdb, 0xe0, 0x64, 0x9a, 0x41, 0x56, 0x3b, 0xd6, 0x0b, 0x2b, 0xdd,
-  0x02, 0x67, 0xf2, 0x82, 0xda, 0x85, 0x25, 0x24, 0xcb, 0x3d, 0xc0, 0x2a, 0xd1, 0xc3, 0x3c, 0x43,
-  0xd2, 0x9f, 0x57, 0xa5, 0x87, 0xb3, 0x2e, 0xfe, 0xa1, 0x18, 0x65, 0x7d, 0x9d, 0xbd, 0xa6, 0x75,
-  0x70, 0xb0, 0xb2, 0x04, 0x49, 0x82, 0x1a, 0xf0, 0xbb, 0xf8, 0x41, 0xb7, 0x9f, 0x61, 0x0e, 0xcf,
-  0x82, 0xec, 0xf9, 0xf1, 0x03, 0x9c, 0xfa, 0xfe, 0x61, 0x06, 0xa6, 0x15, 0x96, 0x00, 0x71, 0x0d,
-  0xf1, 0xec, 0x7d, 0xdc, 0x8a, 0xaa, 0x80, 0x9b, 0xaf, 0xe5, 0xb9, 0xca, 0x33, 0x2f, 0x68, 0x5f,
-  0xb1, 0xbb, 0x85, 0x28, 0x35, 0x1d, 0xcb, 0xfc, 0x89, 0x0b, 0xc9, 0xf8, 0xcd, 0x5b, 0x72, 0xfb,
-  0x8a, 0x4f, 0x32, 0xfd, 0x3a, 0xbf, 0xef, 0xa6, 0x9e, 0x45, 0x05, 0x6b, 0xa9, 0x5c, 0x69, 0xcb,
-  0xf7, 0x1b, 0x58, 0x1a, 0x23, 0x20, 0x3f, 0x04, 0xb4, 0xa5, 0xf0, 0x98, 0xe1, 0x64, 0x6f, 0xb4,
-  0xb1, 0x54, 0x9e, 0x51, 0x07, 0x9d, 0x68, 0x3e, 0x33, 0x72, 0xb7, 0x10, 0xc8, 0x19, 0x01, 0x65,
-  0x67, 0xa3, 0xf8, 0xa2, 0x9d, 0x4c, 0xe3, 0x09, 0x9e, 0x93, 0xc6, 0x27, 0x4b, 0x71, 0x0f, 0x31,
-  0x37, 0x64, 0xda, 0x53, 0x72, 0x7b, 0xa3, 0xb4, 0x7a, 0x29, 0xd4, 0x5c, 0xe6, 0x27, 0x97, 0x09,
-  0x0c, 0x0b, 0x4d, 0x92, 0xd5, 0xfc, 0x98, 0x4e, 0x47, 0x45, 0x86, 0xd2, 0xab, 0xf9, 0x4f, 0x28,
-  0xca, 0xf6, 0x1c, 0x75, 0x4e, 0xd2, 0xb9, 0x6d, 0xc8, 0x9a, 0xa3, 0x40, 0x8f, 0xfd, 0x33, 0x1a,
-  0xb9, 0x2b, 0xf5, 0x96, 0xaa, 0x47, 0x38, 0x67, 0xa2, 0xd4, 0xd4, 0x85, 0xbc, 0x58, 0x5c, 0xa9,
-  0x89, 0x39, 0xc8, 0x9a, 0x66, 0x09, 0x9e, 0x41, 0x10, 0x32, 0x36, 0x62, 0x29, 0xce, 0x8b, 0x26,
-  0x01, 0xd0, 0x9e, 0x03, 0x5e, 0x09, 0x16, 0x3c, 0xb5, 0xf6, 0xab, 0xa4, 0xea, 0x65, 0x5b, 0xbf,
-  0x5a, 0x7d, 0xee, 0x02, 0x05, 0xae, 0x51, 0x18, 0x0d, 0x99, 0x94, 0x7f, 0xba, 0x95, 0x49, 0xcc,
-  0x48, 0x76, 0x2b, 0x31, 0x73, 0x67, 0xc6, 0xf4, 0x92, 0x00, 0xbe, 0x9f, 0xf8, 0x4a, 0x5d, 0x56,
-  0x7e, 0x8c, 0xf6, 0x3c, 0x30, 0x1d, 0x92, 0x42, 0x43, 0x14, 0x69, 0x06, 0x5a, 0x3a, 0xb1, 0x45,
-  0x5a, 0x66, 0x1c, 0xe3, 0x06, 0x16, 0x70, 0xe2, 0x20, 0x0e, 0x04, 0x86, 0x98, 0x65, 0xbc, 0x5b,
-  0x8c, 0xeb, 0x8f, 0xc5, 0xe3, 0xbd, 0x97, 0x11, 0xe0, 0xfc, 0x65, 0x6a, 0x3b, 0x7a, 0xbd, 0xfe,
-  0xa2, 0x5c, 0x6d, 0x2f, 0x01, 0x5b, 0xad, 0x17, 0x46, 0xbb, 0x9a, 0x4a, 0x4f, 0xce, 0x07, 0xfb,
-  0x6f, 0xd4, 0x7f, 0xc0, 0x0d, 0x53, 0x36, 0xe0, 0xdb, 0xba, 0x35, 0xe5, 0x5a, 0xb3, 0xf9, 0x73,
-  0x3d, 0xfa, 0x73, 0x76, 0x34, 0xbc, 0x49, 0xb6, 0x4b, 0x2e, 0x39, 0x1c, 0x3f, 0x25, 0x07, 0x1d,
-  0xa6, 0xe2, 0x9f, 0xee, 0x6c, 0x95, 0x64, 0xac, 0x1a, 0xd4, 0xfc, 0xaa, 0xdc, 0xe4, 0x15, 0xf8,
-  0x1f, 0x91, 0x86, 0xdc, 0x75, 0x77, 0xcd, 0x25, 0xcd, 0x96, 0x74, 0x7f, 0xde, 0xb3, 0xfe, 0xab,
-  0x8c, 0xdf, 0xd4, 0x4b, 0xbc, 0xdf, 0xc7, 0xcb, 0xfa, 0x8a, 0x4f, 0xe0, 0x9c, 0x2c, 0x27, 0x3c,
-  0xc9, 0xc7, 0x10, 0x7f, 0x98, 0x27, 0xfc, 0xde, 0x97, 0x9f, 0x64, 0x0a, 0x6f, 0x37, 0x0f, 0x6d,
-  0xba, 0xc9, 0x5d, 0x1f, 0xab, 0x22, 0x88, 0x77, 0x5a, 0x3d, 0x51, 0x1b, 0xb1, 0xeb, 0x43, 0x22,
-  0x1e, 0x22, 0x78, 0x79, 0x77, 0x8a, 0xdf, 0xe2, 0x64, 0x65, 0xa6, 0x06, 0xf8, 0x8c, 0xb3, 0xc8,
-  0x56, 0x90, 0x0b, 0x1d, 0xd6, 0xdc, 0x75, 0x25, 0x10, 0x69, 0x43, 0xa0, 0x89, 0xc3, 0x68, 0x91,
-  0x5c, 0x57, 0x72, 0xd5, 0x59, 0x76, 0x8c, 0x8a, 0xc6, 0x58, 0xe1, 0x54, 0x24, 0xa3, 0x1f, 0x2f,
-  0xcf, 0xcb, 0x28, 0x50, 0xf0, 0x6e, 0xde, 0xd3, 0x6d, 0xbf, 0x6c, 0x7b, 0xc4, 0xfa, 0x7a, 0xe1,
-  0x08, 0xe0, 0x54, 0xcb, 0xed, 0x6f, 0x32, 0x71, 0x3c, 0x59, 0x93, 0xef, 0xa6, 0xc4, 0x81, 0x2f,
-  0x3b, 0x84, 0xaf, 0xcb, 0x0d, 0x55, 0xfb, 0x69, 0x2d, 0x6a, 0x14, 0x28, 0xd1, 0x6a, 0xbb, 0x96,
-  0x8e, 0xa2, 0xe5, 0x48, 0xf2, 0x0f, 0xcb, 0x8c, 0x88, 0x53, 0x99, 0xda, 0x5b, 0x16, 0x1b, 0x00,
-  0x2e, 0xe4, 0x3f, 0x28, 0x50, 0x49, 0x04, 0x8c, 0xb7, 0xc6, 0xf0, 0xe7, 0x6e, 0xc6, 0x92, 0xe7,
-  0xe2, 0xdb, 0xa7, 0xd1, 0x9f, 0xaf, 0x0c, 0x7d, 0x2c, 0x61, 0xf0, 0x72, 0x40, 0xee, 0xb2, 0x09,
-  0xbe, 0xe7, 0xda, 0xcb, 0x22, 0xed, 0x3f, 0xd8, 0xa4, 0x7b, 0x2d, 0x01, 0x2b, 0xf5, 0x89, 0x5a,
-  0xfb, 0x01, 0xf1, 0xc3, 0xe1, 0x63, 0x9a, 0x45, 0xcd, 0x2c, 0x14, 0x21, 0x4c, 0x02, 0x2f, 0xea,
-  0xe8, 0xef, 0x60, 0x32, 0x88, 0x5b, 0xbb, 0xad, 0x95, 0xab, 0xad, 0xdb, 0x6a, 0x8b, 0xdd, 0x52,
-  0xfb, 0x88, 0xdc, 0xc9, 0x5e, 0xc5, 0x02, 0x9c, 0xc4, 0xa7, 0xcb, 0xce, 0x0c, 0xfc, 0x61, 0x69,
-  0x62, 0xbb, 0xf4, 0xfe, 0x64, 0xe6, 0xd2, 0x42, 0x9f, 0xa6, 0x53, 0xef, 0x6b, 0xdd, 0xd2, 0x0c,
-  0xc9, 0x1f, 0xd7, 0xb0, 0x3f, 0x6d, 0xea, 0x1f, 0x6d, 0x1e, 0x33, 0x64, 0xcc, 0x32, 0x79, 0x93,
-  0x71, 0x0f, 0xcf, 0xaa, 0x05, 0x78, 0x82, 0x7c, 0xe4, 0xbb, 0x36, 0x09, 0x4d, 0xf9, 0x16, 0xd7,
-  0xaf, 0x1f, 0xc5, 0x9a, 0x3d, 0x09, 0xeb, 0x8e, 0xad, 0x85, 0xff, 0xf9, 0x9e, 0xa6, 0x50, 0x94,
-  0x10, 0xc3, 0xe6, 0x23, 0x52, 0xfd, 0x56, 0x2b, 0xc4, 0xab, 0x2e, 0xe3, 0xcd, 0x8a, 0xf1, 0x6a,
-  0xcb, 0x78, 0x77, 0x4f, 0x91, 0x83, 0x24, 0xc2, 0x98, 0x03, 0xfb, 0xda, 0xbf, 0xce, 0xeb, 0x2d,
-  0x23, 0xef, 0x8f, 0x2c, 0x20, 0xb8, 0x9a, 0xdd, 0x9b, 0x72, 0x57, 0x9c, 0xb2, 0xb8, 0x2a, 0xbe,
-  0x35, 0x8a, 0x4e, 0x05, 0xe4, 0x77, 0xe2, 0xb4, 0x82, 0x5b, 0xbe, 0xe9, 0x0b, 0x3a, 0x5c, 0xc9,
-  0xdd, 0x49, 0xa3, 0x2e, 0x78, 0xf4, 0x35, 0x67, 0xdb, 0x0e, 0xb0, 0x8c, 0xb6, 0x13, 0x5b, 0x10,
-  0xed, 0x88, 0x8d, 0x3e, 0x2e, 0x19, 0xac, 0x16, 0x91, 0xbb, 0xc0, 0x46, 0x5d, 0xd0, 0xbe, 0xce,
-  0x6e, 0x34, 0x33, 0x24, 0x23, 0x87, 0x9f, 0xde, 0x5e, 0xa2, 0x66, 0x36, 0x38, 0xd0, 0xfd, 0x40,
-  0x38, 0x79, 0x33, 0xcf, 0xd6, 0x55, 0x33, 0xfe, 0xf2, 0x6b, 0xf4, 0xc9, 0x7c, 0x73, 0xb2, 0xe2,
-  0xca, 0xc7, 0xb1, 0x9c, 0x1c, 0xbd, 0x94, 0xd3, 0x49, 0xe9, 0xfc, 0xdd, 0xe0, 0xf7, 0x5f, 0xb4,
-  0x27, 0xa6, 0xc8, 0x98, 0x82, 0xc7, 0x2d, 0xa7, 0xc9, 0xd9, 0xde, 0x64, 0x5b, 0x8d, 0xd5, 0x8b,
-  0x7c, 0x77, 0x12, 0x93, 0x4e, 0x76, 0x17, 0x9b, 0xdc, 0x95, 0xfe, 0xf5, 0xb6, 0xde, 0x7f, 0x56,
-  0x2e, 0x17, 0xec, 0x9e, 0x60, 0x37, 0xeb, 0x94, 0xcb, 0x80, 0x41, 0xf8, 0x0d, 0x6b, 0x41, 0x77,
-  0x87, 0x4d, 0x43, 0x67, 0xaa, 0x63, 0xae, 0x72, 0x15, 0x75, 0x20, 0x4b, 0xa3, 0xf7, 0xaf, 0x3d,
-  0x9a, 0xa1, 0xf6, 0xb3, 0x19, 0xea, 0xc5, 0x19, 0x12, 0x65, 0xc7, 0x70, 0x71, 0x60, 0xc9, 0xfc,
-  0x82, 0x04, 0x53, 0x8e, 0x43, 0xbc, 0xab, 0x8e, 0xeb, 0x12, 0xcc, 0xc0, 0x26, 0xf1, 0x36, 0x56,
-  0x58, 0xcc, 0x1d, 0xc7, 0x6a, 0xc1, 0x3d, 0xdb, 0x2b, 0x57, 0x58, 0xd3, 0x49, 0xcf, 0x1f, 0x3f,
-  0x14, 0x9e, 0x9e, 0x5e, 0x6d, 0x8d, 0xb7, 0xaa, 0xf3, 0xb7, 0xfa, 0x01, 0xde, 0x8c, 0xad, 0xfd,
-  0xe4, 0x2d, 0xd7, 0x62, 0x9f, 0xc2, 0x33, 0x43, 0x3c, 0x54, 0x53, 0x4a, 0x39, 0x56, 0xed, 0x80,
-  0xde, 0x86, 0xe9, 0x31, 0x1a, 0x0b, 0x97, 0x61, 0x5d, 0xb3, 0x89, 0x34, 0x3e, 0xbe, 0xe8, 0xe9,
-  0x65, 0x66, 0xbd, 0x0a, 0x56, 0x5d, 0x59, 0xf2, 0x52, 0x2e, 0x01, 0x15, 0x65, 0x58, 0x85, 0x6b,
-  0xaf, 0xd1, 0xf3, 0x6c, 0x66, 0x5c, 0x88, 0x45, 0x8a, 0x38, 0xcc, 0x9f, 0xc4, 0xa0, 0x15, 0x22,
-  0xba, 0xba, 0x06, 0x5a, 0x40, 0x0a, 0xd1, 0xad, 0x5e, 0x4a, 0x03, 0xec, 0x50, 0x67, 0x97, 0x50,
-  0x27, 0x78, 0xf4, 0xaa, 0xe4, 0x04, 0x1a, 0x7f, 0x73, 0x2f, 0x4b, 0xf0, 0x51, 0xaa, 0xb2, 0xaf,
-  0xda, 0x65, 0xb7, 0x66, 0x2c, 0x2d, 0x1f, 0xe2, 0x2a, 0x98, 0x02, 0x36, 0x0d, 0x50, 0x71, 0xd1,
-  0x8b, 0x61, 0x8b, 0xa7, 0x1a, 0x5d, 0xfe, 0x5a, 0x5e, 0x6f, 0xc2, 0x65, 0x2a, 0x1f, 0x64, 0xe0,
-  0x79, 0x54, 0xa9, 0x1a, 0x25, 0x4b, 0xf3, 0xc1, 0x08, 0xd0, 0xe7, 0x07, 0x16, 0xad, 0x80, 0xe5,
-  0x25, 0xb3, 0x4e, 0x6f, 0x01, 0x96, 0x72, 0x33, 0x70, 0x49, 0x9f, 0xd1, 0xdb, 0xa4, 0xd9, 0x4e,
-  0x07, 0xdc, 0x48, 0xed, 0x12, 0x3b, 0x92, 0x05, 0xfb, 0xf9, 0x37, 0xdb, 0xc9, 0xf0, 0xf4, 0x32,
-  0x38, 0xa7, 0x8a, 0x8b, 0xf1, 0x52, 0x17, 0x93, 0xde, 0x9d, 0xbc, 0xc0, 0x2e, 0x0e, 0x09, 0x1e,
-  0xe4, 0xc6, 0x8b, 0x79, 0x71, 0xab, 0x4b, 0x04, 0x4a, 0x8c, 0xf0, 0x0b, 0xb0, 0x41, 0x13, 0x85,
-  0x7c, 0x2b, 0x05, 0x32, 0x9a, 0x8b, 0x2d, 0xff, 0xc5, 0x07, 0x9a, 0x15, 0x7f, 0x81, 0x23, 0x8a,
-  0x45, 0x5e, 0xba, 0x87, 0x30, 0x02, 0xc1, 0x62, 0xaf, 0x63, 0x1f, 0x86, 0xd1, 0x09, 0xdb, 0x59,
-  0xc8, 0xf2, 0x2c, 0x4b, 0x6d, 0x3d, 0x91, 0x5a, 0x67, 0x8c, 0xbf, 0x6f, 0x83, 0x17, 0x1e, 0x86,
-  0x84, 0xc8, 0xfc, 0xde, 0x55, 0xc7, 0xec, 0xce, 0x93, 0x2c, 0xae, 0xc2, 0xa7, 0x85, 0x3d, 0x26,
-  0xdc, 0x7b, 0xa8, 0x94, 0x1c, 0x6f, 0xb8, 0xef, 0xe2, 0x7d, 0x73, 0x54, 0x9c, 0xd5, 0x4e, 0xb6,
-  0x4a, 0x18, 0x8b, 0x79, 0x0a, 0xc8, 0x54, 0x72, 0xf4, 0x8f, 0x74, 0xda, 0xb8, 0xa6, 0xe6, 0xa8,
-  0xd3, 0x6f, 0x4d, 0x05, 0xef, 0x6e, 0xc4, 0x92, 0x3e, 0x97, 0x3d, 0x1d, 0xed, 0x8a, 0x0a, 0x22,
-  0x4d, 0xc5, 0xf4, 0x39, 0x78, 0xa6, 0x79, 0xec, 0x99, 0x59, 0x4e, 0xd0, 0xbf, 0x00, 0x7a, 0xec,
-  0x07, 0x88, 0xcd, 0x64, 0xff, 0x79, 0xad, 0x54, 0xed, 0xb0, 0xc5, 0x60, 0xaa, 0x08, 0x32, 0xda,
-  0x57, 0xbd, 0x97, 0xee, 0xb4, 0xf6, 0x1d, 0x97, 0xd6, 0xfe, 0xe3, 0x47, 0x02, 0xe9, 0xba, 0x3a,
-  0xb5, 0xcb, 0x29, 0xe8, 0x0b, 0x20, 0x41, 0x9d, 0x19, 0x00, 0xe0, 0xb0, 0x9d, 0x6c, 0xaa, 0xb8,
-  0x39, 0x32, 0x57, 0x2d, 0xd5, 0xfa, 0x3a, 0x57, 0xf1, 0xe0, 0x5e, 0xa1, 0x8e, 0xcf, 0xdc, 0xab,
-  0x1b, 0xa6, 0xbb, 0x4a, 0xa0, 0x5f, 0xa0, 0x3c, 0xbe, 0x07, 0x47, 0xc9, 0xdf, 0x5f, 0x2b, 0xe3,
-  0x6d, 0x01, 0xc0, 0x86, 0x03, 0x7f, 0x8a, 0xb7, 0x69, 0xa7, 0xdd, 0xad, 0x66, 0x1e, 0xe7, 0xf7,
-  0xd5, 0x8e, 0xad, 0xc2, 0xd9, 0x75, 0xd6, 0x28, 0x5c, 0xb6, 0x95, 0xb5, 0xfb, 0x70, 0xa1, 0x71,
-  0x09, 0xea, 0x97, 0x87, 0x51, 0x93, 0x46, 0x89, 0xdb, 0x95, 0x13, 0x52, 0x74, 0x9c, 0x5b, 0x17,
-  0x17, 0x5f, 0x4b, 0x65, 0x09, 0x54, 0x74, 0xa6, 0x10, 0x6a, 0x11, 0x32, 0x37, 0x0a, 0x98, 0x79,
-  0x4d, 0xf3, 0x0d, 0xaf, 0xa1, 0xbf, 0xd4, 0x71, 0x44, 0xc2, 0x63, 0xf5, 0xf2, 0x72, 0xb1, 0xc8,
-  0x89, 0x28, 0xde, 0x2f, 0x00, 0xac, 0xa9, 0x88, 0x31, 0x51, 0xf9, 0x10, 0xf6, 0x9c, 0x98, 0x5f,
-  0x6b, 0x1d, 0x41, 0x10, 0x23, 0x64, 0xd8, 0x07, 0x19, 0x66, 0x8a, 0x54, 0xa7, 0xea, 0x57, 0x79,
-  0x26, 0xc6, 0xdb, 0x8f, 0x1f, 0x1e, 0x8f, 0x8f, 0xd2, 0x61, 0x89, 0xdd, 0x57, 0x34, 0xcc, 0xeb,
-  0x07, 0xfc, 0xa8, 0x0a, 0x5d, 0xe5, 0x14, 0x25, 0xc0, 0x20, 0xc7, 0xcb, 0x48, 0xd3, 0x01, 0x4c,
-  0x25, 0xfc, 0x13, 0xe9, 0xbd, 0x7c, 0x7b, 0xca, 0x61, 0xca, 0x9c, 0x35, 0xb7, 0x4d, 0x34, 0xcb,
-  0xc3, 0x9f, 0x96, 0x72, 0xe0, 0xf9, 0x99, 0xa1, 0x59, 0x6e, 0x30, 0xb2, 0xe0, 0x61, 0x91, 0x66,
-  0xc7, 0xcd, 0x57, 0xfb, 0x68, 0x1a, 0x76, 0x31, 0x4d, 0x31, 0x0a, 0x52, 0xf6, 0xd1, 0x05, 0x40,
-  0xab, 0xa1, 0x26, 0xca, 0x81, 0x56, 0x79, 0x02, 0x1c, 0xc7, 0x5b, 0xe0, 0xc1, 0xf7, 0xde, 0xa7,
-  0x70, 0xa5, 0xd1, 0x14, 0x86, 0xa5, 0x22, 0x4c, 0x45, 0x55, 0xa3, 0x97, 0xb7, 0xb3, 0x8c, 0xba,
-  0xf0, 0x40, 0xb0, 0x6c, 0x6a, 0x87, 0x22, 0xa6, 0x40, 0xa3, 0xdf, 0x81, 0xc7, 0x59, 0x2b, 0x91,
-  0x33, 0x19, 0xa5, 0x9c, 0x99, 0x79, 0x9e, 0x7b, 0x13, 0x69, 0x36, 0x09, 0xd2, 0x5c, 0xf4, 0x45,
-  0x4d, 0x6a, 0x05, 0x73, 0x74, 0xbd, 0xcb, 0xea, 0xc3, 0x10, 0x9b, 0xe9, 0x3a, 0xda, 0x84, 0x33,
-  0x7c, 0x66, 0x10, 0x3d, 0x75, 0x7a, 0x98, 0x22, 0x53, 0x52, 0xcd, 0x07, 0xb8, 0xbe, 0x9e, 0xeb,
-  0x6b, 0x85, 0x15, 0x9d, 0x32, 0x0b, 0xfc, 0x6d, 0x7e, 0x1b, 0x2c, 0xde, 0x1f, 0x0d, 0x8e, 0x2a,
-  0x89, 0x79, 0x23, 0xf5, 0x26, 0xe5, 0x9c, 0x10, 0x12, 0xb6, 0x19, 0x4e, 0xc9, 0x40, 0x88, 0x87,
-  0xe1, 0xd5, 0x89, 0xe5, 0x99, 0xcf, 0xaa, 0xcb, 0xd0, 0x03, 0x6b, 0x1c, 0x80, 0xda, 0xc0, 0xe5,
-  0x9c, 0x8c, 0xda, 0xa5, 0xb4, 0x9f, 0x8a, 0x77, 0xe0, 0x39, 0xc8, 0xe5, 0x21, 0x0e, 0x61, 0x3c,
-  0xd5, 0x8f, 0x51, 0x85, 0x22, 0x53, 0xd5, 0x85, 0xa7, 0xfb, 0x65, 0xcd, 0x55, 0xef, 0xc7, 0xb0,
-  0xe9, 0xa8, 0x0e, 0xb5, 0x67, 0x55, 0x35, 0x3b, 0xd8, 0x84, 0x1f, 0x97, 0x1d, 0x2a, 0x32, 0x1e,
-  0x14, 0x66, 0x57, 0x12, 0x8a, 0x6e, 0x94, 0x57, 0xf3, 0xd4, 0x56, 0xf3, 0x1c, 0x7a, 0xf6, 0x43,
-  0x39, 0xea, 0xab, 0x39, 0xde, 0x39, 0x0f, 0xe6, 0x40, 0xba, 0x56, 0xdb, 0x43, 0xcf, 0xef, 0xc9,
-  0x5a, 0xf6, 0xe7, 0x55, 0xd0, 0x7e, 0x11, 0x5c, 0x9a, 0x06, 0xb5, 0x92, 0x8c, 0x7f, 0x76, 0x8d,
-  0x73, 0xdc, 0x96, 0x4b, 0x0f, 0x28, 0x06, 0x2d, 0xff, 0x1b, 0x00, 0xda, 0xd3, 0xb4, 0x2b, 0x8c,
-  0xab, 0x42, 0x46, 0xd6, 0xfe, 0x41, 0x82, 0x41, 0xc8, 0xfe, 0x99, 0xe4, 0xd6, 0xff, 0x41, 0x72,
-  0xc7, 0xce, 0x7f, 0x21, 0xb9, 0xc2, 0xb7, 0xc9, 0x29, 0x50, 0x4a, 0x89, 0x65, 0x82, 0xab, 0x99,
-  0xd3, 0x22, 0xe5, 0x2a, 0x78, 0x9b, 0x5a, 0x3f, 0x0b, 0x67, 0x5a, 0x83, 0x25, 0x4c, 0xb2, 0x09,
-  0x54, 0x67, 0x50, 0x38, 0x2a, 0xec, 0x7b, 0xd4, 0x31, 0x8e, 0xbc, 0xd4, 0xf3, 0x5a, 0x76, 0xb7,
-  0x12, 0x87, 0x75, 0x2e, 0xf6, 0x8e, 0x09, 0x6f, 0xd5, 0x2e, 0xf0, 0x6a, 0xd1, 0xf6, 0xda, 0xd4,
-  0xd6, 0x88, 0x10, 0x23, 0xc5, 0x1f, 0x20, 0x7e, 0x36, 0xd1, 0xed, 0x40, 0x38, 0x32, 0x48, 0x26,
-  0x75, 0x07, 0x6c, 0xbb, 0x2d, 0xe8, 0x15, 0x01, 0xdb, 0x31, 0x6b, 0x59, 0x30, 0xaf, 0x0b, 0x0a,
-  0x38, 0x83, 0x18, 0x1a, 0x9c, 0xa2, 0x3c, 0xc0, 0xdc, 0xc4, 0xc8, 0x00, 0x8a, 0xe4, 0xe0, 0x68,
-  0x64, 0x05, 0xe4, 0x05, 0xd3, 0x2b, 0xe7, 0x24, 0x0e, 0xad, 0x11, 0xb1, 0x43, 0xdf, 0x7b, 0x49,
-  0xfc, 0x31, 0xfe, 0x2e, 0xc7, 0x52, 0xee, 0x4a, 0xdd, 0x50, 0xdb, 0x5c, 0x81, 0x06, 0x78, 0x24,
-  0xf0, 0x01, 0x3c, 0xfe, 0x4b, 0x0f, 0x42, 0x69, 0xbd, 0x23, 0xd1, 0x68, 0xcf, 0x8a, 0x9c, 0x3e,
-  0xa8, 0x7d, 0x12, 0x82, 0x65, 0x52, 0xe6, 0x50, 0x9b, 0x17, 0xb1, 0x75, 0x7a, 0xb4, 0x51, 0x7e,
-  0x60, 0xf5, 0x9d, 0x78, 0xd6, 0xae, 0x42, 0x77, 0xfb, 0x99, 0x5c, 0x8a, 0xab, 0x85, 0x6a, 0xc7,
-  0xcf, 0x9b, 0x10, 0xab, 0x14, 0x3d, 0x1f, 0x80, 0xcd, 0x46, 0x97, 0xbc, 0xdc, 0x2f, 0xe3, 0x4b,
-  0x95, 0xbd, 0x4c, 0xe8, 0x4b, 0x0d, 0x5f, 0xa0, 0x1c, 0xea, 0x15, 0x98, 0xa4, 0x44, 0x3d, 0x82,
-  0x52, 0x5c, 0x2a, 0x71, 0x9d, 0x8f, 0x57, 0xa7, 0xf8, 0xe2, 0x37, 0x8b, 0xee, 0xe9, 0xf3, 0x27,
-  0x7b, 0xeb, 0xb8, 0x89, 0xec, 0xe9, 0x05, 0xfd, 0x94, 0xcb, 0x9e, 0xc4, 0x4b, 0xb8, 0xf0, 0x4f,
-  0x45, 0xfb, 0x59, 0xe2, 0x2a, 0xd1, 0x2b, 0xab, 0x96, 0x3d, 0x08, 0xa8, 0x8e, 0x57, 0xcc, 0x8f,
-  0xdc, 0x4a, 0x38, 0x97, 0x22, 0x67, 0xe2, 0xbe, 0x4c, 0xe6, 0x24, 0x9e, 0x4b, 0xc0, 0xaf, 0x78,
-  0x40, 0x97, 0xf5, 0x05, 0xb0, 0x47, 0x95, 0xe5, 0x7c, 0xd9, 0x37, 0x1c, 0x9c, 0xdc, 0x07, 0x6e,
-  0xd0, 0xd0, 0x21, 0x00, 0x89, 0xa6, 0x01, 0x83, 0x10, 0x33, 0xf1, 0x1b, 0x4c, 0xf8, 0x5b, 0x36,
-  0x4c, 0x6c, 0xcb, 0xee, 0x03, 0xb1, 0xa0, 0x5d, 0x1c, 0x0b, 0xf2, 0x71, 0x51, 0x38, 0x56, 0x20,
-  0x39, 0xd8, 0x61, 0x7d, 0x2b, 0x2e, 0x1d, 0x13, 0x07, 0x45, 0x31, 0x8a, 0x14, 0x23, 0x13, 0x43,
-  0xbe, 0xe0, 0xb2, 0x93, 0x47, 0xfc, 0x16, 0x5c, 0xea, 0x63, 0x2e, 0x96, 0x3a, 0x9d, 0xf7, 0xe0,
-  0xe2, 0xc7, 0x1c, 0x20, 0x59, 0x2e, 0xd5, 0x6b, 0xcf, 0x15, 0xa5, 0x56, 0x6b, 0xac, 0x13, 0xb5,
-  0xdb, 0x6d, 0x82, 0xaa, 0x68, 0xb6, 0xb4, 0x04, 0xbc, 0x45, 0xa1, 0xb5, 0x04, 0xda, 0x6a, 0x3c,
-  0x57, 0xea, 0x00, 0xc3, 0x77, 0xfe, 0x0b, 0x3b, 0x3f, 0x5b, 0x1f, 0x92, 0x59, 0x7f, 0x1e, 0x5c,
-  0x56, 0xf0, 0xc4, 0x55, 0xfa, 0x0e, 0x71, 0xeb, 0x32, 0xa4, 0x46, 0x21, 0x6a, 0x27, 0x00, 0x21,
-  0xfc, 0x53, 0x84, 0xf9, 0x4f, 0x91, 0x63, 0x94, 0x5b, 0xd6, 0xe6, 0xd0, 0x8f, 0xd9, 0xf6, 0x97,
-  0x5b, 0x13, 0x1d, 0xeb, 0x4a, 0xb2, 0xdc, 0x7a, 0x72, 0xfc, 0xbc, 0xa6, 0x2d, 0xe1, 0xcc, 0x00,
-  0xa7, 0xf6, 0x08, 0xce, 0x1d, 0xe0, 0xd4, 0x97, 0x71, 0x56, 0x9d, 0xac, 0x6c, 0x04, 0xa7, 0xce,
-  0x13, 0x17, 0x0a, 0xe5, 0xf9, 0x28, 0xf4, 0xc7, 0xdc, 0x6f, 0xcd, 0x62, 0x71, 0xa7, 0x51, 0x28,
-  0x2e, 0x62, 0xa6, 0x99, 0x92, 0x20, 0x83, 0xfd, 0xea, 0x49, 0xa4, 0xe4, 0xfb, 0x53, 0xa3, 0xbf,
-  0xcb, 0xc4, 0xc5, 0xad, 0x6b, 0xbc, 0x48, 0xd0, 0x9f, 0xd1, 0x89, 0x24, 0x9d, 0x5d, 0x32, 0x86,
-  0xb3, 0x12, 0x22, 0x61, 0x7d, 0x3d, 0x8d, 0x5b, 0xf2, 0x92, 0x80, 0x04, 0xbe, 0x22, 0xb7, 0x29,
-  0xaa, 0xce, 0x8f, 0x22, 0x03, 0x30, 0x13, 0x78, 0x65, 0x0b, 0xd6, 0x8a, 0x70, 0xcd, 0x7b, 0x2b,
-  0x18, 0xb2, 0x0a, 0x32, 0x85, 0xdd, 0x43, 0x42, 0xb5, 0xb5, 0x59, 0xad, 0xb6, 0xb6, 0x0c, 0x55,
-  0x6d, 0xff, 0x99, 0x94, 0xd3, 0x1f, 0x6f, 0x59, 0x24, 0x0a, 0x86, 0x3d, 0x30, 0x8e, 0x8a, 0x2e,
-  0x58, 0xa8, 0x85, 0xbf, 0x94, 0xc2, 0x97, 0x0b, 0x58, 0x64, 0x36, 0xb6, 0x02, 0x39, 0xbd, 0x26,
-  0x82, 0x03, 0x23, 0xb9, 0x9d, 0xb9, 0x5b, 0x84, 0x4f, 0x2f, 0xb4, 0x25, 0x59, 0x5c, 0xf4, 0x3c,
-  0xf1, 0x82, 0xeb, 0x21, 0xbd, 0xe7, 0x99, 0x26, 0xfd, 0xcd, 0xd0, 0xab, 0xcd, 0x96, 0x5e, 0xad,
-  0xf4, 0x26, 0xd0, 0x93, 0x0c, 0xc6, 0xe7, 0xe8, 0x30, 0xa6, 0xd3, 0x96, 0x4a, 0x12, 0x51, 0xe0,
-  0x53, 0x4a, 0xe4, 0x97, 0x3e, 0x46, 0x95, 0xef, 0xd1, 0xb8, 0x22, 0xe7, 0x6f, 0xd7, 0x92, 0x32,
-  0x2d, 0xab, 0xf0, 0x5f, 0x1f, 0xa6, 0xd7, 0x1a, 0xe3, 0x0c, 0x26, 0x9d, 0xda, 0x95, 0x7c, 0xcf,
-  0xf5, 0x2d, 0x3b, 0x77, 0x29, 0x85, 0xf8, 0x6d, 0x4d, 0x3a, 0x03, 0x0a, 0x48, 0x5d, 0x09, 0x38,
-  0x44, 0x7f, 0xc2, 0xf8, 0xff, 0x03, 0xd9, 0x28, 0x95, 0x13, 0xda, 0x78, 0x00, 0x00
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x7d, 0xdb, 0x76, 0xdb, 0x38,
+  0xb6, 0xe0, 0xbb, 0xbf, 0x02, 0x41, 0xa5, 0x6d, 0xd2, 0xa2, 0x28, 0xea, 0x6a, 0x47, 0x32, 0x95,
+  0x96, 0x1d, 0x27, 0x71, 0xae, 0xae, 0xd8, 0x4e, 0x52, 0x71, 0x7b, 0xb5, 0x21, 0x12, 0x92, 0x18,
+  0x53, 0x04, 0x8b, 0x84, 0x6e, 0x56, 0xf4, 0x07, 0xe7, 0x69, 0xd6, 0x3c, 0xcc, 0xdb, 0x79, 0x9e,
+  0x35, 0xff, 0x30, 0x0f, 0xf3, 0x29, 0xf3, 0x05, 0xe7, 0x13, 0x66, 0x6d, 0x00, 0xa4, 0x48, 0x49,
+  0xbe, 0xa4, 0xba, 0xe6, 0xac, 0x53, 0x5d, 0x5d, 0x65, 0x62, 0x63, 0x03, 0xd8, 0xd8, 0xd8, 0xd8,
+  0x17, 0xdc, 0x84, 0x0e, 0x9e, 0xbc, 0xf8, 0x78, 0x74, 0xfe, 0xdb, 0xe9, 0x31, 0x1a, 0xf0, 0xa1,
+  0xdf, 0x46, 0x07, 0xc9, 0x1f, 0x4a, 0xdc, 0x36, 0x3a, 0x18, 0x52, 0x4e, 0x90, 0x33, 0x20, 0x51,
+  0x4c, 0xb9, 0x8d, 0x47, 0xbc, 0x57, 0xdc, 0xc7, 0x29, 0x98, 0x05, 0x9c, 0x06, 0xdc, 0xc6, 0x33,
+  0x1a, 0x63, 0xb4, 0x15, 0x90, 0x21, 0xb5, 0x31, 0x09, 0x43, 0x9f, 0x16, 0x87, 0xac, 0xeb, 0xf9,
+  0xb4, 0x38, 0xa1, 0xdd, 0x22, 0x09, 0xc3, 0xa2, 0x43, 0x42, 0xd2, 0xf5, 0x69, 0x5a, 0x72, 0x2b,
+  0x2d, 0x3a, 0xf1, 0x5c, 0x3e, 0xb0, 0x5d, 0x3a, 0xf6, 0x1c, 0x5a, 0x14, 0x09, 0xc3, 0x0b, 0x3c,
+  0xee, 0x11, 0xbf, 0x18, 0x3b, 0xc4, 0xa7, 0x76, 0x19, 0x23, 0x59, 0xf1, 0xd8, 0xa3, 0x93, 0x90,
+  0x45, 0x7c, 0x59, 0x89, 0x6a, 0x70, 0xc4, 0x07, 0x2c, 0xc2, 0x4b, 0x6a, 0xde, 0x33, 0x16, 0xbc,
+  0x67, 0xee, 0xc8, 0xa7, 0x31, 0x22, 0x81, 0x8b, 0x3c, 0x1e, 0x8b, 0xcc, 0xc8, 0xeb, 0x8e, 0x38,
+  0x8b, 0x62, 0xa8, 0xc0, 0xf7, 0x82, 0x1b, 0x14, 0x51, 0xdf, 0xc6, 0x9e, 0xc3, 0x02, 0x8c, 0xb6,
+  0x06, 0x11, 0xed, 0xd9, 0xd8, 0x25, 0x9c, 0x34, 0xbd, 0x21, 0xe9, 0xd3, 0x52, 0x18, 0xf4, 0x5b,
+  0x5d, 0x12, 0xd3, 0x46, 0xcd, 0xf0, 0x3e, 0x1f, 0x7e, 0xfc, 0x34, 0xb1, 0xde, 0xbe, 0xea, 0xb3,
+  0x4e, 0xa7, 0xd3, 0xf9, 0x70, 0x76, 0x31, 0x38, 0xbe, 0xe8, 0x77, 0x3a, 0x9d, 0x43, 0x48, 0x76,
+  0x7e, 0x3d, 0xea, 0xfc, 0x06, 0x7f, 0x7b, 0xfb, 0xa5, 0x67, 0x03, 0x01, 0xf9, 0xfa, 0xe1, 0xec,
+  0x93, 0x75, 0xd2, 0x89, 0xe2, 0x9a, 0xd3, 0xf8, 0xb5, 0xd3, 0xe9, 0x1c, 0x7f, 0xf2, 0xbf, 0x1c,
+  0xfb, 0xc3, 0xf3, 0x0b, 0xab, 0xf3, 0x16, 0xca, 0x75, 0xfa, 0x9d, 0xce, 0x6f, 0x6e, 0xd8, 0xe9,
+  0x40, 0xa6, 0xac, 0xe5, 0x95, 0x80, 0x77, 0x3a, 0x9d, 0x06, 0xa4, 0xdf, 0x2b, 0xf8, 0x71, 0xa7,
+  0xf3, 0xb6, 0x73, 0x94, 0xc5, 0x3b, 0x7e, 0xdb, 0x79, 0x91, 0x4b, 0xcb, 0x52, 0xd6, 0xe7, 0xaf,
+  0xaf, 0x67, 0x00, 0xab, 0x1c, 0xfb, 0xc7, 0xbf, 0x7e, 0xfe, 0xb5, 0x76, 0xfc, 0xdb, 0xe7, 0xb3,
+  0xf3, 0x0b, 0xde, 0xbd, 0xf8, 0xd4, 0x79, 0xb6, 0x3f, 0x7d, 0x7b, 0xee, 0xbf, 0x3a, 0xbc, 0xb8,
+  0x3d, 0xfe, 0xf6, 0xf6, 0xe5, 0xc5, 0xeb, 0x43, 0xdf, 0xf9, 0xec, 0xbd, 0x3c, 0x74, 0xcf, 0x8e,
+  0xfc, 0x37, 0xe4, 0xec, 0xe6, 0x4d, 0xf5, 0x2b, 0x8d, 0x8e, 0xf8, 0xf9, 0xf8, 0xeb, 0xa7, 0xcf,
+  0xb3, 0x37, 0xb5, 0xce, 0x3e, 0x7b, 0xc7, 0xa7, 0xe5, 0x60, 0xd6, 0xe1, 0xdd, 0x1b, 0xf6, 0x35,
+  0xfa, 0x72, 0xe4, 0x33, 0xd7, 0xfa, 0xfd, 0xe5, 0xc9, 0x57, 0x32, 0xf8, 0xf4, 0xaa, 0xfb, 0xe5,
+  0xd5, 0x07, 0x7a, 0xf6, 0xa1, 0x6e, 0xd5, 0xa3, 0xfa, 0xe9, 0x69, 0xed, 0xe4, 0xc5, 0xde, 0xb3,
+  0xf2, 0x6d, 0xbd, 0x3e, 0xb9, 0x75, 0xf7, 0x06, 0xd5, 0xa3, 0xc3, 0xca, 0xd1, 0xac, 0x74, 0xe3,
+  0x54, 0xc6, 0xe7, 0x47, 0xd6, 0x8b, 0xd7, 0x85, 0xb3, 0xc3, 0x8f, 0x7e, 0xb7, 0xea, 0xbe, 0x69,
+  0x7c, 0x21, 0x67, 0xbd, 0xdb, 0xe9, 0x29, 0xab, 0xfb, 0x8d, 0xa3, 0x5a, 0xfc, 0x75, 0x42, 0xfb,
+  0xb7, 0xa7, 0x1f, 0x8f, 0x9d, 0x17, 0x43, 0xcb, 0xb3, 0x3e, 0x7b, 0x83, 0xe9, 0xed, 0xe8, 0xeb,
+  0x85, 0x53, 0x28, 0x77, 0x82, 0xdb, 0xc9, 0x7b, 0xf6, 0xb1, 0xb4, 0x7f, 0xb1, 0xdf, 0x3f, 0x3d,
+  0x19, 0xbe, 0xed, 0xc4, 0xb7, 0xb5, 0xef, 0x7c, 0xef, 0xcb, 0xfb, 0x69, 0xf4, 0xec, 0xe2, 0xf4,
+  0xc3, 0xad, 0xdf, 0x2f, 0xbd, 0xff, 0xc2, 0xca, 0x63, 0xf7, 0xc5, 0x59, 0xf4, 0x6b, 0x67, 0x14,
+  0xbd, 0x19, 0xbc, 0x39, 0x3c, 0xdc, 0x9b, 0xf5, 0x6e, 0xad, 0xe8, 0x5d, 0xaf, 0x5a, 0x73, 0xbf,
+  0xc6, 0xe7, 0xa7, 0x6f, 0xbf, 0xff, 0x36, 0xfc, 0xb6, 0xf7, 0xb6, 0x53, 0xdb, 0x1b, 0x9c, 0xcd,
+  0xf6, 0xdf, 0x15, 0xba, 0xfd, 0xaf, 0xcf, 0x2a, 0x67, 0x67, 0xaf, 0x3e, 0xed, 0x85, 0xdd, 0x8b,
+  0xa1, 0xd7, 0x79, 0x73, 0x13, 0x7f, 0x7e, 0xe3, 0xbc, 0xff, 0xf8, 0xea, 0xc5, 0xcd, 0xe0, 0xfb,
+  0x69, 0x70, 0x33, 0xea, 0xd4, 0x47, 0x1f, 0x5e, 0xbe, 0xe8, 0x15, 0x2a, 0x27, 0x85, 0xe9, 0xb7,
+  0xe8, 0x7c, 0xf2, 0xfb, 0xef, 0x9f, 0xfa, 0xd5, 0x37, 0x85, 0xe3, 0xea, 0x71, 0xef, 0xe8, 0xf4,
+  0xfd, 0xc9, 0x24, 0xf4, 0xce, 0xbf, 0x15, 0xce, 0x27, 0x5f, 0x06, 0x5f, 0x9d, 0xee, 0x60, 0x48,
+  0x86, 0xb7, 0xbf, 0xbd, 0xed, 0x4e, 0xbe, 0xbd, 0xf8, 0xdd, 0x7d, 0xd5, 0xa8, 0xec, 0x75, 0x3a,
+  0xfb, 0x9f, 0xa7, 0xc7, 0x9d, 0xb3, 0xf1, 0x79, 0xbf, 0x74, 0x6e, 0x45, 0x6f, 0x9d, 0xb7, 0xdf,
+  0xce, 0xba, 0x03, 0xc2, 0xf7, 0xc3, 0x0f, 0x41, 0xaf, 0x73, 0x5a, 0x2e, 0x95, 0x27, 0xdd, 0x6f,
+  0x85, 0x59, 0xa1, 0x71, 0xd8, 0xd8, 0xfb, 0x1e, 0xdc, 0xee, 0x0d, 0x8e, 0xac, 0xc0, 0x3f, 0xa9,
+  0x3d, 0x1b, 0x07, 0x7b, 0x83, 0xea, 0x6f, 0xfc, 0xe3, 0xd9, 0xb7, 0xc2, 0xa7, 0x46, 0x64, 0x0d,
+  0x67, 0x56, 0x23, 0x3c, 0xee, 0xbf, 0x8b, 0x4a, 0xa3, 0x4f, 0x5d, 0xfe, 0x2c, 0x3c, 0xda, 0xef,
+  0x7f, 0x3d, 0x7c, 0x79, 0x3c, 0xb3, 0x42, 0xeb, 0xc5, 0xc7, 0x6f, 0xe5, 0xf8, 0xd3, 0x97, 0x9b,
+  0x59, 0xe7, 0xd0, 0x8b, 0xcf, 0x5e, 0x55, 0x3b, 0xfb, 0x6f, 0xf6, 0xde, 0xbc, 0x0c, 0x6f, 0x9d,
+  0x77, 0xd1, 0x97, 0xe9, 0xeb, 0xef, 0xc4, 0x22, 0x33, 0x87, 0xf8, 0x67, 0xd1, 0x6b, 0xe6, 0xf7,
+  0x5f, 0x04, 0x93, 0xf3, 0xbd, 0xc2, 0x97, 0xde, 0x6c, 0xf4, 0xfe, 0xcb, 0xb7, 0x6f, 0xa5, 0xa9,
+  0xf3, 0xac, 0x4e, 0xfa, 0xb5, 0xf7, 0x47, 0xe7, 0xdf, 0x2e, 0x0a, 0x9f, 0x4a, 0x1f, 0xab, 0x47,
+  0x5e, 0x3f, 0xfc, 0xf5, 0xf6, 0xcb, 0xc9, 0x20, 0xaa, 0xbc, 0xfc, 0xf4, 0xf6, 0xdd, 0x6b, 0xef,
+  0xcd, 0xf8, 0xc3, 0x5b, 0xff, 0xdd, 0x9b, 0xc3, 0x4f, 0x43, 0x5a, 0x6b, 0x0c, 0xbe, 0xed, 0xff,
+  0x56, 0xad, 0xee, 0x53, 0xef, 0xfb, 0x4d, 0xf9, 0x4b, 0xfd, 0xe6, 0xf6, 0x75, 0xd8, 0xdd, 0xe7,
+  0x37, 0xaf, 0x3a, 0xa3, 0xa3, 0xcf, 0x93, 0xaf, 0xa7, 0xb4, 0x16, 0xf6, 0x8f, 0xce, 0x9c, 0xe9,
+  0x59, 0xc7, 0x9f, 0xd0, 0x97, 0xa7, 0x8d, 0xc2, 0x51, 0x2f, 0xfa, 0x5c, 0xfa, 0x58, 0xff, 0xf2,
+  0xfa, 0x6d, 0xb5, 0x76, 0x5b, 0xaa, 0x5b, 0xe4, 0xc4, 0x19, 0xfc, 0xfa, 0xfa, 0xb0, 0x2e, 0x45,
+  0xf3, 0xcd, 0xa7, 0x8b, 0xfa, 0x71, 0x74, 0xf3, 0xa6, 0xdf, 0xef, 0xdb, 0x36, 0x6e, 0x6f, 0xa1,
+  0x83, 0xd8, 0x89, 0xbc, 0x90, 0xb7, 0x4b, 0x25, 0xf4, 0x77, 0xdf, 0x73, 0x68, 0x10, 0x53, 0x84,
+  0xd0, 0xab, 0x0f, 0x17, 0xe8, 0xd5, 0xf1, 0x87, 0xe3, 0x4f, 0x9d, 0x77, 0xe8, 0xf4, 0xe2, 0xf0,
+  0xdd, 0xc9, 0x11, 0x7a, 0x77, 0x72, 0x74, 0xfc, 0xe1, 0xec, 0x18, 0x7d, 0xa6, 0x51, 0xec, 0xb1,
+  0x00, 0x55, 0x0d, 0x54, 0x79, 0x86, 0xde, 0x8c, 0x02, 0x8a, 0x2a, 0x96, 0xb5, 0xb7, 0x95, 0xaf,
+  0xe0, 0x25, 0x8b, 0x50, 0xc0, 0x02, 0xf4, 0xea, 0xf4, 0x5d, 0x71, 0x5c, 0x45, 0xa3, 0x98, 0xf4,
+  0xa9, 0x81, 0x1c, 0x36, 0x1c, 0xd2, 0xc8, 0xf1, 0x88, 0x8f, 0x14, 0x6a, 0x8c, 0x86, 0xa3, 0x98,
+  0xa3, 0x2e, 0x45, 0xe1, 0x28, 0x72, 0x06, 0x24, 0xa6, 0xae, 0x89, 0x8e, 0x58, 0xc0, 0x89, 0xc3,
+  0xd1, 0x90, 0xb1, 0x60, 0x28, 0x15, 0xc6, 0xdf, 0x3d, 0xc7, 0x67, 0x23, 0xd7, 0x74, 0xd8, 0x70,
+  0xcb, 0xf1, 0x49, 0x1c, 0x0b, 0xa4, 0x88, 0xf9, 0x3e, 0x8d, 0xe6, 0x93, 0xd8, 0x0e, 0x46, 0xbe,
+  0xdf, 0x8a, 0x67, 0xf1, 0x49, 0xd0, 0x63, 0xf6, 0x7c, 0xd1, 0x52, 0xc5, 0x24, 0x9c, 0x0f, 0xe8,
+  0x90, 0xca, 0xcf, 0x21, 0xf1, 0x82, 0x0f, 0x64, 0x2c, 0x13, 0x2c, 0x78, 0xc7, 0x88, 0xab, 0xe9,
+  0x73, 0x97, 0x39, 0xa3, 0x21, 0x0d, 0xb8, 0xc9, 0x3d, 0xee, 0x53, 0x9b, 0x84, 0xe1, 0x07, 0x32,
+  0xa4, 0x9a, 0x5e, 0xc0, 0xff, 0xf1, 0xef, 0xff, 0xed, 0x7f, 0xa1, 0xee, 0x0c, 0x65, 0x75, 0xd7,
+  0x7f, 0xfc, 0xfb, 0xbf, 0xfd, 0x77, 0x6c, 0x4c, 0xbc, 0xc0, 0x65, 0x13, 0xd3, 0x67, 0x0e, 0xe1,
+  0x1e, 0x0b, 0x4c, 0x50, 0x54, 0xa6, 0x17, 0x38, 0xfe, 0xc8, 0xa5, 0xb1, 0x86, 0xcb, 0x95, 0x3d,
+  0xd3, 0x32, 0x2d, 0xb3, 0x8c, 0xf5, 0xe7, 0x7c, 0xe0, 0xc5, 0x66, 0x8f, 0x72, 0x67, 0xf0, 0x9e,
+  0xb9, 0xd4, 0x7f, 0xc9, 0xa2, 0x77, 0xde, 0x98, 0x9e, 0xd1, 0x68, 0x4c, 0x23, 0x4d, 0x6f, 0x8a,
+  0xec, 0x21, 0xb9, 0xa1, 0x5f, 0xce, 0x34, 0xdd, 0x90, 0xa9, 0x84, 0x7c, 0x3a, 0x41, 0xaa, 0x59,
+  0x99, 0xa1, 0xba, 0x42, 0x27, 0xe8, 0x1c, 0xbe, 0x32, 0x40, 0xd3, 0x89, 0x28, 0xe1, 0xf4, 0xf5,
+  0xf9, 0xfb, 0x77, 0x49, 0x2d, 0x12, 0xde, 0xa7, 0x5c, 0xe0, 0xa6, 0x75, 0x27, 0x2c, 0x80, 0xba,
+  0xe5, 0xb7, 0x96, 0x6d, 0x14, 0xfe, 0x52, 0x3f, 0x8f, 0x9c, 0xaf, 0x7c, 0x14, 0xd3, 0xe8, 0xe5,
+  0x28, 0x38, 0xa3, 0x7c, 0x14, 0x6a, 0xfa, 0x82, 0xc4, 0xb3, 0xc0, 0x41, 0x77, 0xf6, 0x6f, 0xee,
+  0x53, 0x8e, 0xa8, 0x4d, 0x26, 0xc4, 0xe3, 0x9a, 0xf8, 0xaf, 0xc4, 0xd5, 0x70, 0x69, 0xe8, 0xc5,
+  0x4e, 0x49, 0x34, 0x67, 0x7e, 0x8f, 0x59, 0x80, 0x75, 0x5d, 0xfc, 0xd5, 0xf4, 0x16, 0x35, 0x63,
+  0x16, 0x71, 0x4d, 0xeb, 0x8d, 0x02, 0x07, 0xd8, 0xab, 0x51, 0x83, 0xeb, 0xf3, 0x88, 0xf2, 0x51,
+  0x14, 0xa0, 0xf7, 0x84, 0x0f, 0x4c, 0xd2, 0x8d, 0x35, 0x6a, 0x32, 0xbd, 0x98, 0xa6, 0xb8, 0xc9,
+  0xf4, 0x85, 0xae, 0xb7, 0x7a, 0x2c, 0xd2, 0xa0, 0x4d, 0x8e, 0x58, 0x0f, 0x51, 0x3d, 0xd7, 0x37,
+  0xe2, 0xba, 0x92, 0x9f, 0x1a, 0xd7, 0x5b, 0x02, 0xc9, 0x9e, 0x2b, 0xb1, 0x69, 0xce, 0x17, 0x8b,
+  0x16, 0x37, 0x55, 0xca, 0xec, 0x32, 0x12, 0xb9, 0x36, 0xa6, 0x71, 0x58, 0xad, 0x60, 0x63, 0x09,
+  0x0f, 0xa2, 0x8f, 0xbd, 0x53, 0x2f, 0x88, 0xed, 0x9a, 0x95, 0x81, 0x86, 0x5e, 0x70, 0x3e, 0x0b,
+  0x69, 0x6c, 0x5f, 0x5e, 0xa5, 0xed, 0x53, 0xdb, 0x6a, 0xd1, 0x83, 0xf5, 0x92, 0x2d, 0x5a, 0x28,
+  0xe8, 0xeb, 0x45, 0x2f, 0xe9, 0x95, 0x2d, 0xfa, 0x12, 0xb1, 0x51, 0xe0, 0x6a, 0xd5, 0x5d, 0x99,
+  0x20, 0x81, 0xcb, 0x86, 0x9a, 0xae, 0xb7, 0x44, 0x3f, 0x22, 0xea, 0x50, 0x6f, 0x4c, 0x5f, 0x10,
+  0x4e, 0x34, 0xae, 0x27, 0x42, 0x18, 0x53, 0x7e, 0x12, 0x70, 0x1a, 0x8d, 0x89, 0x9f, 0x61, 0x99,
+  0x3e, 0x77, 0xd2, 0x39, 0x92, 0x32, 0xa0, 0x4f, 0x03, 0x1a, 0x11, 0x2e, 0x6b, 0xd0, 0x17, 0xba,
+  0x51, 0xa6, 0xd5, 0x07, 0xeb, 0x91, 0xbd, 0xb9, 0xb4, 0x8c, 0xb2, 0x51, 0x31, 0xaa, 0x46, 0xed,
+  0xaa, 0xe5, 0xf5, 0x34, 0x7a, 0x69, 0xe5, 0x08, 0xce, 0x93, 0x6b, 0x58, 0xb6, 0x0d, 0x18, 0xb2,
+  0x30, 0xb7, 0xfb, 0x27, 0xae, 0x86, 0xa1, 0xf7, 0x92, 0xb1, 0x58, 0x87, 0x2a, 0xb8, 0x3e, 0x4f,
+  0x07, 0xcb, 0xb6, 0x5a, 0xfc, 0x20, 0x43, 0xf0, 0x1a, 0xd7, 0x78, 0xa1, 0xa0, 0xd3, 0x4b, 0x5e,
+  0xa8, 0xe7, 0x5a, 0xad, 0xd4, 0x1b, 0xab, 0x8c, 0xda, 0xd0, 0xeb, 0x30, 0xa2, 0xe0, 0xa6, 0x1c,
+  0x42, 0xd3, 0x1a, 0x37, 0xa8, 0xbe, 0x58, 0x50, 0x3f, 0xa6, 0xc8, 0xeb, 0x69, 0xe5, 0x84, 0x4e,
+  0xaf, 0xa7, 0x09, 0x22, 0x5f, 0x7a, 0x53, 0x3e, 0x8a, 0x68, 0x52, 0x06, 0xeb, 0x49, 0x17, 0x36,
+  0xd4, 0xdb, 0xf3, 0x02, 0xf7, 0x33, 0x89, 0xd2, 0x42, 0xd8, 0xc0, 0x69, 0x31, 0xd1, 0x41, 0xb3,
+  0xe7, 0xf9, 0x54, 0x9f, 0xd3, 0xcb, 0xf2, 0x95, 0x6d, 0x19, 0xf4, 0xb2, 0x22, 0xff, 0x54, 0xaf,
+  0x6c, 0x2b, 0x95, 0x13, 0x66, 0x5b, 0x2d, 0x76, 0x20, 0x51, 0x45, 0x77, 0xdf, 0x51, 0x37, 0x6e,
+  0x31, 0xd1, 0xdd, 0x5a, 0xa1, 0xba, 0xcb, 0xae, 0xec, 0xb5, 0x5e, 0x1a, 0x2a, 0xab, 0x50, 0xbe,
+  0x2f, 0xb3, 0xb2, 0x21, 0xb3, 0xa5, 0x66, 0xaf, 0x06, 0x4c, 0x58, 0x80, 0x00, 0x58, 0x96, 0xbe,
+  0x48, 0xd4, 0x0f, 0x70, 0x41, 0x08, 0xda, 0x24, 0xd6, 0xe5, 0x6c, 0x6b, 0xc9, 0xc1, 0xd7, 0xf0,
+  0x80, 0xf3, 0x30, 0x6e, 0x62, 0xdb, 0x5e, 0xd5, 0x7c, 0x61, 0xc4, 0x38, 0x73, 0x98, 0xff, 0x1c,
+  0x4f, 0xe2, 0x18, 0x37, 0xf1, 0x24, 0xc6, 0x7a, 0x01, 0x37, 0x4b, 0x25, 0x5c, 0x58, 0x53, 0x92,
+  0x2c, 0xe6, 0xe0, 0x1d, 0x16, 0x70, 0x69, 0x12, 0x63, 0x18, 0xa9, 0x98, 0xf9, 0xd4, 0xf4, 0x59,
+  0x5f, 0xc3, 0x92, 0x04, 0x34, 0x8a, 0x7c, 0x6c, 0x50, 0xa5, 0x7e, 0x26, 0x52, 0x05, 0x7e, 0xa1,
+  0xdd, 0x33, 0xe6, 0xdc, 0x50, 0xae, 0x2d, 0x33, 0xcc, 0xae, 0x17, 0x90, 0x68, 0x06, 0x53, 0xc7,
+  0xc6, 0x24, 0x8a, 0xc8, 0xac, 0x3b, 0xea, 0xf5, 0x68, 0x84, 0x53, 0x04, 0x16, 0x0c, 0x69, 0x0c,
+  0x86, 0xc7, 0xa6, 0x76, 0x1b, 0x3a, 0x46, 0x4d, 0xf0, 0x23, 0x91, 0x17, 0xc4, 0x9c, 0x04, 0x0e,
+  0x65, 0x3d, 0xd4, 0x81, 0x72, 0x87, 0xa2, 0x5c, 0x32, 0xca, 0xd0, 0xde, 0x85, 0x17, 0xf0, 0x7d,
+  0x91, 0xa7, 0xca, 0x88, 0xc1, 0xb4, 0x6c, 0x9b, 0xa7, 0x12, 0x4d, 0x37, 0x48, 0x34, 0xdd, 0xde,
+  0xce, 0x29, 0x9b, 0x9c, 0xd4, 0x81, 0x02, 0x93, 0x42, 0x97, 0x0c, 0x80, 0x4a, 0x27, 0xed, 0x0a,
+  0x4b, 0x15, 0xcd, 0xe6, 0xdc, 0x7e, 0x73, 0xf6, 0xf1, 0x83, 0x19, 0x82, 0x6b, 0x9f, 0x34, 0xbf,
+  0x70, 0x08, 0x68, 0x4c, 0xa6, 0xcf, 0x25, 0xa2, 0x91, 0x70, 0x8e, 0x46, 0x11, 0x8b, 0x52, 0xde,
+  0x81, 0xf2, 0x44, 0x02, 0x84, 0x0d, 0x66, 0x24, 0x65, 0xc5, 0x44, 0x13, 0xc2, 0xc8, 0x67, 0x21,
+  0xdd, 0xde, 0xbe, 0x84, 0x58, 0x60, 0xc8, 0x5c, 0x6c, 0x60, 0x20, 0x45, 0x7e, 0xc5, 0xb3, 0x18,
+  0x3e, 0xae, 0x96, 0x26, 0x4c, 0xa2, 0xeb, 0x49, 0x77, 0x9f, 0x94, 0x97, 0x02, 0x0b, 0x8a, 0x75,
+  0x83, 0xc9, 0x60, 0xa6, 0xe7, 0xda, 0x36, 0x37, 0x3d, 0x77, 0x7b, 0x5b, 0xa3, 0xf6, 0x13, 0x4b,
+  0x6f, 0xd1, 0xe7, 0xb9, 0x31, 0x86, 0x18, 0x06, 0x0a, 0xcb, 0x72, 0x88, 0xf8, 0x11, 0x25, 0xee,
+  0x0c, 0x25, 0x4a, 0xc9, 0xc5, 0x06, 0x4f, 0xec, 0xe1, 0x06, 0x85, 0x2d, 0xd9, 0x27, 0xc6, 0xc5,
+  0xf4, 0x62, 0x39, 0x3e, 0x5c, 0xcf, 0xb7, 0xe0, 0xd2, 0x31, 0x12, 0xd2, 0x80, 0x02, 0xc6, 0x11,
+  0x9d, 0x86, 0xd4, 0xc9, 0xd5, 0x9b, 0x57, 0xa0, 0x8b, 0x45, 0x46, 0x5a, 0x1c, 0x9f, 0xc5, 0x52,
+  0x56, 0x72, 0x35, 0x7e, 0x39, 0x43, 0x22, 0x47, 0xc4, 0x2c, 0x11, 0xe5, 0xd1, 0x4c, 0xc8, 0x67,
+  0x4c, 0xf9, 0xb9, 0x37, 0xa4, 0x6c, 0xc4, 0x35, 0xc9, 0x7d, 0xa3, 0x5c, 0xb7, 0xac, 0x8c, 0xdc,
+  0x8e, 0x7c, 0x3f, 0x5b, 0x3b, 0x0b, 0x69, 0xb0, 0xb1, 0x72, 0xc8, 0x58, 0x4a, 0x7c, 0x44, 0x7f,
+  0x1f, 0xd1, 0x98, 0xbf, 0x01, 0x33, 0x38, 0x07, 0xc3, 0xda, 0x9c, 0x77, 0x19, 0xe3, 0x4d, 0xcb,
+  0x18, 0x4b, 0xc7, 0xab, 0x69, 0x2d, 0x16, 0x7a, 0xb6, 0x62, 0x31, 0xde, 0x1b, 0x6b, 0x56, 0x92,
+  0x00, 0x13, 0x3d, 0x5b, 0x2d, 0x15, 0xb3, 0xfc, 0xf1, 0xfe, 0x8b, 0xde, 0x12, 0x62, 0xea, 0xf5,
+  0xb4, 0x27, 0x1b, 0x54, 0x83, 0x12, 0xd7, 0x98, 0x47, 0x5e, 0xd0, 0xf7, 0x7a, 0x33, 0x8d, 0x2a,
+  0x53, 0x35, 0x89, 0xcd, 0x98, 0x06, 0xae, 0xe0, 0x72, 0x96, 0xeb, 0xb2, 0x79, 0x2f, 0xfe, 0xd8,
+  0xfd, 0x4e, 0x1d, 0x98, 0xd1, 0x7a, 0xce, 0x60, 0x4b, 0xb0, 0x79, 0x43, 0x67, 0xb1, 0x96, 0x48,
+  0x1f, 0xb3, 0xe9, 0x25, 0xbf, 0x32, 0x02, 0x9b, 0x9b, 0x71, 0xe8, 0x7b, 0x5c, 0xc3, 0x26, 0xd6,
+  0x8d, 0xd8, 0xce, 0x49, 0x4a, 0xa2, 0x8b, 0x83, 0x4b, 0xeb, 0xca, 0x08, 0x2e, 0xcb, 0x57, 0x62,
+  0xd2, 0xc6, 0xfa, 0x7c, 0x4c, 0x22, 0xe8, 0xf7, 0x39, 0x3b, 0x02, 0xc7, 0x51, 0x8b, 0xf5, 0x9c,
+  0x10, 0x30, 0x29, 0x56, 0x58, 0xd9, 0x1b, 0x6c, 0xdb, 0x7c, 0x7b, 0x5b, 0xea, 0xc0, 0xc4, 0x9f,
+  0x64, 0xa0, 0x29, 0x15, 0xbf, 0x96, 0x46, 0x40, 0x68, 0x8a, 0xa5, 0x17, 0x2a, 0x94, 0x19, 0x47,
+  0x17, 0x27, 0x1f, 0xce, 0xf7, 0xff, 0xf9, 0xbe, 0xf3, 0xd5, 0xae, 0xd4, 0xeb, 0x06, 0xa4, 0xca,
+  0x0d, 0x91, 0x6c, 0xd4, 0xeb, 0xd5, 0x7a, 0x2b, 0x31, 0xaa, 0x08, 0xb4, 0x07, 0x4d, 0x3d, 0x9a,
+  0xd4, 0x01, 0xed, 0x53, 0x7e, 0xec, 0x53, 0xf8, 0x3c, 0x9c, 0x09, 0x8c, 0x45, 0x5a, 0xc2, 0x39,
+  0xde, 0x54, 0x40, 0x3a, 0x66, 0xaa, 0x4c, 0x0e, 0xdf, 0x8b, 0xdf, 0xb1, 0x09, 0x8d, 0x8e, 0x08,
+  0xa8, 0x91, 0xb4, 0x20, 0x35, 0x39, 0x5b, 0xc2, 0x75, 0xdb, 0xa6, 0x99, 0x12, 0x81, 0xc7, 0x8f,
+  0x48, 0xa8, 0x46, 0x08, 0xcb, 0x21, 0xc5, 0x4f, 0x6c, 0xd0, 0x03, 0xc2, 0x95, 0x92, 0x75, 0x60,
+  0xac, 0x06, 0x1e, 0xe3, 0x15, 0x1b, 0x46, 0x4d, 0x9f, 0x06, 0x7d, 0x3e, 0x10, 0xc6, 0xcb, 0xb2,
+  0x6d, 0xf6, 0x9c, 0x17, 0x6c, 0x6a, 0xc2, 0x32, 0x45, 0x87, 0x6b, 0x4c, 0x37, 0x39, 0xbb, 0x08,
+  0xc3, 0xa4, 0xed, 0xe6, 0x93, 0x1c, 0x89, 0x4b, 0x34, 0x7d, 0x7b, 0x7b, 0x73, 0x4e, 0xb1, 0xac,
+  0xeb, 0x50, 0x25, 0x46, 0xb8, 0x90, 0xc1, 0x6f, 0xe2, 0x22, 0xb6, 0xb3, 0xed, 0xfc, 0xf8, 0x81,
+  0xff, 0x99, 0x87, 0xa8, 0x52, 0xcd, 0x3c, 0x3d, 0x2d, 0xc5, 0x14, 0x9e, 0xe5, 0x5a, 0x2a, 0x97,
+  0x8a, 0x65, 0x4f, 0xf2, 0x0a, 0x87, 0xea, 0xdb, 0xdb, 0x1a, 0x4c, 0xee, 0x27, 0xb6, 0x4d, 0xb7,
+  0xb7, 0x35, 0x9c, 0x14, 0x05, 0xc9, 0x51, 0x8c, 0xfa, 0xf1, 0x03, 0x33, 0x51, 0x4b, 0x06, 0xa6,
+  0x67, 0x86, 0x46, 0xf8, 0xbf, 0x9d, 0xc0, 0x3d, 0x9e, 0x52, 0x67, 0xc4, 0x29, 0xd8, 0x06, 0x83,
+  0x19, 0x81, 0x21, 0xb5, 0x86, 0x3e, 0x97, 0xfe, 0x31, 0x2d, 0x70, 0x63, 0x3e, 0xa4, 0x7c, 0xc0,
+  0xdc, 0x26, 0xee, 0x53, 0x8e, 0x17, 0x3a, 0xb8, 0xf4, 0x81, 0x46, 0xed, 0x36, 0x35, 0xd9, 0xcd,
+  0x73, 0x6a, 0x72, 0x3a, 0xe5, 0x9a, 0xde, 0xd4, 0xe2, 0xed, 0xed, 0x18, 0x9c, 0x10, 0x9f, 0x22,
+  0x5c, 0xe0, 0x05, 0x2c, 0x94, 0x5f, 0x0f, 0x1c, 0x24, 0xac, 0x1b, 0x18, 0xfc, 0xea, 0xa4, 0xe0,
+  0x3c, 0xd0, 0x18, 0x68, 0x04, 0xdd, 0x94, 0x26, 0x25, 0xe3, 0x61, 0xeb, 0x73, 0x51, 0x0d, 0x33,
+  0xf0, 0x31, 0x28, 0x0e, 0xd4, 0xa7, 0x9c, 0x7b, 0x41, 0x1f, 0x6a, 0xd4, 0x8d, 0xac, 0x6e, 0x81,
+  0xe2, 0x3a, 0xcc, 0x37, 0xe2, 0xfb, 0x33, 0x4d, 0xd3, 0xed, 0xf6, 0x7c, 0xa1, 0x2f, 0xb6, 0x0e,
+  0x4a, 0x2a, 0x96, 0x4c, 0x83, 0xca, 0xad, 0xbf, 0x5c, 0x54, 0x29, 0x22, 0xa5, 0x79, 0x36, 0xda,
+  0x99, 0x0b, 0x3b, 0xdf, 0x65, 0xee, 0x0c, 0xeb, 0xa6, 0x17, 0x04, 0x34, 0x02, 0x78, 0xc1, 0xde,
+  0x39, 0x08, 0xdb, 0x07, 0x3e, 0xe9, 0x52, 0xbf, 0x2d, 0x0a, 0x1d, 0x94, 0x64, 0x02, 0xfd, 0x23,
+  0x40, 0x08, 0xa1, 0x83, 0x98, 0xfa, 0xd4, 0xe1, 0x6a, 0x8d, 0x4c, 0x44, 0x62, 0x45, 0x09, 0xc2,
+  0xc8, 0x73, 0x57, 0x21, 0x2c, 0x70, 0x06, 0x24, 0xe8, 0x53, 0x1b, 0x67, 0x9c, 0x4c, 0x19, 0xbe,
+  0xc5, 0x49, 0xf8, 0x26, 0x54, 0xd2, 0x98, 0xf8, 0x23, 0xaa, 0xe3, 0xb6, 0x6c, 0x04, 0xa1, 0x03,
+  0x16, 0x0a, 0x89, 0x12, 0x70, 0x1b, 0xc7, 0x9c, 0x44, 0xb0, 0x38, 0x86, 0xdb, 0x67, 0x9c, 0x44,
+  0x87, 0x24, 0xa6, 0x07, 0x25, 0x89, 0x71, 0x5f, 0x09, 0xdf, 0xeb, 0x0f, 0xb8, 0x2c, 0xf2, 0x0e,
+  0x3e, 0x1f, 0x2a, 0x33, 0xf1, 0xa9, 0x8b, 0xdb, 0x5f, 0xde, 0x1d, 0xbf, 0x78, 0x08, 0xb3, 0x1f,
+  0x91, 0x19, 0xa5, 0x01, 0x6e, 0xbf, 0x92, 0x1f, 0x0f, 0xe1, 0xbb, 0x74, 0x8c, 0xdb, 0x2f, 0xe8,
+  0xf8, 0x21, 0x3c, 0x45, 0xf1, 0xa3, 0xa8, 0x75, 0x49, 0x74, 0x03, 0x95, 0x12, 0x3e, 0x80, 0x1e,
+  0x3e, 0x84, 0xde, 0xf5, 0x47, 0x14, 0xb7, 0x0f, 0xfd, 0xd1, 0x83, 0xac, 0x0b, 0xbd, 0xe0, 0x06,
+  0xb7, 0x4f, 0xbd, 0xe0, 0xe6, 0x41, 0x26, 0x87, 0xc4, 0x81, 0x31, 0x81, 0x3f, 0x0f, 0xe1, 0x06,
+  0x33, 0x12, 0xe0, 0xf6, 0x87, 0x19, 0x59, 0x65, 0xd6, 0x41, 0x49, 0x4a, 0x4b, 0xfb, 0xa0, 0x14,
+  0xb6, 0x77, 0x16, 0xa9, 0x5c, 0x50, 0x3d, 0x6f, 0xf8, 0x93, 0x0c, 0xe1, 0x53, 0x80, 0x79, 0xf7,
+  0xcf, 0x38, 0x8b, 0x48, 0x5f, 0x88, 0xd2, 0x09, 0xa7, 0x43, 0x4d, 0x0a, 0x9f, 0xc8, 0x4f, 0xed,
+  0x48, 0xf2, 0xa1, 0x2c, 0x89, 0x29, 0xa6, 0x03, 0xac, 0x82, 0xd8, 0x74, 0xb1, 0x5c, 0x41, 0x50,
+  0xbe, 0x60, 0xae, 0xd6, 0x7e, 0xbe, 0x56, 0xe1, 0x06, 0x63, 0xd0, 0x63, 0xf8, 0x89, 0x50, 0x90,
+  0x62, 0xfe, 0xe4, 0xc4, 0x5d, 0x97, 0x62, 0x6c, 0x83, 0x63, 0x92, 0xd3, 0x1a, 0x7c, 0xe6, 0xd3,
+  0xf6, 0x56, 0x33, 0x62, 0x8c, 0x1b, 0xe2, 0xbf, 0x66, 0x22, 0xd0, 0xf3, 0x62, 0xb1, 0xdb, 0x2f,
+  0x3a, 0xcc, 0x67, 0x51, 0xf3, 0x97, 0x72, 0x05, 0xfe, 0x69, 0x15, 0x8b, 0xa0, 0xfe, 0x12, 0xa0,
+  0xd3, 0x73, 0xad, 0x67, 0x0d, 0x00, 0x0e, 0x52, 0x50, 0x65, 0x8f, 0x36, 0x00, 0xb4, 0x0e, 0xe9,
+  0xb2, 0xc8, 0xa5, 0x51, 0x0a, 0x76, 0x89, 0xdb, 0x20, 0xad, 0xa2, 0x22, 0x30, 0x6d, 0x87, 0xec,
+  0x93, 0x5e, 0xaf, 0x55, 0x2c, 0x8a, 0x99, 0x9d, 0x40, 0xf7, 0xab, 0x4e, 0x9d, 0x76, 0x5b, 0xc5,
+  0xa2, 0xd0, 0x3b, 0x41, 0x8a, 0x5d, 0x7f, 0xb6, 0x4f, 0x6a, 0xd5, 0x56, 0xb1, 0xd8, 0x63, 0x01,
+  0x2f, 0xc6, 0xde, 0x2d, 0x6d, 0x96, 0xad, 0x70, 0xba, 0x58, 0x76, 0x44, 0x48, 0x6d, 0xb6, 0x27,
+  0xbe, 0x17, 0x50, 0x12, 0x15, 0xfb, 0x11, 0x71, 0x3d, 0x30, 0xdf, 0x9c, 0xa1, 0x2e, 0xe3, 0x9c,
+  0x0d, 0x0d, 0xf4, 0x4b, 0xaf, 0xd7, 0xa5, 0xd5, 0x2a, 0xb2, 0xfe, 0x66, 0xa0, 0x5f, 0xba, 0x0d,
+  0xab, 0xd7, 0xa8, 0xa0, 0xb2, 0x65, 0xfd, 0x4d, 0x5f, 0xe9, 0xb6, 0x55, 0x85, 0x7f, 0x72, 0xdd,
+  0x96, 0xd8, 0xfb, 0xe5, 0x6c, 0xc7, 0x25, 0x6c, 0xad, 0xe3, 0x0d, 0xc1, 0x8c, 0x7c, 0xaf, 0x5f,
+  0x8a, 0xff, 0xad, 0xf5, 0xba, 0x41, 0xbb, 0xfb, 0x77, 0xf6, 0x0e, 0x34, 0xc2, 0xc3, 0x43, 0xd4,
+  0x13, 0xcc, 0x4c, 0x09, 0x8d, 0xfa, 0x5d, 0x0d, 0x9c, 0x24, 0x54, 0x6e, 0x58, 0x06, 0xb2, 0xf4,
+  0x0c, 0xbd, 0x1b, 0xb2, 0x72, 0x84, 0x6f, 0xc8, 0xcf, 0x75, 0x62, 0x43, 0xfe, 0x46, 0xba, 0x95,
+  0x7e, 0x7a, 0xec, 0x98, 0x3c, 0xdb, 0x7b, 0x56, 0x79, 0x56, 0x93, 0x63, 0x52, 0xdb, 0xab, 0xd5,
+  0x6b, 0x9b, 0xc7, 0xa4, 0xd7, 0xed, 0xd5, 0x7a, 0xb5, 0xdc, 0x98, 0x54, 0xca, 0xb5, 0xfd, 0x4a,
+  0x37, 0x3b, 0x22, 0x29, 0x24, 0x3f, 0x22, 0x29, 0x38, 0x3f, 0x28, 0x29, 0x38, 0xdf, 0x8d, 0x2c,
+  0xa0, 0x18, 0x37, 0xf7, 0xd3, 0x8e, 0xb9, 0x74, 0xfc, 0x97, 0x9f, 0x32, 0x6b, 0xd3, 0x25, 0x11,
+  0xa0, 0x4c, 0x17, 0xca, 0x95, 0x6a, 0x96, 0x58, 0x4b, 0xfc, 0x2f, 0xd7, 0xa3, 0x86, 0xdb, 0xd8,
+  0x6f, 0x10, 0x31, 0x1b, 0xf2, 0xa4, 0x26, 0x19, 0x09, 0xc7, 0x48, 0x74, 0xf3, 0x30, 0xcb, 0x1a,
+  0xcf, 0x1a, 0xee, 0x9e, 0xab, 0x8a, 0x80, 0xa9, 0xc8, 0x15, 0xb1, 0xea, 0xd5, 0x67, 0x8d, 0xc3,
+  0x95, 0x22, 0xc7, 0x7b, 0x2f, 0xcb, 0x2f, 0x8f, 0x1f, 0x3f, 0x43, 0xf3, 0x54, 0x26, 0xa8, 0xaa,
+  0x49, 0xb0, 0x39, 0x2b, 0x2c, 0x71, 0x88, 0x5b, 0x5b, 0x69, 0x92, 0xee, 0xd5, 0x6b, 0xfb, 0xd6,
+  0x5a, 0x5d, 0x12, 0x9c, 0x28, 0x24, 0x30, 0x46, 0x79, 0xea, 0x25, 0xe7, 0xb2, 0x82, 0x5c, 0xe9,
+  0xba, 0x65, 0x31, 0xf6, 0xfd, 0xe2, 0x28, 0xf2, 0x9b, 0xa3, 0xc8, 0xd7, 0x76, 0xc4, 0x5e, 0x1c,
+  0xec, 0x26, 0x7a, 0x32, 0x72, 0x2c, 0x31, 0x87, 0x53, 0x5e, 0x8c, 0x79, 0x44, 0xc9, 0x30, 0xd9,
+  0x9a, 0xdb, 0x49, 0xa7, 0x5c, 0x8f, 0x0c, 0x3d, 0x7f, 0xd6, 0xdc, 0x39, 0x8d, 0x68, 0x1c, 0x23,
+  0xb0, 0xc0, 0x1c, 0x55, 0x4e, 0x77, 0x0c, 0x67, 0x14, 0xc5, 0xde, 0x98, 0x2a, 0x6a, 0xc0, 0xea,
+  0xe5, 0x89, 0x29, 0x57, 0xab, 0x8d, 0xbd, 0x8d, 0x0a, 0xe4, 0x4f, 0x20, 0xe6, 0x88, 0x0d, 0x3d,
+  0x07, 0x7d, 0xa0, 0x23, 0xba, 0x24, 0x04, 0x2c, 0x91, 0x30, 0x40, 0xb9, 0x3d, 0x11, 0xb1, 0x23,
+  0x20, 0xec, 0x74, 0xe2, 0x51, 0x09, 0x9f, 0x14, 0xd6, 0xea, 0xa4, 0xf9, 0x86, 0x15, 0xf2, 0x80,
+  0x8c, 0xcd, 0xef, 0xb1, 0xc8, 0x70, 0x09, 0x57, 0x19, 0x15, 0xab, 0x52, 0xb3, 0xf6, 0xcb, 0xcf,
+  0x04, 0x38, 0xa2, 0x21, 0x93, 0x60, 0xb9, 0x8c, 0x56, 0x2a, 0xf5, 0x3d, 0x3e, 0x18, 0x75, 0xc1,
+  0xf5, 0x2c, 0xd1, 0x09, 0x9b, 0x78, 0xa5, 0xa4, 0x7e, 0x03, 0xc5, 0xa3, 0xee, 0xd0, 0xe3, 0x48,
+  0xba, 0x84, 0x31, 0xe2, 0x4c, 0x2c, 0xb6, 0x20, 0xd1, 0x26, 0x89, 0xd1, 0xe9, 0x27, 0x01, 0xcb,
+  0x97, 0x12, 0xad, 0x74, 0xc4, 0x96, 0x6b, 0xfc, 0x98, 0x56, 0x4a, 0x30, 0x15, 0x3d, 0x1e, 0x97,
+  0x80, 0x7e, 0x51, 0xf8, 0x88, 0x85, 0xb3, 0x08, 0xa6, 0x1c, 0xfa, 0x3f, 0xff, 0x53, 0x10, 0x8f,
+  0x5e, 0x89, 0xc2, 0x69, 0xc7, 0xd1, 0x91, 0x28, 0x82, 0x54, 0x2b, 0x7f, 0x25, 0xe7, 0x7e, 0xab,
+  0xb4, 0xbb, 0xbb, 0x85, 0x76, 0xc1, 0xbd, 0x17, 0x03, 0x86, 0x32, 0x22, 0x83, 0x84, 0xab, 0x03,
+  0xb9, 0xa7, 0x91, 0x37, 0x86, 0xe1, 0x0b, 0x45, 0xcc, 0x15, 0x23, 0x12, 0x51, 0x14, 0x46, 0xb4,
+  0xe7, 0x4d, 0xa9, 0x8b, 0x26, 0x1e, 0x1f, 0x20, 0x82, 0x76, 0x7e, 0xd9, 0x41, 0x31, 0x0c, 0x08,
+  0x9d, 0xa1, 0x89, 0xe7, 0xfb, 0x40, 0xc7, 0xd0, 0x0b, 0xbc, 0xa1, 0x77, 0x4b, 0x5d, 0xd8, 0x29,
+  0xe2, 0x03, 0x8a, 0xba, 0xa3, 0xc0, 0xf5, 0x69, 0xb4, 0x85, 0x76, 0x4b, 0x2a, 0xae, 0x50, 0x1b,
+  0x2d, 0x68, 0xbe, 0xb5, 0x85, 0x50, 0x36, 0xbc, 0x40, 0xf3, 0x2d, 0x90, 0x0a, 0xf0, 0xab, 0x20,
+  0xc6, 0x40, 0x36, 0xca, 0xc4, 0x1b, 0xad, 0x2d, 0x91, 0x09, 0x09, 0xe9, 0x90, 0xbd, 0xf3, 0x62,
+  0x8e, 0x0a, 0x36, 0xc2, 0x6e, 0xb1, 0xe7, 0xd3, 0x29, 0x82, 0xff, 0xc0, 0xe4, 0x18, 0x0d, 0x03,
+  0x9c, 0x45, 0x4e, 0xe3, 0x14, 0x40, 0xbe, 0x3e, 0x78, 0x52, 0x2c, 0xa2, 0x8e, 0x4f, 0x23, 0x2e,
+  0xfa, 0x44, 0x50, 0x0c, 0x5b, 0xef, 0x84, 0x0b, 0x5a, 0x39, 0x0b, 0x11, 0xe9, 0xb2, 0x31, 0x15,
+  0x29, 0xc1, 0x9c, 0x80, 0x8c, 0xbd, 0xbe, 0x5c, 0x15, 0x42, 0x1d, 0xdf, 0x67, 0x13, 0x91, 0x35,
+  0xa0, 0x42, 0x38, 0x40, 0xf2, 0xa6, 0x21, 0xac, 0x85, 0x8d, 0x69, 0xc4, 0x3d, 0x07, 0x62, 0x40,
+  0x00, 0xf6, 0x3c, 0x8e, 0x48, 0x30, 0x4b, 0xb6, 0xfb, 0xd1, 0x96, 0x14, 0x77, 0xc4, 0x22, 0x14,
+  0x0f, 0x22, 0xd8, 0xd6, 0xf7, 0x60, 0xd1, 0x90, 0x46, 0x14, 0x79, 0x31, 0xc4, 0xa7, 0x03, 0x88,
+  0x2d, 0x39, 0x43, 0xf1, 0x80, 0x4d, 0x90, 0x17, 0x88, 0x36, 0x48, 0x86, 0xc8, 0x62, 0xb1, 0xbd,
+  0x85, 0xd0, 0x81, 0xeb, 0x8d, 0x45, 0xc0, 0x24, 0xb3, 0xb0, 0x1c, 0x2d, 0x1b, 0x4b, 0xb5, 0x40,
+  0x61, 0xb7, 0x02, 0x75, 0xfb, 0x45, 0xb9, 0xd4, 0xd5, 0x16, 0x8d, 0x8a, 0xee, 0x9e, 0xfa, 0xc4,
+  0xa1, 0xcb, 0x3a, 0x11, 0xe0, 0x43, 0x2b, 0x04, 0x85, 0xc4, 0x75, 0xa9, 0x8b, 0xa0, 0x5e, 0x31,
+  0x90, 0x84, 0xa3, 0xc9, 0x80, 0x06, 0xc8, 0xe3, 0x3b, 0x82, 0x2e, 0x18, 0xf2, 0x18, 0x7a, 0xb0,
+  0x2c, 0x2c, 0xe8, 0x49, 0x46, 0x7b, 0xe0, 0xb9, 0x2e, 0x0d, 0x24, 0x75, 0x8a, 0x3e, 0x45, 0x53,
+  0x48, 0x8a, 0x55, 0x94, 0x21, 0x0c, 0xb7, 0x63, 0x36, 0xcc, 0x12, 0x70, 0x50, 0x72, 0xbd, 0xb1,
+  0xe8, 0x55, 0xf2, 0xb1, 0xa5, 0xc8, 0x7d, 0x9f, 0xe7, 0x3b, 0xea, 0x92, 0x08, 0x0d, 0x48, 0x8c,
+  0x08, 0x92, 0xd2, 0xa7, 0x98, 0x0f, 0x6c, 0x8f, 0x19, 0xf2, 0x38, 0xf0, 0x90, 0xf8, 0x13, 0x32,
+  0x8b, 0xd1, 0xd8, 0x8b, 0xbd, 0xae, 0x4f, 0x57, 0xf9, 0x05, 0x23, 0x59, 0x0c, 0xc8, 0x38, 0xe5,
+  0x98, 0x12, 0x19, 0xe2, 0x7b, 0xfd, 0x40, 0x28, 0x48, 0xee, 0x0c, 0xa4, 0x00, 0xc9, 0xf1, 0x29,
+  0x5a, 0xb8, 0xad, 0xe8, 0xca, 0x51, 0x25, 0x3a, 0x0f, 0xa3, 0x4a, 0xbc, 0x20, 0x16, 0x4c, 0x09,
+  0x49, 0x9f, 0xa6, 0xe3, 0x0c, 0x24, 0xf5, 0x3c, 0xdf, 0x8f, 0xd1, 0x98, 0xae, 0x88, 0x83, 0x60,
+  0xe0, 0x98, 0x78, 0x3e, 0x9c, 0x31, 0x41, 0xdd, 0x88, 0xc5, 0x13, 0x1a, 0x21, 0x61, 0x78, 0x4c,
+  0xf4, 0x71, 0x4c, 0xa3, 0x1e, 0xc8, 0x96, 0x17, 0xa3, 0x98, 0x2e, 0xe5, 0x85, 0x33, 0xc5, 0x61,
+  0xe8, 0x28, 0x49, 0x85, 0x0c, 0xc5, 0x0e, 0x84, 0xc5, 0xc0, 0x97, 0x80, 0x8e, 0xa1, 0x9a, 0x01,
+  0x9b, 0xc4, 0x06, 0x22, 0x20, 0x9f, 0x42, 0x92, 0x06, 0x14, 0xf5, 0x18, 0x03, 0x79, 0x00, 0x97,
+  0x8d, 0x2a, 0xc6, 0x29, 0x29, 0x97, 0x2e, 0xdc, 0x26, 0x1e, 0xa5, 0xfc, 0x11, 0xac, 0xe8, 0x47,
+  0x6c, 0x52, 0x2c, 0x23, 0xa6, 0x88, 0x2b, 0x4a, 0x52, 0xb2, 0x82, 0x25, 0x78, 0x92, 0x76, 0x1e,
+  0x78, 0x23, 0xc7, 0x29, 0xa6, 0x0e, 0x0b, 0x5c, 0x12, 0xcd, 0x50, 0xec, 0xb9, 0x34, 0x3b, 0x96,
+  0xc0, 0x21, 0xa2, 0xf8, 0xd8, 0x63, 0x91, 0x64, 0x8b, 0xc3, 0xbd, 0xb1, 0xe2, 0x64, 0x4e, 0x94,
+  0xd2, 0xa1, 0x53, 0x4d, 0xac, 0x0e, 0xdf, 0xa0, 0x58, 0xb6, 0x2c, 0x45, 0x4f, 0xa6, 0x88, 0x6c,
+  0x3d, 0x37, 0xde, 0xb9, 0xa1, 0x5d, 0xf6, 0x68, 0x56, 0x24, 0x23, 0xce, 0x96, 0x35, 0x24, 0x92,
+  0x98, 0xab, 0x0e, 0xe8, 0xda, 0xc8, 0x98, 0x6c, 0xa5, 0xe5, 0xb5, 0x4a, 0x91, 0x30, 0xa0, 0x36,
+  0x9e, 0xb0, 0xc8, 0x2d, 0x76, 0x23, 0x4a, 0x6e, 0x9a, 0x48, 0xfc, 0x29, 0x02, 0x04, 0xb7, 0xb7,
+  0xd6, 0x1b, 0x5d, 0x4a, 0x9c, 0xe2, 0xef, 0x39, 0x98, 0x3a, 0x90, 0xee, 0x00, 0xd1, 0x29, 0x19,
+  0x86, 0x3e, 0x85, 0x55, 0x61, 0x22, 0x59, 0x25, 0x66, 0x6b, 0xd2, 0xaa, 0xb0, 0x82, 0x52, 0x2c,
+  0x32, 0xba, 0xc8, 0x00, 0x3d, 0x33, 0x63, 0x23, 0x14, 0x50, 0xea, 0xca, 0x02, 0x29, 0x83, 0x9f,
+  0x14, 0x8b, 0x8f, 0xe0, 0xb4, 0x60, 0xf1, 0xdd, 0x0c, 0x1b, 0x94, 0x93, 0x6e, 0xca, 0x49, 0xd9,
+  0xac, 0xd3, 0x21, 0x6e, 0xbf, 0xa6, 0xc4, 0x05, 0x31, 0xfc, 0x18, 0xd0, 0x83, 0xd2, 0xa0, 0xfc,
+  0x48, 0xec, 0xf3, 0x09, 0xfb, 0x19, 0xec, 0x41, 0x44, 0x7f, 0xa6, 0xf6, 0x97, 0x6c, 0x14, 0xfd,
+  0x0c, 0xba, 0x37, 0xce, 0xd4, 0x9e, 0x19, 0x23, 0xe0, 0xdf, 0xcf, 0x0c, 0x90, 0x54, 0x07, 0x20,
+  0xe6, 0x34, 0xe0, 0x5e, 0xa4, 0x74, 0xc5, 0x34, 0xd5, 0xa3, 0x7c, 0xc0, 0x46, 0x5c, 0x8d, 0x9c,
+  0x17, 0xf4, 0xff, 0xf4, 0x11, 0x53, 0x93, 0x36, 0xe9, 0x6b, 0x97, 0x38, 0x37, 0x7d, 0xb1, 0x5b,
+  0xac, 0xfc, 0x48, 0xd4, 0x8f, 0xe8, 0x0c, 0x2f, 0xfb, 0xa6, 0xb8, 0x23, 0xcc, 0xc6, 0x88, 0x83,
+  0xce, 0x85, 0x99, 0x46, 0xe5, 0x4a, 0x08, 0x18, 0x0d, 0x61, 0xb5, 0x84, 0x03, 0x20, 0x15, 0x3b,
+  0x75, 0x91, 0x33, 0xf0, 0x7c, 0x37, 0xa2, 0x41, 0x6a, 0xc1, 0x04, 0xdd, 0x52, 0x31, 0x73, 0x72,
+  0x03, 0xfc, 0x1c, 0x85, 0x52, 0x29, 0x8d, 0x7c, 0x1f, 0x89, 0x13, 0x74, 0x42, 0x13, 0x28, 0x4d,
+  0x9e, 0x6f, 0x37, 0x3b, 0xff, 0x36, 0xcc, 0x77, 0xa5, 0xb4, 0x95, 0xb9, 0xfb, 0x3e, 0x8a, 0xb9,
+  0xd7, 0x9b, 0xa5, 0x46, 0x26, 0xd1, 0x9c, 0x30, 0xbe, 0xed, 0x73, 0x1a, 0x73, 0xe1, 0x0d, 0x01,
+  0xe9, 0x2f, 0xa1, 0xe9, 0x2f, 0xa2, 0xe9, 0x02, 0x7a, 0x4d, 0xe5, 0x6a, 0x59, 0x46, 0x1e, 0xd2,
+  0x21, 0x5e, 0x1f, 0xec, 0x35, 0x0b, 0xf5, 0x52, 0xea, 0xd6, 0xac, 0xeb, 0xa0, 0x94, 0xaa, 0xf2,
+  0x8c, 0x72, 0x86, 0x6a, 0x45, 0xd1, 0x4a, 0xc5, 0x7c, 0x87, 0x6a, 0xca, 0x9a, 0x72, 0xf1, 0xcd,
+  0xa3, 0x51, 0xe0, 0x08, 0x47, 0x8c, 0x14, 0xab, 0xb8, 0xbd, 0xed, 0xb0, 0x70, 0xd6, 0x42, 0x07,
+  0x71, 0x48, 0x94, 0xb3, 0x66, 0xef, 0x00, 0x68, 0xa7, 0x7d, 0x50, 0x02, 0x58, 0x3b, 0x77, 0x3a,
+  0xe7, 0xff, 0xfe, 0x8f, 0xff, 0x8d, 0x8a, 0xc2, 0x67, 0x7d, 0xcf, 0x5c, 0x63, 0xe9, 0xbc, 0x02,
+  0xef, 0xd3, 0x15, 0x4e, 0x18, 0x25, 0xe5, 0x4e, 0xba, 0x68, 0x14, 0xb8, 0x34, 0x52, 0x6e, 0xa7,
+  0xea, 0xf6, 0xb5, 0x94, 0xf7, 0x52, 0x09, 0x5d, 0x84, 0xc2, 0xa3, 0x87, 0xee, 0x3a, 0xa9, 0x83,
+  0x1c, 0x30, 0xee, 0x39, 0x34, 0x71, 0x5a, 0x64, 0xe7, 0x44, 0x81, 0x74, 0x39, 0xed, 0xf7, 0x11,
+  0x8d, 0x66, 0x67, 0x22, 0xfa, 0x62, 0x91, 0xb6, 0xf3, 0x8b, 0xb2, 0x4c, 0xa6, 0xa0, 0x5b, 0xad,
+  0x23, 0x9f, 0xc3, 0x94, 0xb0, 0x11, 0x6c, 0x23, 0xbd, 0x20, 0x9c, 0x6a, 0x3a, 0x2c, 0xa5, 0xc1,
+  0x90, 0xfd, 0x46, 0x49, 0xa4, 0xe9, 0x5b, 0x08, 0x2d, 0x50, 0xa9, 0x44, 0x5c, 0xf7, 0x90, 0xb9,
+  0xb3, 0x2d, 0xa0, 0x48, 0x78, 0xb1, 0x08, 0xed, 0xa2, 0x33, 0xca, 0xb3, 0x66, 0x44, 0x7a, 0xbc,
+  0x32, 0xeb, 0xef, 0x21, 0x89, 0xc8, 0x10, 0xcd, 0xe5, 0x06, 0xc4, 0x22, 0xd9, 0x6a, 0x2d, 0xa2,
+  0x4e, 0x16, 0xad, 0xb4, 0x85, 0x84, 0xd5, 0x95, 0x15, 0x48, 0xde, 0x89, 0xcd, 0xc1, 0x61, 0xfa,
+  0x99, 0xb8, 0xa6, 0x5e, 0x0f, 0x69, 0x4f, 0xb2, 0x60, 0xb9, 0x2d, 0x22, 0x39, 0x24, 0x16, 0xa5,
+  0x7f, 0x59, 0xad, 0x05, 0xd9, 0x68, 0x59, 0x40, 0x22, 0x6e, 0x5c, 0x88, 0xdc, 0xc9, 0x16, 0x3c,
+  0x71, 0x77, 0x8c, 0x4c, 0x31, 0xd3, 0x73, 0x13, 0xff, 0x37, 0x3f, 0x0c, 0x2b, 0x2e, 0xea, 0x3d,
+  0x7c, 0xef, 0xf8, 0xbe, 0xb6, 0xf3, 0x4b, 0xe2, 0x08, 0x21, 0x73, 0x48, 0x83, 0x51, 0xd1, 0xe3,
+  0x74, 0xb8, 0xa3, 0x9b, 0x3d, 0x16, 0x1d, 0x13, 0x67, 0xa0, 0x01, 0x0c, 0x68, 0x41, 0x76, 0x5b,
+  0xf5, 0x57, 0xf6, 0x38, 0x81, 0x8b, 0x3d, 0xf4, 0x98, 0xca, 0xcd, 0x70, 0x64, 0xdb, 0x77, 0xf4,
+  0x58, 0xee, 0x95, 0xa7, 0x35, 0x20, 0x94, 0x96, 0x4f, 0xfd, 0x76, 0xd8, 0xca, 0xd6, 0x76, 0x64,
+  0x44, 0x4e, 0xdd, 0x1d, 0x5d, 0xa1, 0x2e, 0x90, 0xd8, 0xd5, 0xbe, 0xb7, 0x64, 0x44, 0x87, 0x6c,
+  0x4c, 0x37, 0x15, 0x16, 0x7f, 0x17, 0xfa, 0x26, 0x3e, 0x2d, 0x1d, 0x92, 0x9f, 0x60, 0xd6, 0xd2,
+  0x8f, 0xf8, 0x17, 0xd9, 0xe5, 0xb9, 0xf7, 0x30, 0xcb, 0x73, 0xff, 0x6b, 0xb1, 0x2a, 0xeb, 0xd0,
+  0xa6, 0x32, 0x2f, 0x69, 0x5f, 0xc6, 0x6a, 0x2f, 0x47, 0x41, 0x96, 0x6a, 0x08, 0xd3, 0x76, 0xa0,
+  0xe0, 0x4e, 0x66, 0x5b, 0x08, 0xd9, 0x89, 0x1f, 0x7b, 0xbd, 0x41, 0x97, 0x67, 0xa2, 0x35, 0xb4,
+  0xd9, 0x64, 0x65, 0x74, 0x79, 0xa6, 0xf8, 0x8a, 0x93, 0x9e, 0xe2, 0x48, 0x8b, 0x9e, 0x04, 0x44,
+  0xb0, 0x50, 0x81, 0xdb, 0x4f, 0xe7, 0x77, 0xf2, 0x7c, 0x91, 0xd5, 0xfd, 0x2b, 0x9e, 0x5f, 0xbe,
+  0xc1, 0x35, 0xdf, 0xe7, 0x1a, 0x15, 0xd0, 0x06, 0x7e, 0x68, 0x9b, 0xdb, 0xd2, 0x51, 0x21, 0xad,
+  0xf6, 0x3a, 0xef, 0x60, 0x8a, 0xc4, 0xf5, 0xd6, 0x72, 0x40, 0x4a, 0x25, 0x97, 0x05, 0x14, 0x91,
+  0x1e, 0xa8, 0xc7, 0x25, 0x1f, 0x49, 0x0c, 0xb6, 0x14, 0x1c, 0x82, 0x58, 0x46, 0x13, 0x81, 0x2b,
+  0x46, 0x2a, 0x60, 0x2e, 0x8d, 0x4d, 0xc4, 0xbb, 0x6e, 0x13, 0xe5, 0x48, 0x41, 0xc4, 0x95, 0xa8,
+  0x2e, 0x1b, 0x22, 0xd7, 0x8b, 0xa8, 0xc3, 0xfd, 0xd9, 0xca, 0x58, 0xc6, 0x94, 0xbf, 0xa0, 0x3d,
+  0x32, 0xf2, 0xf9, 0x67, 0xd8, 0x7f, 0x88, 0x73, 0x23, 0x7a, 0x27, 0xca, 0x5d, 0x9d, 0x4c, 0x3b,
+  0x01, 0x5a, 0xfa, 0x21, 0x5d, 0xfa, 0xb0, 0xf6, 0x96, 0xcb, 0x3c, 0x10, 0xb6, 0x44, 0x31, 0x47,
+  0xc0, 0x13, 0x65, 0x5e, 0x54, 0xb6, 0x0f, 0xa1, 0xff, 0x64, 0x00, 0x07, 0x51, 0x84, 0x2a, 0x1a,
+  0xc2, 0xf6, 0x2d, 0x8d, 0xf3, 0x4a, 0x5f, 0x6e, 0xd9, 0x27, 0x4a, 0x1f, 0xce, 0x46, 0xa1, 0xa2,
+  0x5c, 0xf4, 0x50, 0x6d, 0xcc, 0x42, 0x65, 0x26, 0x78, 0xe4, 0xf5, 0xfb, 0xc2, 0x93, 0xe9, 0xce,
+  0xc4, 0x3c, 0x82, 0x3d, 0x48, 0xdf, 0x73, 0x6e, 0xee, 0x34, 0x0f, 0x50, 0x9b, 0xb6, 0xac, 0x38,
+  0xe1, 0x9c, 0xe0, 0xce, 0x06, 0x03, 0xb0, 0xe1, 0xb4, 0x9c, 0x3c, 0xe9, 0x09, 0x63, 0x99, 0x61,
+  0x0d, 0x68, 0x92, 0x61, 0x5e, 0x8f, 0x82, 0xe6, 0xc8, 0x34, 0x94, 0x31, 0x34, 0x23, 0x31, 0x67,
+  0xcf, 0x12, 0xcd, 0xf6, 0x9e, 0x06, 0x23, 0x4d, 0x6f, 0xc1, 0x18, 0x3c, 0x9e, 0xc1, 0x2a, 0x15,
+  0x87, 0xd4, 0xf1, 0x7a, 0xde, 0x72, 0xd1, 0xc6, 0x73, 0x37, 0xf3, 0xd2, 0x73, 0xf3, 0x3c, 0x4c,
+  0xf0, 0x7e, 0x9e, 0x83, 0x27, 0xae, 0xb6, 0xd4, 0x7c, 0x7f, 0x32, 0xdf, 0xa4, 0xbe, 0xf5, 0x5c,
+  0x3d, 0x65, 0x46, 0x09, 0xbd, 0x52, 0x6c, 0x18, 0x05, 0xde, 0xef, 0x23, 0x25, 0x41, 0xcb, 0xc3,
+  0x57, 0xc0, 0x69, 0x10, 0x1f, 0xc5, 0x54, 0x88, 0x6b, 0x25, 0x3f, 0x15, 0x81, 0xf2, 0x3c, 0x8b,
+  0x2c, 0x2b, 0x0e, 0xa8, 0xde, 0x43, 0x9c, 0x28, 0x00, 0x07, 0x18, 0x39, 0x8d, 0xb4, 0x0c, 0x91,
+  0x06, 0xf2, 0x02, 0x97, 0x4e, 0x13, 0xbb, 0x1e, 0xeb, 0x59, 0xbb, 0xa1, 0x0e, 0x5f, 0x64, 0xcf,
+  0xef, 0x9c, 0x00, 0xb6, 0x26, 0xac, 0xcb, 0x30, 0x11, 0x05, 0x7b, 0x55, 0x3c, 0x74, 0x01, 0x14,
+  0x15, 0x27, 0x3a, 0x5d, 0x34, 0x3f, 0x24, 0xe1, 0xfd, 0x72, 0xb5, 0xd4, 0xfd, 0x60, 0xcb, 0xb2,
+  0x7c, 0x40, 0x5d, 0xea, 0xb0, 0x21, 0xdc, 0x4b, 0x11, 0xeb, 0x61, 0x3e, 0x1d, 0x53, 0x5f, 0x8c,
+  0x69, 0x86, 0x13, 0xe2, 0xec, 0x9a, 0x9d, 0x65, 0x88, 0xea, 0x87, 0x68, 0x58, 0x12, 0xdb, 0xce,
+  0x18, 0x08, 0x59, 0x2a, 0xb1, 0x43, 0xc8, 0x46, 0x8f, 0xf0, 0x20, 0xd0, 0x73, 0xb4, 0xb4, 0x5c,
+  0xa8, 0x89, 0x76, 0x76, 0xd2, 0xea, 0x14, 0xb7, 0xa4, 0x5d, 0x51, 0x92, 0x96, 0x3b, 0x2e, 0x90,
+  0x1c, 0xd5, 0x5e, 0x9d, 0xb3, 0xf2, 0x94, 0x54, 0xd6, 0x8d, 0x49, 0xfd, 0xf0, 0xd4, 0xc2, 0x2b,
+  0x32, 0xc5, 0x3a, 0xcd, 0xd3, 0x79, 0x42, 0xc1, 0x02, 0x1c, 0xf0, 0x1a, 0x46, 0x50, 0xb6, 0xc8,
+  0xc5, 0x41, 0xcb, 0xa7, 0x73, 0xf8, 0xbb, 0x10, 0x76, 0x06, 0x3e, 0xb2, 0x0a, 0x3d, 0x1d, 0x09,
+  0x84, 0xcc, 0xef, 0xcc, 0x0b, 0xb4, 0x1d, 0x65, 0x7c, 0x85, 0xa9, 0x4c, 0xdc, 0xb0, 0x15, 0x73,
+  0x09, 0x5c, 0xcd, 0x88, 0xec, 0x03, 0xfe, 0x4b, 0x32, 0x26, 0x9b, 0x15, 0x41, 0x4e, 0x70, 0x95,
+  0x58, 0xdd, 0x3f, 0xa3, 0x84, 0xbc, 0x3e, 0xa8, 0x8b, 0xee, 0x73, 0xf9, 0xb6, 0xd6, 0x25, 0x44,
+  0x35, 0x72, 0x97, 0x50, 0x26, 0x12, 0xb2, 0x26, 0x1f, 0x6b, 0xb3, 0xf9, 0x4e, 0x4b, 0x7e, 0xa7,
+  0x98, 0xfc, 0x21, 0x21, 0x39, 0x71, 0xf3, 0x22, 0xe2, 0xb9, 0x8f, 0x17, 0x90, 0x0d, 0xf1, 0x9a,
+  0x14, 0x17, 0x88, 0xfa, 0x9e, 0xce, 0x73, 0x5d, 0x12, 0x52, 0x33, 0x5c, 0xf1, 0x48, 0x32, 0xfe,
+  0x80, 0x9a, 0xc6, 0xeb, 0xa2, 0xb3, 0x74, 0x4a, 0xef, 0x13, 0x9e, 0x44, 0xf9, 0x67, 0x44, 0xe8,
+  0xe2, 0x24, 0xd5, 0xc5, 0xa5, 0x92, 0x14, 0x99, 0x8b, 0x13, 0x88, 0xfd, 0x86, 0xc4, 0x4d, 0x7c,
+  0x0e, 0xe2, 0xfb, 0xa9, 0xac, 0x0c, 0xc8, 0x18, 0x54, 0x01, 0x55, 0x27, 0xb4, 0xa8, 0x6b, 0x20,
+  0x11, 0xda, 0x33, 0x44, 0x5c, 0x12, 0x72, 0xf9, 0xe1, 0x0a, 0xe3, 0x2c, 0x8b, 0x3c, 0xdf, 0x42,
+  0x28, 0xa9, 0x37, 0xa7, 0xf6, 0x72, 0xbe, 0x89, 0x81, 0xee, 0xf0, 0x3c, 0x94, 0x3a, 0x4a, 0x8e,
+  0x60, 0xc5, 0x08, 0x56, 0xb0, 0x60, 0xaf, 0x01, 0xd6, 0xa3, 0x25, 0x93, 0x61, 0x21, 0x81, 0x64,
+  0x22, 0xb7, 0x4d, 0x6e, 0x18, 0xc8, 0x78, 0x36, 0xbd, 0x75, 0xaf, 0x3f, 0x83, 0xec, 0x4d, 0xe4,
+  0x6c, 0xad, 0x59, 0xd9, 0xa5, 0x41, 0x68, 0x3d, 0xc6, 0x02, 0xa7, 0xdb, 0x18, 0x79, 0xd1, 0x42,
+  0x36, 0xda, 0x78, 0x5a, 0x64, 0x35, 0xf4, 0x53, 0x8d, 0x88, 0x58, 0x62, 0x75, 0x1e, 0xe4, 0x51,
+  0x57, 0x5c, 0xb6, 0x7b, 0x63, 0x4f, 0xe5, 0x99, 0xa5, 0xa6, 0x5a, 0xf9, 0x6c, 0x89, 0x19, 0x38,
+  0xc9, 0xed, 0x48, 0xac, 0xb8, 0x0b, 0x50, 0xd0, 0xe3, 0x6b, 0x6e, 0x59, 0x4a, 0xe6, 0x6a, 0x3f,
+  0x6d, 0x04, 0x87, 0x5e, 0xd0, 0xf6, 0xf6, 0x9d, 0x41, 0xb1, 0x8d, 0x76, 0x76, 0x20, 0xff, 0x4e,
+  0x85, 0x24, 0x4f, 0x4f, 0x3e, 0xdc, 0xc1, 0xbb, 0x2a, 0xb8, 0xb4, 0xae, 0x96, 0x5e, 0x69, 0xde,
+  0x23, 0xe2, 0x2c, 0x52, 0xab, 0x18, 0xa3, 0x28, 0xa2, 0x01, 0xf7, 0x67, 0x1b, 0x16, 0x0f, 0x60,
+  0xa2, 0x6c, 0x0a, 0xe6, 0x77, 0x76, 0xa4, 0x7a, 0x8e, 0xa1, 0x96, 0x58, 0xad, 0x6a, 0xa9, 0xb3,
+  0x8c, 0x62, 0x3f, 0x48, 0x1c, 0x63, 0x14, 0xde, 0xb7, 0x17, 0x87, 0x3e, 0x99, 0x65, 0xa6, 0x08,
+  0x54, 0xb9, 0x2a, 0xad, 0xe2, 0xac, 0x3b, 0x64, 0x6c, 0x16, 0x4f, 0x99, 0xbd, 0x58, 0x3f, 0x19,
+  0x04, 0x7b, 0x5b, 0x06, 0x4c, 0xfa, 0xb9, 0x5a, 0xbf, 0x84, 0xd3, 0x17, 0xad, 0x21, 0x89, 0xfa,
+  0x5e, 0xd0, 0xb4, 0x5a, 0xb0, 0xb3, 0xe3, 0x05, 0xfd, 0xa6, 0xb5, 0x00, 0xc4, 0xf9, 0x72, 0xdd,
+  0x4f, 0xee, 0x6d, 0x67, 0x36, 0x91, 0xb3, 0x9b, 0xc1, 0x31, 0x09, 0xe2, 0x62, 0x4c, 0x23, 0xaf,
+  0xb7, 0x30, 0xbb, 0xfd, 0x62, 0x3c, 0x72, 0x1c, 0x1a, 0xc7, 0xf3, 0xb5, 0x55, 0xc3, 0x5f, 0x6a,
+  0x0e, 0xe9, 0xd5, 0x2d, 0x81, 0xe4, 0x05, 0x3d, 0xb6, 0x01, 0xa3, 0x52, 0x7e, 0xd6, 0xe8, 0x55,
+  0x05, 0xc6, 0x84, 0x44, 0xc1, 0x06, 0x8c, 0x5e, 0xcf, 0x29, 0x5b, 0x7b, 0x02, 0x43, 0x6c, 0x59,
+  0x6d, 0x44, 0xa9, 0x57, 0xea, 0x95, 0x45, 0xba, 0x6e, 0xb1, 0x01, 0xa5, 0x5a, 0xad, 0x2e, 0xd4,
+  0x92, 0xd2, 0xc6, 0xdc, 0xda, 0xc2, 0x74, 0x8b, 0x5d, 0x9f, 0x39, 0x37, 0x73, 0x35, 0x20, 0x4d,
+  0x91, 0x02, 0x30, 0x04, 0x93, 0x29, 0x14, 0x12, 0x00, 0x0c, 0x58, 0x40, 0x53, 0x20, 0x24, 0x16,
+  0x66, 0x26, 0x58, 0x9d, 0x8b, 0x6f, 0x19, 0x54, 0xc1, 0x09, 0x74, 0x09, 0x55, 0x28, 0x72, 0x63,
+  0x60, 0x9e, 0x7e, 0x37, 0xcb, 0x2a, 0x23, 0x09, 0x58, 0xe7, 0x99, 0x54, 0xd3, 0xca, 0x67, 0x96,
+  0x73, 0x99, 0xe5, 0x85, 0xb9, 0x12, 0x10, 0xcf, 0x93, 0x74, 0x53, 0xa6, 0x33, 0x08, 0x32, 0x34,
+  0x9d, 0x2f, 0xd3, 0x4d, 0x48, 0x2f, 0xcc, 0x09, 0x04, 0xd6, 0x73, 0xb1, 0xde, 0x2a, 0xc4, 0x63,
+  0x61, 0x8a, 0x50, 0x3b, 0x2b, 0x31, 0x0b, 0x73, 0x48, 0x8a, 0xd6, 0x3c, 0x91, 0x1b, 0x91, 0xac,
+  0x24, 0x49, 0x38, 0x43, 0x63, 0x0e, 0x67, 0x29, 0xa0, 0xc8, 0x59, 0x08, 0x40, 0x25, 0x66, 0x45,
+  0xb9, 0xe8, 0xa9, 0xd0, 0x22, 0x49, 0x84, 0xca, 0x12, 0x8b, 0x83, 0x8a, 0x8c, 0x10, 0xaa, 0x4c,
+  0x04, 0x52, 0x20, 0x83, 0x71, 0x4c, 0x21, 0xe5, 0x8a, 0x02, 0xd5, 0x96, 0xa0, 0x86, 0x00, 0xcd,
+  0x96, 0x58, 0xa2, 0x69, 0xc0, 0x4c, 0x24, 0x3b, 0x69, 0x5c, 0x96, 0xce, 0xac, 0x9b, 0xce, 0xc5,
+  0xb7, 0x58, 0x25, 0x6e, 0x4a, 0x88, 0xca, 0x4e, 0x4c, 0xf3, 0x2a, 0x23, 0x5b, 0x22, 0x37, 0x05,
+  0x52, 0xdf, 0xf7, 0xc2, 0xd8, 0x8b, 0x5b, 0x93, 0x81, 0xc7, 0x69, 0x51, 0x6c, 0xd1, 0x35, 0x03,
+  0x36, 0x89, 0x48, 0xb8, 0x30, 0xb3, 0x8b, 0xcf, 0x73, 0x99, 0x00, 0x97, 0x20, 0x4e, 0x5b, 0xca,
+  0x6d, 0x29, 0xe6, 0x30, 0x14, 0x6c, 0x61, 0x26, 0x6b, 0xd6, 0x5d, 0xca, 0x27, 0x70, 0xe0, 0x2a,
+  0x5d, 0xc3, 0x96, 0x8b, 0x2e, 0x4d, 0xd1, 0x62, 0x92, 0xbb, 0x44, 0x57, 0x8d, 0xae, 0x62, 0x27,
+  0x0d, 0x2f, 0x9d, 0x92, 0x39, 0x9c, 0xe2, 0x60, 0x51, 0x33, 0x64, 0xde, 0x6a, 0x56, 0x73, 0x00,
+  0xdd, 0x5c, 0x9f, 0x27, 0x51, 0xbf, 0x4b, 0xc4, 0x21, 0xb1, 0xe4, 0x5f, 0xb3, 0xa2, 0x2f, 0x4c,
+  0xb8, 0x76, 0x9e, 0xce, 0x04, 0x2f, 0x80, 0xd3, 0x60, 0x72, 0x26, 0xb5, 0xa4, 0x48, 0x55, 0x61,
+  0x38, 0x94, 0x2c, 0x89, 0xef, 0x4c, 0xbd, 0x11, 0x0d, 0x29, 0xe1, 0xcd, 0x80, 0xa9, 0xaf, 0x6c,
+  0x5e, 0xc8, 0x62, 0x4f, 0x4e, 0x1e, 0x45, 0x3b, 0x34, 0x54, 0x04, 0xff, 0x2a, 0x4b, 0x99, 0xb8,
+  0xe2, 0x9e, 0x39, 0xd9, 0x22, 0xaf, 0xbc, 0xc7, 0xe3, 0x7e, 0x61, 0x3a, 0xf4, 0x5b, 0xc9, 0x75,
+  0xff, 0x8b, 0xf3, 0x97, 0xc5, 0x7d, 0xe3, 0x20, 0x1e, 0xf7, 0xd1, 0x74, 0xe8, 0x07, 0xb0, 0x01,
+  0xc2, 0x79, 0xd8, 0x2c, 0x95, 0x26, 0x93, 0x89, 0x39, 0xa9, 0x9a, 0x2c, 0xea, 0x97, 0x2a, 0x96,
+  0x65, 0x41, 0x41, 0x2c, 0xb7, 0x1e, 0x6c, 0x5c, 0xb5, 0xb0, 0x5a, 0x9c, 0x97, 0xdf, 0xf2, 0x66,
+  0xd2, 0xd4, 0xc6, 0x16, 0xb2, 0x50, 0x15, 0xfe, 0x8f, 0xdb, 0x07, 0x21, 0xe1, 0x03, 0xe4, 0xda,
+  0xf8, 0x7d, 0x1d, 0xed, 0x99, 0xf5, 0x41, 0xc5, 0x7a, 0x5f, 0x47, 0x65, 0xf5, 0xb7, 0x52, 0x11,
+  0x10, 0xd8, 0x56, 0x89, 0xd8, 0x0d, 0xec, 0xf2, 0x81, 0xac, 0x24, 0xc9, 0xa2, 0x6a, 0xa6, 0x96,
+  0x02, 0x80, 0x75, 0x0e, 0x09, 0x6d, 0x2c, 0xba, 0x86, 0x4b, 0xb0, 0x5a, 0x3f, 0xee, 0xb7, 0x77,
+  0xf4, 0x8c, 0x6a, 0x4b, 0xb6, 0xa1, 0xaa, 0xe1, 0xb4, 0x95, 0x39, 0x03, 0xb6, 0x9f, 0x24, 0x27,
+  0x32, 0x7f, 0xcf, 0xb2, 0x16, 0x9b, 0xd6, 0x71, 0xcd, 0xc4, 0x11, 0x9d, 0x77, 0x19, 0x68, 0x11,
+  0xe2, 0xb2, 0x49, 0xd3, 0x0b, 0xc0, 0x72, 0x5b, 0xa8, 0x58, 0x0f, 0xa7, 0xc8, 0x42, 0xbf, 0x34,
+  0xf6, 0x7b, 0x8b, 0xcc, 0xba, 0x66, 0xa2, 0x1a, 0xea, 0x7f, 0x6b, 0x0d, 0xbd, 0xa0, 0x98, 0xa4,
+  0x2c, 0x31, 0xc3, 0xa7, 0x2a, 0x5d, 0xb1, 0x20, 0xbd, 0x56, 0x69, 0xb1, 0x2c, 0xaa, 0xb4, 0xe0,
+  0x74, 0x66, 0xaf, 0xb6, 0xd8, 0xbc, 0x5a, 0x9a, 0x21, 0x6a, 0x4d, 0x35, 0x37, 0xf6, 0x7b, 0xb5,
+  0x0d, 0xd5, 0xd6, 0x93, 0x6a, 0x05, 0xad, 0x62, 0x35, 0x72, 0x50, 0x96, 0x97, 0x91, 0x53, 0x2d,
+  0xd5, 0xba, 0xb3, 0x36, 0x71, 0x2c, 0x2f, 0xd1, 0x0c, 0xe1, 0x14, 0xc5, 0xcc, 0xf7, 0x5c, 0x49,
+  0x62, 0x2b, 0xa7, 0x6f, 0xd6, 0x4f, 0x38, 0xfd, 0xa5, 0x0e, 0xe8, 0x8b, 0x78, 0x49, 0xdd, 0x96,
+  0x3d, 0xf9, 0x68, 0x5b, 0x86, 0xfa, 0xfe, 0x44, 0x89, 0xfb, 0x31, 0xf0, 0x67, 0x76, 0x79, 0x09,
+  0x89, 0xe1, 0xf2, 0xb1, 0x6b, 0x57, 0x12, 0xc8, 0x59, 0xe8, 0xd9, 0xd5, 0x24, 0x71, 0x12, 0x8c,
+  0x89, 0xef, 0xb9, 0x76, 0x7a, 0x57, 0xa7, 0xa5, 0x0e, 0xe9, 0xc8, 0x46, 0xe7, 0xc2, 0x97, 0x82,
+  0x9b, 0xbc, 0x99, 0x83, 0x3a, 0x54, 0x9e, 0x7d, 0x26, 0x70, 0xe9, 0x65, 0x83, 0xfb, 0xc5, 0x69,
+  0xcc, 0x35, 0x0c, 0xff, 0xc5, 0xba, 0x41, 0xcd, 0x60, 0xfd, 0xfa, 0x32, 0x79, 0xe8, 0xfa, 0x32,
+  0xd9, 0x78, 0x7d, 0xd9, 0x0c, 0xf4, 0x39, 0x29, 0xd8, 0x2b, 0x77, 0x98, 0xb8, 0x9e, 0xbb, 0x91,
+  0xbd, 0x50, 0x35, 0x93, 0x82, 0x8d, 0x0f, 0xc2, 0x88, 0xb6, 0x71, 0x61, 0xf5, 0x52, 0x96, 0x21,
+  0xae, 0x0d, 0x56, 0xf4, 0x02, 0x3e, 0x28, 0x09, 0x0c, 0x83, 0x2c, 0x56, 0xbd, 0x2f, 0x75, 0x94,
+  0x7c, 0xb5, 0x6f, 0x13, 0xe2, 0xdf, 0x9c, 0x0f, 0x22, 0x36, 0xea, 0xcb, 0xfb, 0xdd, 0xf9, 0x3b,
+  0x23, 0x5e, 0x4f, 0x5b, 0xb9, 0x20, 0xa3, 0x2e, 0x29, 0xc0, 0x1d, 0xc0, 0xe4, 0xa0, 0xb7, 0xfc,
+  0x0b, 0x97, 0x27, 0x0d, 0x79, 0x75, 0x26, 0x41, 0x5a, 0xbd, 0x9c, 0x45, 0xf3, 0x97, 0xb3, 0xe6,
+  0x02, 0xab, 0xa9, 0xb0, 0x17, 0x3a, 0xdc, 0x57, 0x05, 0x96, 0x2c, 0x04, 0xbf, 0xa9, 0x3e, 0x5f,
+  0x2c, 0xef, 0x07, 0xc2, 0x35, 0x5b, 0x53, 0xae, 0x52, 0xa8, 0xfb, 0x8d, 0x70, 0x03, 0x08, 0x00,
+  0xcf, 0xd3, 0x0b, 0xfd, 0xcd, 0xf4, 0xc6, 0x63, 0x9a, 0x87, 0x2f, 0x62, 0x1a, 0xe1, 0x26, 0x3e,
+  0x9b, 0xc5, 0x9c, 0x0e, 0x71, 0x7a, 0xff, 0x9e, 0xfa, 0x66, 0x38, 0x8a, 0x07, 0x70, 0xe3, 0x74,
+  0x43, 0xfc, 0x9c, 0x06, 0x7d, 0xea, 0x0a, 0xfe, 0x72, 0x34, 0x64, 0x7a, 0x95, 0xb5, 0xfa, 0x62,
+  0x8d, 0x8b, 0xd4, 0x20, 0xf6, 0xb2, 0xb1, 0xcc, 0x4d, 0x68, 0xb1, 0x9d, 0x9e, 0x88, 0x9b, 0xf0,
+  0x85, 0xbd, 0x9e, 0x46, 0x6c, 0xb8, 0x01, 0x69, 0x10, 0x3d, 0x19, 0x6a, 0x79, 0xbd, 0x38, 0xd8,
+  0xde, 0xd6, 0x54, 0x35, 0x1b, 0x1a, 0xe0, 0x66, 0x00, 0x45, 0xd2, 0x32, 0x8b, 0x45, 0xfe, 0xfa,
+  0xf7, 0x7c, 0x73, 0xc1, 0xdc, 0xf8, 0xae, 0x0f, 0xd0, 0xea, 0x15, 0x72, 0x7d, 0x91, 0x5c, 0xbd,
+  0xcb, 0x4a, 0xf9, 0x23, 0xaa, 0x16, 0x57, 0x72, 0x43, 0xcf, 0x35, 0xa8, 0xb8, 0x38, 0x9a, 0xf6,
+  0x8d, 0x42, 0x9d, 0x2b, 0x97, 0x67, 0x15, 0x43, 0x78, 0x8b, 0xab, 0x3b, 0xf9, 0x71, 0x05, 0xdb,
+  0xf6, 0x86, 0xfb, 0xe2, 0xe2, 0x32, 0xee, 0x73, 0x1c, 0x8e, 0xa2, 0xd0, 0xa7, 0xb8, 0xa9, 0x90,
+  0xab, 0xf7, 0x22, 0x8b, 0x3b, 0x1f, 0x4d, 0xdc, 0x8f, 0xe0, 0xae, 0x8a, 0xb8, 0xdc, 0xe6, 0xd9,
+  0x22, 0x54, 0x3d, 0x92, 0x07, 0x17, 0x34, 0x5c, 0x81, 0x8b, 0x54, 0x91, 0x7d, 0xcf, 0xfd, 0xf4,
+  0x03, 0xbb, 0x66, 0x3d, 0xaf, 0x34, 0x6b, 0x86, 0x7f, 0x1f, 0x56, 0x29, 0x32, 0x62, 0x79, 0x7d,
+  0x7d, 0xe8, 0x05, 0x1a, 0x35, 0x85, 0xb9, 0x29, 0x45, 0x06, 0x35, 0xa5, 0x29, 0x2c, 0x69, 0x7e,
+  0xa1, 0xa2, 0xeb, 0x46, 0x60, 0x97, 0xad, 0xdd, 0xd8, 0x60, 0xb6, 0xbf, 0x1b, 0x1b, 0xae, 0x2c,
+  0xd1, 0xf3, 0x19, 0x8b, 0xb4, 0xa4, 0x50, 0x31, 0xd0, 0x4b, 0x15, 0xdd, 0x70, 0xe0, 0xb5, 0x0b,
+  0xcf, 0x74, 0x7c, 0x4a, 0xa2, 0x4f, 0x70, 0x6f, 0xcd, 0x32, 0x2c, 0x43, 0xa1, 0xa4, 0xb5, 0xea,
+  0x86, 0x63, 0x4e, 0x6d, 0xd7, 0x70, 0xcc, 0x99, 0x1d, 0x1b, 0x9e, 0xd9, 0xa5, 0x7d, 0x2f, 0x38,
+  0x25, 0x7c, 0xa0, 0xe9, 0x86, 0x07, 0xcb, 0x60, 0xfe, 0x99, 0x38, 0x2a, 0xc1, 0x55, 0x4a, 0x54,
+  0xe4, 0x98, 0x53, 0x28, 0x60, 0x04, 0x06, 0xcb, 0x63, 0x89, 0x1b, 0x35, 0x70, 0x41, 0x06, 0x1b,
+  0x15, 0xdb, 0x8e, 0x9e, 0xe7, 0xcb, 0x14, 0xca, 0x66, 0x7d, 0x37, 0x36, 0x2c, 0x63, 0x6f, 0x37,
+  0x36, 0xaa, 0xbb, 0xb1, 0xde, 0x5c, 0xc9, 0xaf, 0xa8, 0xfc, 0xba, 0xca, 0xcf, 0xd7, 0x0d, 0x27,
+  0xf2, 0xef, 0xab, 0xd7, 0x31, 0x67, 0x85, 0xea, 0x6e, 0x2c, 0x6a, 0xdf, 0xbb, 0xb3, 0xf6, 0x04,
+  0xab, 0x2e, 0xff, 0xd5, 0xd7, 0xfb, 0xcc, 0x02, 0x6e, 0x8b, 0x1a, 0x0b, 0x18, 0x4c, 0x26, 0x84,
+  0x7f, 0x38, 0x4f, 0x49, 0xd7, 0x27, 0xce, 0x0d, 0xc0, 0x40, 0x02, 0x3a, 0xe0, 0xd4, 0xda, 0x58,
+  0x1d, 0xb9, 0x50, 0x88, 0xb0, 0x81, 0xaf, 0xdd, 0x25, 0x55, 0xc0, 0xf2, 0x42, 0x42, 0x4b, 0x03,
+  0x68, 0x80, 0x4e, 0x6d, 0x6f, 0x6b, 0x9b, 0x1b, 0xc9, 0x75, 0xa2, 0xa1, 0x8a, 0x95, 0x2b, 0xbb,
+  0xb1, 0x51, 0x51, 0x7d, 0x58, 0x63, 0x14, 0x9d, 0xad, 0x15, 0xac, 0x8a, 0xde, 0xb3, 0xa2, 0xe0,
+  0xac, 0xe0, 0xae, 0x90, 0xe6, 0x51, 0xe6, 0xb5, 0x01, 0xf9, 0x2a, 0x45, 0x24, 0x1e, 0xa1, 0xc8,
+  0x3f, 0xbe, 0xe0, 0x8b, 0x27, 0x16, 0xc4, 0x34, 0x13, 0xd6, 0x2f, 0x9e, 0x78, 0x70, 0x43, 0x70,
+  0x43, 0x07, 0xd3, 0x27, 0x2b, 0x46, 0x57, 0xfa, 0xdc, 0x81, 0xd3, 0x15, 0x56, 0xd3, 0xb7, 0x2f,
+  0xf7, 0xf6, 0x8d, 0xf2, 0x5e, 0xd5, 0xa8, 0x5b, 0x57, 0x2d, 0x71, 0xea, 0xab, 0x25, 0xb2, 0xca,
+  0x90, 0x55, 0x29, 0xef, 0x1b, 0xe5, 0xea, 0x33, 0xa3, 0xf6, 0x2c, 0x97, 0x57, 0x81, 0xbc, 0x72,
+  0xbd, 0x61, 0xd4, 0x2d, 0xa3, 0x52, 0x6b, 0x24, 0x79, 0xae, 0x54, 0x9d, 0x22, 0xf3, 0x59, 0xc5,
+  0xa8, 0xed, 0x1b, 0xd5, 0xfd, 0xab, 0x45, 0xb6, 0xfb, 0xd7, 0xc2, 0x7b, 0x7f, 0x3a, 0x87, 0x25,
+  0x8f, 0x85, 0x01, 0x7f, 0xcb, 0xea, 0x6f, 0x45, 0xfc, 0x25, 0x97, 0xa3, 0x42, 0xfd, 0x6a, 0xa1,
+  0x5f, 0x0b, 0x99, 0xd7, 0x78, 0xc1, 0xac, 0xeb, 0xbb, 0x71, 0x61, 0x55, 0xf8, 0x61, 0x5a, 0x58,
+  0xe2, 0x1e, 0x27, 0x0c, 0xce, 0x8f, 0x1f, 0xf4, 0xc0, 0x2e, 0x6f, 0x6f, 0xd7, 0x40, 0xfa, 0x34,
+  0xaa, 0xca, 0xb8, 0xcd, 0x4a, 0x3e, 0x5d, 0xd8, 0xdf, 0x8d, 0x9b, 0x99, 0x24, 0x8c, 0x96, 0x67,
+  0x92, 0xc8, 0x49, 0xa7, 0x8c, 0x59, 0x13, 0x12, 0x5e, 0x91, 0x2f, 0x2f, 0x9c, 0x9e, 0x24, 0x43,
+  0xa7, 0xdd, 0x21, 0x88, 0x7f, 0x86, 0x1c, 0x8e, 0x0c, 0xd5, 0x7a, 0x21, 0x2e, 0xd5, 0x74, 0x63,
+  0x54, 0x28, 0x2c, 0x16, 0xcb, 0x1b, 0xa7, 0x6b, 0x5a, 0x7c, 0xae, 0x46, 0x57, 0x5a, 0x41, 0x39,
+  0x8a, 0xe2, 0x50, 0x2d, 0x6e, 0x2a, 0x2d, 0x2c, 0x1e, 0x99, 0xa1, 0x53, 0xfe, 0x99, 0x44, 0x1e,
+  0xc4, 0x51, 0x70, 0xb1, 0x5b, 0x60, 0x39, 0x03, 0xea, 0xdc, 0x74, 0xd9, 0x34, 0x87, 0x79, 0xa4,
+  0x80, 0x6b, 0xd8, 0x11, 0x1c, 0x62, 0xcf, 0xa1, 0x7e, 0x02, 0xc8, 0x1a, 0x5e, 0x77, 0xc4, 0x39,
+  0x0b, 0x72, 0x88, 0x87, 0x02, 0xb4, 0x86, 0xa9, 0x6e, 0x91, 0x65, 0x31, 0xe5, 0x21, 0x86, 0x35,
+  0xcc, 0x30, 0x62, 0x7d, 0xb8, 0x76, 0x90, 0xc3, 0x3d, 0x55, 0xc0, 0xf5, 0x7e, 0x91, 0x60, 0x4c,
+  0xf2, 0xb8, 0x47, 0x02, 0xb4, 0x8e, 0xc9, 0x58, 0xe4, 0x56, 0x5f, 0xe4, 0x51, 0x25, 0x6c, 0x0d,
+  0x57, 0xc4, 0xa0, 0x79, 0xa6, 0x02, 0x24, 0x8b, 0x97, 0x88, 0x7b, 0x06, 0x27, 0x93, 0xbd, 0x58,
+  0x48, 0xef, 0x34, 0x01, 0x89, 0xdb, 0x7e, 0x3c, 0x1a, 0x89, 0x93, 0x45, 0x54, 0xd9, 0xf0, 0xb1,
+  0xca, 0xb4, 0x95, 0x3f, 0x02, 0xfb, 0xe4, 0xe2, 0x85, 0x8a, 0x5c, 0x2e, 0x18, 0xdb, 0x02, 0x36,
+  0x71, 0x21, 0x0f, 0xf5, 0x5c, 0x7d, 0x91, 0x75, 0x75, 0xed, 0xeb, 0x03, 0x2f, 0x08, 0x47, 0x1c,
+  0xc9, 0x45, 0xfc, 0xc7, 0x55, 0xb1, 0xc0, 0x28, 0xdd, 0x22, 0xca, 0x65, 0xc9, 0x0d, 0xa3, 0x64,
+  0x47, 0xe1, 0x8e, 0x5c, 0x75, 0xf9, 0x71, 0x35, 0x57, 0xba, 0x7d, 0x70, 0x2e, 0x59, 0x10, 0xd4,
+  0xbe, 0x4e, 0xdc, 0xa2, 0xeb, 0x83, 0x30, 0xbd, 0x40, 0xa9, 0x8e, 0x16, 0xc8, 0xeb, 0xb7, 0x4f,
+  0xe7, 0xc9, 0x2d, 0xf6, 0xf5, 0x3e, 0x26, 0x57, 0x74, 0xf3, 0x05, 0x9f, 0xce, 0xe9, 0x62, 0xa5,
+  0xaa, 0xb0, 0x7d, 0x6d, 0x70, 0x61, 0x58, 0xc1, 0xc7, 0x62, 0xc1, 0xc5, 0x89, 0x7d, 0xf9, 0x38,
+  0x2e, 0x5c, 0x65, 0x9d, 0xc5, 0xec, 0xa3, 0x0b, 0x5c, 0xbd, 0xef, 0x90, 0xe2, 0x4a, 0xbf, 0xfe,
+  0x3a, 0x3d, 0x22, 0xf7, 0x68, 0x3e, 0xff, 0x73, 0x79, 0x64, 0x39, 0x70, 0xbd, 0x31, 0x6e, 0x5f,
+  0x2f, 0x75, 0x7b, 0xfa, 0x30, 0xc7, 0x4a, 0x33, 0xeb, 0x4e, 0x5c, 0x2e, 0x7c, 0x10, 0x71, 0x83,
+  0xd8, 0x8a, 0xc1, 0x69, 0x28, 0xb1, 0xe1, 0xcd, 0x86, 0x54, 0xb2, 0x94, 0xeb, 0x26, 0xb8, 0x99,
+  0x8c, 0x48, 0x9a, 0x09, 0x2f, 0x97, 0xd0, 0x80, 0x7f, 0x80, 0xcf, 0xfc, 0x31, 0x38, 0x2c, 0x0a,
+  0x60, 0xbd, 0x45, 0x9e, 0x93, 0xe5, 0x11, 0x38, 0x5b, 0x55, 0xd4, 0xdc, 0x58, 0x43, 0xba, 0xdd,
+  0x63, 0x5f, 0xa7, 0x23, 0xac, 0x0a, 0xa4, 0xe3, 0x79, 0x5d, 0xb8, 0xbf, 0xe8, 0xe2, 0x5f, 0x8a,
+  0x51, 0xb6, 0xb7, 0x65, 0x72, 0xd9, 0x86, 0x02, 0x6b, 0x2b, 0x90, 0x34, 0xa8, 0x31, 0xa8, 0xa9,
+  0x2e, 0xba, 0xfd, 0x0c, 0x73, 0x54, 0x11, 0x60, 0xcf, 0x8f, 0x1f, 0x1a, 0xb1, 0x9d, 0xe3, 0x0c,
+  0xcc, 0xd8, 0x58, 0x03, 0x09, 0x43, 0x1a, 0xb8, 0x47, 0x70, 0x14, 0x55, 0x23, 0xba, 0x6e, 0xe4,
+  0xb9, 0xaa, 0x0a, 0x2f, 0xc4, 0x58, 0xc9, 0x77, 0x88, 0x04, 0x35, 0x2d, 0x62, 0xff, 0xc4, 0xe3,
+  0x65, 0xea, 0x95, 0x2e, 0xdc, 0xbc, 0x56, 0x8b, 0x4c, 0x4f, 0xe7, 0x77, 0xbd, 0xea, 0xb3, 0x28,
+  0x41, 0x2b, 0xa5, 0x6b, 0x63, 0xf5, 0x7d, 0x03, 0x62, 0x48, 0x02, 0xf2, 0x53, 0xc0, 0x58, 0x09,
+  0x8f, 0x25, 0x4e, 0xf6, 0xf5, 0x1b, 0xa2, 0xab, 0x82, 0x66, 0x40, 0x27, 0xf6, 0x13, 0x2b, 0xf7,
+  0x0a, 0x01, 0xce, 0x08, 0xa8, 0xbc, 0x1b, 0xa5, 0x36, 0xed, 0xb0, 0x88, 0x27, 0x54, 0x49, 0x11,
+  0x9f, 0xac, 0xc4, 0x3d, 0xd4, 0xde, 0xc1, 0x62, 0xa4, 0x70, 0x73, 0xa7, 0xb0, 0xfe, 0x80, 0xd4,
+  0x1c, 0xab, 0x9b, 0xcb, 0xb4, 0x60, 0x63, 0x03, 0x61, 0x3d, 0x3f, 0xa7, 0x97, 0xb3, 0x22, 0x43,
+  0xe9, 0xf5, 0xfc, 0x27, 0x14, 0x65, 0x73, 0x0e, 0x3a, 0x27, 0x1d, 0xdc, 0x26, 0x7e, 0x3a, 0xcf,
+  0x51, 0x60, 0x72, 0x76, 0x26, 0x22, 0x77, 0xad, 0xda, 0xd0, 0xcd, 0x18, 0xd6, 0x4c, 0xb4, 0x8a,
+  0xbe, 0xc0, 0x8b, 0xc5, 0xb5, 0x9e, 0x9a, 0x83, 0xac, 0x69, 0x46, 0x74, 0xca, 0x69, 0xe0, 0x66,
+  0x6c, 0xc4, 0x4a, 0x9c, 0x17, 0x8f, 0x42, 0x1a, 0xe5, 0x03, 0xb7, 0xeb, 0x84, 0x05, 0x8f, 0x6d,
+  0xfd, 0x3a, 0x6d, 0x7a, 0xd5, 0xd6, 0xaf, 0x37, 0x9f, 0x7b, 0x40, 0x41, 0x69, 0x14, 0x49, 0x43,
+  0x26, 0xe7, 0x3f, 0xdd, 0xca, 0xa4, 0x66, 0x24, 0x7b, 0x94, 0x58, 0xba, 0x33, 0x43, 0xf1, 0x48,
+  0x80, 0x3a, 0x4f, 0x7c, 0xad, 0xaf, 0x2a, 0x3f, 0x49, 0x7b, 0x1e, 0xb8, 0x9c, 0x92, 0x89, 0x86,
+  0xd8, 0xa4, 0x19, 0x44, 0xed, 0xd4, 0x4d, 0xf2, 0x32, 0xf3, 0x18, 0x0e, 0xb0, 0x70, 0x1a, 0x0d,
+  0xbd, 0x80, 0x70, 0x6a, 0x17, 0xe1, 0x1d, 0x32, 0xa5, 0x3f, 0x16, 0x0f, 0x8f, 0x5e, 0x46, 0x80,
+  0xf3, 0x0f, 0xaf, 0x1d, 0x98, 0xd5, 0xea, 0xf3, 0x62, 0xb9, 0xb9, 0x02, 0x6c, 0x34, 0x9e, 0x5b,
+  0xcd, 0xf2, 0x52, 0x7a, 0x72, 0x3e, 0xd8, 0x7f, 0xa1, 0xf1, 0x1b, 0x7a, 0x81, 0x8d, 0x2d, 0x8c,
+  0x86, 0x64, 0x6a, 0xe3, 0x4a, 0xbd, 0xfe, 0x73, 0x23, 0xfa, 0x73, 0x76, 0x34, 0x1a, 0xa7, 0xc7,
+  0x25, 0x57, 0x1c, 0x8e, 0x9f, 0x92, 0x83, 0x96, 0x54, 0xf1, 0x8f, 0x77, 0xb6, 0x0a, 0x18, 0x9a,
+  0xd6, 0x5b, 0x64, 0x5d, 0x6e, 0xf2, 0x0a, 0xfc, 0x8f, 0x48, 0x43, 0xee, 0x69, 0xbc, 0xfa, 0x8a,
+  0x66, 0x4b, 0x87, 0x3f, 0xef, 0x59, 0xff, 0x55, 0xe6, 0xef, 0xd2, 0x4b, 0xbc, 0xdb, 0xc7, 0xcb,
+  0xfa, 0x8a, 0x8f, 0xe0, 0x1c, 0xc6, 0x29, 0x4f, 0xf2, 0x31, 0xc4, 0x1f, 0xe6, 0x89, 0x7a, 0xf7,
+  0xe5, 0x27, 0x99, 0xa2, 0xfa, 0xad, 0x42, 0x9b, 0x76, 0xfa, 0xd6, 0xc7, 0xba, 0x08, 0xc2, 0x9b,
+  0x56, 0x8f, 0xd4, 0x46, 0xf2, 0xf9, 0x90, 0x58, 0x85, 0x08, 0x41, 0xde, 0x9d, 0x52, 0xaf, 0x38,
+  0x91, 0xcc, 0xd2, 0x80, 0x5a, 0x71, 0x4e, 0x8a, 0x6d, 0x28, 0x05, 0x0e, 0x6b, 0xee, 0xb9, 0x92,
+  0xa7, 0x73, 0x52, 0x28, 0x2c, 0x60, 0x1a, 0x2d, 0xd2, 0xe7, 0x4a, 0xae, 0x5b, 0xab, 0x8e, 0xd1,
+  0xa6, 0x39, 0xb6, 0x71, 0x29, 0x52, 0xd2, 0x0f, 0x0f, 0xed, 0x65, 0x14, 0xa8, 0xe7, 0xbb, 0x1f,
+  0xc4, 0xb1, 0x5f, 0x79, 0x3c, 0x62, 0x7b, 0x7b, 0xe3, 0x0c, 0x50, 0x54, 0xe3, 0xe6, 0x25, 0xa6,
+  0x5e, 0x80, 0x0d, 0x7c, 0x3b, 0xa1, 0x1e, 0x36, 0xb0, 0x1b, 0x51, 0x0f, 0x5f, 0xed, 0xe8, 0xc6,
+  0x4f, 0x6b, 0x51, 0x6b, 0x83, 0x12, 0x2d, 0x37, 0x2b, 0xcb, 0x59, 0xb4, 0x1a, 0x49, 0xfe, 0x61,
+  0x99, 0x49, 0xe2, 0x54, 0xa9, 0xf6, 0x56, 0xc5, 0x66, 0x48, 0xa6, 0x0b, 0xfc, 0x07, 0x05, 0x2a,
+  0x8d, 0x80, 0xe1, 0xd5, 0x18, 0xf5, 0xdd, 0xce, 0x58, 0xf2, 0x5c, 0x7c, 0xfb, 0x38, 0xfa, 0xf3,
+  0x8d, 0x81, 0x8f, 0x95, 0x18, 0xbc, 0x1c, 0x50, 0xb9, 0x6c, 0x09, 0xdf, 0x73, 0xfd, 0x95, 0x91,
+  0xf6, 0x1f, 0xec, 0xd2, 0x9d, 0x96, 0x40, 0xd6, 0xfa, 0x48, 0xad, 0x7d, 0x8f, 0xf8, 0xc1, 0xf4,
+  0xb1, 0xed, 0x4d, 0xdd, 0xdc, 0x28, 0x42, 0x90, 0x85, 0x9b, 0xf8, 0xe5, 0x3f, 0x43, 0x12, 0x50,
+  0xbf, 0x32, 0xad, 0x14, 0xcb, 0x8d, 0x69, 0xb9, 0x21, 0x5f, 0xb4, 0x7d, 0x40, 0xee, 0x70, 0x50,
+  0x22, 0x78, 0x67, 0xe9, 0xd3, 0x65, 0x57, 0x06, 0xfe, 0xb0, 0x34, 0xc9, 0x53, 0x7a, 0x7f, 0x32,
+  0x73, 0x45, 0xa5, 0x8f, 0xd3, 0xa9, 0x77, 0xf5, 0x6e, 0x65, 0x85, 0xe4, 0x8f, 0x6b, 0xd8, 0x9f,
+  0x36, 0xf5, 0x0f, 0x76, 0x4f, 0x1a, 0x32, 0x69, 0x99, 0x82, 0xd1, 0xb0, 0x0b, 0x77, 0xd5, 0x42,
+  0xb8, 0x41, 0x3e, 0x60, 0xbe, 0x4b, 0x23, 0x1b, 0x4f, 0x61, 0xff, 0xfa, 0x41, 0xac, 0xd9, 0xa3,
+  0xb0, 0x6e, 0xe5, 0x5e, 0xf8, 0x9f, 0xef, 0x69, 0x26, 0x8a, 0xf2, 0xd2, 0xba, 0xca, 0x47, 0xa4,
+  0xe6, 0xd4, 0xd8, 0x88, 0x57, 0x5e, 0xc5, 0x9b, 0x6d, 0xc6, 0xab, 0xac, 0xe2, 0xdd, 0x3e, 0x46,
+  0x0e, 0xd2, 0x08, 0x63, 0x8e, 0xa7, 0xb8, 0xf9, 0x74, 0x5e, 0x6d, 0x58, 0x79, 0x7f, 0x64, 0x61,
+  0x20, 0x3c, 0xbb, 0x33, 0xe7, 0x76, 0x73, 0xce, 0xe2, 0x7a, 0xf3, 0xab, 0x51, 0x62, 0x29, 0x20,
+  0x7f, 0x12, 0xa7, 0x11, 0x4e, 0xd5, 0xa1, 0xaf, 0x31, 0x89, 0xb4, 0xdc, 0x9b, 0x34, 0xfa, 0x42,
+  0x45, 0x5f, 0x73, 0x79, 0xec, 0x00, 0xea, 0x68, 0x7a, 0x9c, 0xf8, 0x9e, 0x93, 0x1c, 0xf4, 0xf1,
+  0x69, 0x6f, 0xbd, 0x8a, 0xdc, 0x03, 0x36, 0xfa, 0x42, 0x8c, 0x75, 0xf6, 0xa0, 0x99, 0x85, 0xac,
+  0x1c, 0xfe, 0xf2, 0xf5, 0x12, 0x3d, 0x73, 0xc0, 0x41, 0x9c, 0x07, 0x82, 0xc5, 0x9b, 0x79, 0xb6,
+  0xad, 0x8a, 0xf5, 0x97, 0xdf, 0xa3, 0x4f, 0xd7, 0x9b, 0xd3, 0x1d, 0x57, 0x35, 0x8f, 0x71, 0x7a,
+  0xf5, 0x12, 0x2f, 0x17, 0xa5, 0xf3, 0xef, 0x88, 0xdf, 0xfd, 0xd0, 0x5e, 0xb2, 0x44, 0x26, 0x15,
+  0x3c, 0x1c, 0x39, 0x4d, 0xef, 0xf6, 0xa6, 0xc7, 0x6a, 0x48, 0x37, 0x66, 0xfe, 0x88, 0xd3, 0x56,
+  0xf6, 0x14, 0x1b, 0x6e, 0xa3, 0x7f, 0x4c, 0xab, 0xce, 0x93, 0x62, 0x71, 0xc3, 0xe9, 0x09, 0xf9,
+  0xb2, 0x4e, 0xb1, 0xf8, 0x8f, 0x69, 0x95, 0xaa, 0x17, 0xd6, 0xc2, 0xf6, 0x81, 0x5c, 0x86, 0xce,
+  0x34, 0x27, 0x5d, 0xe5, 0x32, 0xe8, 0x40, 0x99, 0x27, 0xde, 0x5f, 0x7b, 0xb0, 0x40, 0xe5, 0x67,
+  0x0b, 0x54, 0x37, 0x17, 0x48, 0x95, 0x9d, 0xc4, 0x85, 0x89, 0x85, 0xd5, 0x03, 0x09, 0x36, 0xe6,
+  0x11, 0xbc, 0x55, 0xa7, 0x74, 0x09, 0x14, 0x90, 0x8b, 0x78, 0x3b, 0x6b, 0x2c, 0x56, 0x8e, 0x63,
+  0x79, 0xc3, 0x9b, 0xdc, 0x6b, 0xcf, 0x5d, 0x8b, 0x45, 0xcf, 0x1f, 0x3f, 0x34, 0x95, 0xbf, 0x7c,
+  0x06, 0x1b, 0x5e, 0x60, 0x57, 0xa9, 0xea, 0x0b, 0x78, 0x45, 0xdb, 0xf8, 0xc9, 0x17, 0xb1, 0x93,
+  0x73, 0x0a, 0x4f, 0xac, 0xe4, 0xa3, 0xbc, 0xa4, 0x54, 0x61, 0x55, 0x5e, 0x88, 0xd7, 0x30, 0x03,
+  0x49, 0xe3, 0xc6, 0x6d, 0x58, 0xdf, 0xae, 0x03, 0x8d, 0x0f, 0x6f, 0x7a, 0x06, 0x99, 0x55, 0xaf,
+  0x0d, 0xbb, 0xae, 0x32, 0x7b, 0xa5, 0x54, 0x02, 0x4d, 0xea, 0x20, 0x1b, 0xf7, 0x5e, 0xe3, 0xdd,
+  0x6c, 0x61, 0xd8, 0x88, 0x05, 0x8a, 0x14, 0x8c, 0x8d, 0x78, 0x38, 0xe2, 0xb1, 0xd8, 0x5d, 0x1b,
+  0x93, 0x08, 0x45, 0xe0, 0x56, 0xaf, 0xe4, 0x79, 0x3d, 0x2d, 0x32, 0xe5, 0x83, 0xd5, 0x29, 0x9e,
+  0x78, 0x56, 0x39, 0x85, 0xf2, 0x4b, 0xff, 0xaa, 0xc0, 0x2f, 0xfd, 0x42, 0x59, 0xfe, 0xa9, 0x5c,
+  0xb5, 0x2b, 0xd6, 0xca, 0xf6, 0x21, 0xec, 0x82, 0x69, 0x4f, 0xe7, 0x80, 0x0a, 0x9b, 0x5e, 0x12,
+  0x3b, 0xf9, 0xaa, 0x88, 0xed, 0xaf, 0xd5, 0xfd, 0x26, 0xd8, 0xa6, 0x62, 0x97, 0xd6, 0xd5, 0x6e,
+  0x5c, 0x2a, 0x5b, 0x05, 0x62, 0xb0, 0xcb, 0xb2, 0xfc, 0xbe, 0x67, 0xd3, 0x4a, 0x37, 0xfc, 0x82,
+  0x5d, 0x15, 0xaf, 0x00, 0xa3, 0xdc, 0x0a, 0x5c, 0x3a, 0x66, 0xe2, 0xe5, 0x69, 0x79, 0xd2, 0x01,
+  0x0e, 0x52, 0xfb, 0xd4, 0x8d, 0x71, 0xc2, 0x7e, 0xf5, 0x57, 0x9e, 0x64, 0x78, 0x7c, 0x1d, 0x8a,
+  0x53, 0x9b, 0xab, 0x09, 0x96, 0x2e, 0xa6, 0x78, 0x67, 0x79, 0x01, 0x43, 0x1c, 0x51, 0xb8, 0xc8,
+  0x0d, 0x0f, 0xf3, 0xc2, 0x51, 0x97, 0xd8, 0xa1, 0x01, 0x55, 0x8f, 0x65, 0x93, 0x21, 0x8d, 0xd4,
+  0x51, 0x0a, 0x60, 0xb4, 0x12, 0x5b, 0xf5, 0xeb, 0x10, 0xa2, 0x28, 0xfc, 0x5a, 0x47, 0xcc, 0x93,
+  0xb2, 0xe2, 0x0c, 0x61, 0x4c, 0x1d, 0xf5, 0xd8, 0xf6, 0x90, 0x8d, 0x62, 0x7a, 0x2a, 0x4f, 0x16,
+  0xca, 0x32, 0xab, 0x52, 0x5b, 0x4d, 0xa5, 0xd6, 0x1b, 0xc2, 0x6f, 0xe1, 0xc0, 0x83, 0x87, 0x11,
+  0xa5, 0x58, 0xbd, 0xbb, 0xea, 0xd9, 0xed, 0x79, 0x5a, 0xc4, 0xd7, 0xd4, 0xb2, 0x70, 0x20, 0x85,
+  0xfb, 0x10, 0x94, 0x92, 0x17, 0xf4, 0x8f, 0x7c, 0x78, 0x6f, 0x4e, 0x88, 0xb3, 0xde, 0xca, 0x36,
+  0xf9, 0xe3, 0x87, 0x96, 0xa7, 0x80, 0x4e, 0x90, 0x67, 0x7e, 0x16, 0xcb, 0xc6, 0x15, 0x3d, 0x47,
+  0x9d, 0x39, 0xb5, 0x35, 0x78, 0xbb, 0x11, 0x6a, 0xfa, 0x5a, 0x0c, 0x4c, 0xb0, 0x2b, 0x7a, 0x29,
+  0x90, 0x62, 0xba, 0x5b, 0x29, 0x96, 0xf3, 0xd8, 0x33, 0xbb, 0x98, 0xa2, 0xff, 0x56, 0x0c, 0x4c,
+  0xce, 0x42, 0xc0, 0x96, 0xb2, 0xbf, 0x5b, 0x29, 0x94, 0x5b, 0x72, 0x33, 0x58, 0x28, 0x82, 0x8c,
+  0xf6, 0xd5, 0xef, 0xa4, 0x7b, 0xd9, 0xfa, 0x81, 0x2f, 0x5a, 0xff, 0xf1, 0x23, 0x85, 0xb4, 0x7d,
+  0x53, 0xd8, 0xe5, 0x25, 0xe8, 0xb7, 0x03, 0x1f, 0xda, 0xcc, 0x00, 0xda, 0xbe, 0x29, 0x4f, 0xb2,
+  0xe9, 0xc9, 0xcb, 0x91, 0xb9, 0x66, 0x85, 0xd6, 0x37, 0x95, 0x8a, 0xb7, 0xb1, 0xd0, 0xf1, 0x99,
+  0x77, 0x75, 0xa3, 0xe5, 0xa9, 0x92, 0x88, 0x8e, 0x69, 0x90, 0x9c, 0xc1, 0xd1, 0xf2, 0xef, 0xd7,
+  0x62, 0x78, 0x2d, 0x60, 0x14, 0xd3, 0x17, 0x6c, 0x02, 0x2f, 0x6f, 0x2f, 0x87, 0x5b, 0xcf, 0x7c,
+  0xce, 0xef, 0x6a, 0x1d, 0x7a, 0x05, 0xab, 0xeb, 0xb2, 0x53, 0xb0, 0x6d, 0x8b, 0x8d, 0xbb, 0x70,
+  0x39, 0x0b, 0x53, 0xd4, 0xdf, 0xee, 0x47, 0x4d, 0x3b, 0x95, 0xbc, 0xae, 0x9c, 0x92, 0x62, 0xc2,
+  0xda, 0x7a, 0xf2, 0xf0, 0x35, 0x2a, 0x22, 0xac, 0xb7, 0x32, 0x95, 0x08, 0x8b, 0x90, 0x79, 0x51,
+  0xc0, 0xce, 0x6b, 0x9a, 0x4b, 0x78, 0xb2, 0xfe, 0xca, 0x84, 0x19, 0x79, 0xc9, 0x2f, 0xcb, 0x57,
+  0x57, 0x8b, 0x45, 0x4e, 0x44, 0xe1, 0x7d, 0x01, 0x16, 0xc4, 0xa5, 0x64, 0x4e, 0x94, 0x3e, 0x46,
+  0x5d, 0x8f, 0xab, 0x67, 0xad, 0x63, 0xf3, 0x7b, 0x9c, 0xc8, 0x30, 0xb3, 0xdb, 0x4a, 0x91, 0x9a,
+  0x42, 0xfd, 0x6a, 0x4f, 0x92, 0xf9, 0xf6, 0xe3, 0x47, 0xa0, 0xe2, 0xa3, 0xe5, 0xb4, 0x84, 0xe1,
+  0xdb, 0x34, 0xcd, 0xab, 0x2f, 0xd4, 0x55, 0x15, 0xb1, 0xcb, 0x99, 0xd4, 0x80, 0x8d, 0x00, 0x1e,
+  0x23, 0x5d, 0x4e, 0x60, 0x21, 0xe1, 0x5f, 0x68, 0xf7, 0xd5, 0xbb, 0x4f, 0x0a, 0xa6, 0xcd, 0x65,
+  0x77, 0x9b, 0xd4, 0x20, 0x01, 0xfc, 0x0c, 0x95, 0x47, 0xe2, 0xe6, 0x13, 0xcb, 0x20, 0x7e, 0x38,
+  0x20, 0xcd, 0x27, 0xd6, 0x62, 0x59, 0x1c, 0x0e, 0x5f, 0x1d, 0x81, 0x69, 0xe8, 0x40, 0x9e, 0x66,
+  0x6d, 0xc8, 0x39, 0x02, 0x17, 0x00, 0xac, 0x86, 0x9e, 0x2a, 0x07, 0xd1, 0xe4, 0x29, 0x8d, 0xe0,
+  0x5e, 0x28, 0x5c, 0x80, 0x38, 0x12, 0x70, 0xad, 0x56, 0x4f, 0x0c, 0x4b, 0x29, 0x31, 0x15, 0x65,
+  0x43, 0x3c, 0xf4, 0x2e, 0x0b, 0x9a, 0x89, 0x07, 0x02, 0x75, 0x0b, 0x3b, 0x14, 0x4b, 0x05, 0x1a,
+  0xff, 0x1e, 0x71, 0x2d, 0x6b, 0x25, 0x72, 0x26, 0xa3, 0x90, 0x33, 0x33, 0xbb, 0xb9, 0x54, 0x92,
+  0xe7, 0xd2, 0x70, 0x59, 0x4a, 0x24, 0xf4, 0xb4, 0x55, 0x9f, 0xb1, 0x9b, 0x8e, 0x6c, 0x0f, 0x42,
+  0x6c, 0xa9, 0xeb, 0x44, 0x17, 0xce, 0xe0, 0x5b, 0x42, 0xcc, 0xa5, 0xd3, 0x23, 0x15, 0x99, 0xb6,
+  0xd4, 0x7c, 0x74, 0x82, 0x98, 0x99, 0x1b, 0x6b, 0x4d, 0x56, 0xbd, 0x64, 0x96, 0xcb, 0x86, 0xea,
+  0x35, 0x58, 0x78, 0x3f, 0x9a, 0x44, 0x7d, 0xca, 0x55, 0x27, 0xcd, 0xba, 0xe0, 0x5c, 0x22, 0x24,
+  0xf2, 0x30, 0x9c, 0x96, 0x81, 0xd0, 0x00, 0xc2, 0xab, 0x53, 0x12, 0xd8, 0x4f, 0xca, 0xab, 0xd0,
+  0x17, 0x64, 0x18, 0x7a, 0x41, 0x1f, 0xb6, 0x73, 0x32, 0x6a, 0x57, 0xd0, 0xfe, 0x29, 0x49, 0x1b,
+  0x14, 0x9e, 0x00, 0x38, 0x86, 0x29, 0x0c, 0xb7, 0xfa, 0x21, 0xaa, 0xd0, 0xb0, 0x50, 0x5d, 0x70,
+  0xbb, 0x1f, 0x1b, 0xbe, 0x7e, 0x37, 0x86, 0x2b, 0x66, 0x75, 0x64, 0x3c, 0x29, 0xeb, 0xd9, 0xc9,
+  0x96, 0xf8, 0x71, 0xd9, 0xa9, 0x82, 0xe1, 0xa2, 0xb0, 0x7c, 0x92, 0x30, 0x19, 0x46, 0xbc, 0x5e,
+  0xa6, 0xb2, 0x5e, 0xe6, 0x38, 0x70, 0xef, 0x2b, 0x51, 0x5d, 0x2f, 0xf1, 0xde, 0xbb, 0xb7, 0x04,
+  0xd0, 0xb5, 0xde, 0x1f, 0x71, 0x7f, 0x0f, 0x1b, 0xd9, 0x9f, 0x62, 0x01, 0xfb, 0x45, 0x61, 0x6b,
+  0x9a, 0x9a, 0xcb, 0xf9, 0x2f, 0x9f, 0x71, 0xe6, 0x4d, 0x5c, 0xb8, 0x47, 0x31, 0x18, 0xf9, 0xdf,
+  0x00, 0x30, 0x1e, 0xa7, 0x5d, 0x17, 0xfa, 0x66, 0x46, 0x56, 0xfe, 0x45, 0x82, 0x69, 0xe0, 0xfe,
+  0x67, 0x92, 0x5b, 0xfd, 0x17, 0xc9, 0x1d, 0x7a, 0xff, 0x1f, 0xc9, 0x4d, 0x7c, 0x9b, 0x9c, 0x02,
+  0x15, 0x94, 0x10, 0xbb, 0x18, 0xef, 0xe6, 0xb4, 0x48, 0xb1, 0xac, 0x97, 0x2a, 0x86, 0x93, 0x85,
+  0x4b, 0xad, 0x21, 0x33, 0x46, 0xd9, 0x0c, 0xa1, 0x33, 0x04, 0x1c, 0x14, 0xf6, 0x1d, 0xea, 0x18,
+  0x66, 0xde, 0xd2, 0xf3, 0x5a, 0x75, 0xb7, 0x52, 0x87, 0x75, 0x9e, 0x9c, 0x1d, 0x4b, 0xbc, 0x55,
+  0x77, 0x83, 0x57, 0x0b, 0xb6, 0xd7, 0x15, 0xb6, 0x26, 0x09, 0x31, 0x96, 0xf8, 0x3d, 0xc0, 0xcf,
+  0x66, 0xfa, 0xad, 0xb2, 0x6d, 0xf7, 0xd2, 0x45, 0xdd, 0x9e, 0x3c, 0x6e, 0x6b, 0xe9, 0x46, 0x02,
+  0x3b, 0xb0, 0x2b, 0x59, 0xb0, 0x6a, 0xcb, 0xa7, 0xee, 0x99, 0x77, 0x4b, 0x7f, 0xfc, 0xd0, 0xf2,
+  0x00, 0x7b, 0x0f, 0x22, 0x83, 0xb2, 0x9d, 0xd8, 0xbf, 0x78, 0x40, 0x42, 0xfa, 0x5c, 0xea, 0x95,
+  0x73, 0xca, 0x23, 0x32, 0xa0, 0x6e, 0xc4, 0x82, 0x57, 0x94, 0x0d, 0xe1, 0x37, 0x3c, 0x56, 0x4a,
+  0x97, 0xaa, 0x96, 0xde, 0x54, 0x0a, 0x34, 0x84, 0x2b, 0x81, 0xf7, 0xe0, 0xa9, 0x5f, 0x7a, 0x48,
+  0x94, 0xd6, 0x7b, 0x1a, 0x0f, 0x0e, 0x49, 0xec, 0x39, 0xef, 0x09, 0xa7, 0x91, 0x47, 0x7c, 0x6d,
+  0xce, 0x23, 0x12, 0xc4, 0x72, 0x9f, 0x1e, 0x6c, 0x14, 0x0b, 0x89, 0xe3, 0xf1, 0x59, 0xb3, 0xbc,
+  0xd0, 0x0d, 0x96, 0x29, 0xa5, 0xf9, 0x46, 0xa4, 0xb7, 0x58, 0xde, 0x84, 0x90, 0x42, 0xbc, 0xdb,
+  0xbb, 0xb4, 0xae, 0xc0, 0x25, 0x2f, 0x3a, 0x45, 0x48, 0x94, 0x65, 0x62, 0x24, 0x12, 0x15, 0x48,
+  0xe8, 0x06, 0x13, 0x5e, 0x81, 0x4d, 0x0b, 0xc2, 0x23, 0x28, 0xf0, 0x42, 0x41, 0xe9, 0x7c, 0x78,
+  0x3a, 0x85, 0x25, 0xbf, 0x6f, 0x74, 0xc7, 0x98, 0x3f, 0xda, 0x5b, 0x87, 0x43, 0x64, 0x8f, 0xaf,
+  0xe8, 0xa7, 0x5c, 0xf6, 0x34, 0x5e, 0x82, 0x8d, 0x7f, 0x21, 0xda, 0x4f, 0x52, 0x57, 0x49, 0x3c,
+  0x59, 0xb5, 0xea, 0x41, 0x54, 0x5f, 0x24, 0xde, 0xb6, 0xba, 0x72, 0x8b, 0x60, 0x2d, 0x05, 0x67,
+  0xe2, 0xbe, 0x4c, 0xe1, 0x34, 0x9e, 0x4b, 0xc1, 0xaf, 0x55, 0x40, 0x97, 0xf5, 0x05, 0x60, 0x44,
+  0xb5, 0xd5, 0x72, 0xd9, 0x14, 0x4c, 0x4e, 0xe5, 0x03, 0xd7, 0x44, 0xe8, 0x10, 0xda, 0x96, 0x0c,
+  0x18, 0x12, 0x31, 0x4b, 0x7e, 0xaf, 0x09, 0x7e, 0xf7, 0x46, 0x8a, 0x6d, 0xd1, 0xbf, 0x27, 0x16,
+  0x74, 0x37, 0xc7, 0x82, 0x6a, 0x5e, 0x6c, 0x9c, 0x2b, 0x5e, 0x4f, 0x0b, 0x0f, 0xe4, 0xd8, 0x26,
+  0x8f, 0x8e, 0x25, 0x17, 0x45, 0x21, 0x8a, 0x4c, 0x66, 0x26, 0x84, 0x7c, 0xe1, 0x55, 0x2b, 0x8f,
+  0x78, 0x19, 0x5e, 0x99, 0x43, 0x25, 0x96, 0xa6, 0x58, 0xf7, 0x50, 0xe2, 0x27, 0x1d, 0x20, 0x8c,
+  0x0b, 0xd5, 0xca, 0xae, 0xa6, 0x55, 0x2a, 0xb5, 0x6d, 0xaa, 0xb7, 0xdb, 0x75, 0xbd, 0x54, 0xa9,
+  0x37, 0x8c, 0x14, 0xbc, 0x2f, 0xa0, 0x95, 0x14, 0xda, 0xa8, 0xed, 0x6a, 0xd5, 0x6d, 0x2a, 0xd2,
+  0xea, 0xd7, 0x78, 0x7e, 0xb6, 0x3d, 0x20, 0xb3, 0xba, 0x1b, 0x5e, 0x95, 0xe0, 0xc6, 0xd5, 0x32,
+  0x5d, 0x28, 0xaf, 0x41, 0x2a, 0x02, 0xa2, 0xb7, 0xc2, 0x42, 0xe1, 0xcf, 0x11, 0xe6, 0x3f, 0x45,
+  0x8e, 0x41, 0x6e, 0x65, 0x9f, 0x23, 0xc6, 0xe5, 0xf1, 0x97, 0xa9, 0x0d, 0x8e, 0x75, 0x29, 0xdd,
+  0x6e, 0x3d, 0x3d, 0xd9, 0xad, 0x18, 0x2b, 0x38, 0x33, 0x9b, 0x5f, 0x56, 0x1e, 0xc0, 0xb9, 0xb5,
+  0xf9, 0x65, 0x75, 0x15, 0x67, 0xdd, 0xc9, 0xca, 0x46, 0x70, 0xfa, 0x3c, 0x75, 0xa1, 0x40, 0x9e,
+  0x5f, 0x46, 0x6c, 0xa8, 0xfc, 0xd6, 0x2c, 0x96, 0x72, 0x1a, 0x13, 0xc5, 0x45, 0xed, 0x65, 0xa1,
+  0x34, 0xc8, 0x90, 0xbf, 0x7a, 0x12, 0x6b, 0xf9, 0xf1, 0x34, 0xc4, 0x6f, 0x38, 0x29, 0x71, 0x6b,
+  0x5b, 0xcf, 0x53, 0xf4, 0x27, 0x62, 0x21, 0xc9, 0x94, 0x8f, 0x8c, 0xc1, 0xaa, 0x44, 0x92, 0xb1,
+  0xbd, 0xbd, 0x8c, 0x5b, 0xf2, 0x92, 0x00, 0x04, 0xbe, 0xa6, 0xd3, 0x25, 0xaa, 0xa9, 0xae, 0x22,
+  0xbf, 0xa6, 0xd3, 0x4c, 0xe0, 0x95, 0xad, 0xd8, 0xd8, 0x84, 0x6b, 0xdf, 0xd9, 0x40, 0x5f, 0x36,
+  0x90, 0xa9, 0xec, 0x0e, 0x12, 0xca, 0x8d, 0xbd, 0x72, 0xb9, 0xb1, 0x6f, 0xe9, 0x7a, 0xf3, 0xcf,
+  0xa4, 0x5c, 0xfc, 0x78, 0xcb, 0x22, 0x55, 0x30, 0xf2, 0x43, 0x72, 0x34, 0x19, 0x82, 0x85, 0xbe,
+  0xf1, 0x97, 0x52, 0xd4, 0x76, 0x81, 0x8c, 0xcc, 0x86, 0x24, 0xc4, 0xcb, 0x67, 0x22, 0x14, 0x30,
+  0xc6, 0xcd, 0xcc, 0xdb, 0x22, 0x6a, 0x79, 0xa1, 0x89, 0x70, 0xf2, 0xd0, 0xf3, 0x28, 0x08, 0x6f,
+  0xfa, 0xe2, 0x9d, 0x67, 0x91, 0xf5, 0x77, 0xcb, 0x2c, 0xd7, 0x1b, 0x66, 0xb9, 0xd4, 0x1d, 0x79,
+  0xbe, 0x2b, 0x61, 0x6a, 0x8d, 0x0e, 0x62, 0x3a, 0x63, 0xa5, 0xa6, 0x24, 0x0a, 0x7c, 0x4c, 0x8d,
+  0xea, 0xd1, 0xc7, 0xb8, 0xf4, 0x3d, 0x1e, 0x96, 0x70, 0xfe, 0x75, 0x2d, 0x94, 0xe9, 0x59, 0x49,
+  0xfd, 0x52, 0xb1, 0x78, 0xd6, 0x18, 0x56, 0x30, 0xc5, 0xd2, 0x2e, 0x62, 0x81, 0xcf, 0x88, 0x9b,
+  0x7b, 0x94, 0x22, 0xf9, 0x1d, 0x4e, 0xb1, 0x02, 0xca, 0xdc, 0x59, 0x1b, 0x6d, 0x1d, 0x94, 0xc4,
+  0xcf, 0x1d, 0x6f, 0xfd, 0x3f, 0xcd, 0x62, 0x1b, 0xa8, 0x07, 0x79, 0x00, 0x00
 };
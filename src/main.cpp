@@ -36,9 +36,11 @@ UserModMDNS *mdns;
   #include "App/LedModEffects.h"
   #include "App/LedModFixture.h"
   #include "App/LedModFixtureGen.h"
+  #include "App/LedModPresets.h"
   LedModFixture *fix;
   LedModFixtureGen *lfg;
   LedModEffects *eff;
+  LedModPresets *presetmod;
   #ifdef STARLIGHT_USERMOD_ARTNET
     #include "User/UserModArtNet.h"
     UserModArtNet *artnetmod;
@@ -87,6 +89,7 @@ void setup() {
     eff = new LedModEffects();
     fix = new LedModFixture();
     lfg = new LedModFixtureGen();
+    presetmod = new LedModPresets();
     #ifdef STARLIGHT_USERMOD_ARTNET
       artnetmod = new UserModArtNet();
     #endif
@@ -151,6 +154,9 @@ void setup() {
   #ifdef STARBASE_USERMOD_LIVE
     mdls->add(liveM);
   #endif
+  #ifdef STARLIGHT
+    mdls->add(presetmod);
+  #endif
 
   //do not add mdls itself as it does setup and loop for itself!!! (it is the orchestrator)
   mdls->setup();
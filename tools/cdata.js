@@ -18,6 +18,7 @@
 const fs = require("fs");
 const inliner = require("inliner");
 const zlib = require("zlib");
+const crypto = require("crypto");
 const CleanCSS = require("clean-css");
 const MinifyHTML = require("html-minifier-terser").minify;
 const packageJson = require("../package.json");
@@ -131,6 +132,7 @@ function writeHtmlGzipped(sourceFile, resultFile, page) {
 
       console.info("Compressed " + result.length + " bytes");
       const array = hexdump(result);
+      const eTag = crypto.createHash("sha1").update(result).digest("hex").substring(0, 16); //content hash, see SysModWeb::serveIndex
       const src = `/*
  * Binary array for the Web UI.
  * gzip is used for smaller size and improved speeds.
@@ -141,6 +143,7 @@ function writeHtmlGzipped(sourceFile, resultFile, page) {
  
 // Autogenerated from ${sourceFile}, do not edit!!
 const uint16_t PAGE_${page}_L = ${result.length};
+const char PAGE_${page}_ETag[] = "\\"${eTag}\\"";
 const uint8_t PAGE_${page}[] PROGMEM = {
 ${array}
 };